@@ -10,6 +10,7 @@
 #include <iosfwd>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
 
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
@@ -20,6 +21,7 @@
 /// \cond
 namespace Frame {
 struct BlockLogical;
+struct Grid;
 struct Inertial;
 }  // namespace Frame
 namespace PUP {
@@ -159,6 +161,36 @@ class Block {
 
   const std::string& name() const { return name_; }
 
+  /*!
+   * \brief The map from the BlockLogical frame to the `TargetFrame` that is
+   * shared by the `ElementMap`s of all elements in this block.
+   *
+   * - If the block is time-independent this is the `stationary_map()`, or its
+   *   restriction to the Grid frame.
+   * - If the block is time-dependent this is the
+   *   `moving_mesh_logical_to_grid_map()`, composed with the
+   *   `moving_mesh_grid_to_inertial_map()` if the `TargetFrame` is Inertial.
+   *
+   * These maps are built once per block, so constructing the `ElementMap` of
+   * each element in the block only copies a shared pointer instead of cloning
+   * the block's maps. The maps are never modified, so elements on different
+   * threads can evaluate them concurrently.
+   */
+  template <typename TargetFrame>
+  const std::shared_ptr<const domain::CoordinateMapBase<
+      Frame::BlockLogical, TargetFrame, VolumeDim>>&
+  element_block_map() const {
+    static_assert(std::is_same_v<TargetFrame, Frame::Grid> or
+                      std::is_same_v<TargetFrame, Frame::Inertial>,
+                  "The element block map is only available for the Grid and "
+                  "Inertial frames.");
+    if constexpr (std::is_same_v<TargetFrame, Frame::Grid>) {
+      return element_block_map_to_grid_;
+    } else {
+      return element_block_map_to_inertial_;
+    }
+  }
+
   /// Serialization for Charm++
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
@@ -169,6 +201,9 @@ class Block {
   friend bool operator==(const Block<LocalVolumeDim>& lhs,
                          const Block<LocalVolumeDim>& rhs);
 
+  // Build the `element_block_map`s from the other maps
+  void make_element_block_maps();
+
   std::unique_ptr<domain::CoordinateMapBase<Frame::BlockLogical,
                                             Frame::Inertial, VolumeDim>>
       stationary_map_{nullptr};
@@ -184,6 +219,12 @@ class Block {
   std::unique_ptr<
       domain::CoordinateMapBase<Frame::Distorted, Frame::Inertial, VolumeDim>>
       moving_mesh_distorted_to_inertial_map_{nullptr};
+  std::shared_ptr<const domain::CoordinateMapBase<Frame::BlockLogical,
+                                                  Frame::Grid, VolumeDim>>
+      element_block_map_to_grid_{nullptr};
+  std::shared_ptr<const domain::CoordinateMapBase<Frame::BlockLogical,
+                                                  Frame::Inertial, VolumeDim>>
+      element_block_map_to_inertial_{nullptr};
 
   size_t id_{0};
   DirectionMap<VolumeDim, BlockNeighbor<VolumeDim>> neighbors_;
@@ -3,7 +3,6 @@
 
 #include "Domain/ElementMap.hpp"
 
-#include "Domain/CoordinateMaps/Composition.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"  // IWYU pragma: keep
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
@@ -16,6 +15,17 @@ ElementMap<Dim, TargetFrame>::ElementMap(
     std::unique_ptr<
         domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
         block_map)
+    : ElementMap(element_id,
+                 std::shared_ptr<const domain::CoordinateMapBase<
+                     Frame::BlockLogical, TargetFrame, Dim>>(
+                     std::move(block_map))) {}
+
+template <size_t Dim, typename TargetFrame>
+ElementMap<Dim, TargetFrame>::ElementMap(
+    const ElementId<Dim>& element_id,
+    std::shared_ptr<
+        const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
+        block_map)
     : block_map_(std::move(block_map)),
       map_slope_{[](const ElementId<Dim>& id) {
         std::array<double, Dim> result{};
@@ -43,37 +53,25 @@ ElementMap<Dim, TargetFrame>::ElementMap(
 template <size_t Dim, typename TargetFrame>
 ElementMap<Dim, TargetFrame>::ElementMap(const ElementId<Dim>& element_id,
                                          const Block<Dim>& block)
-    : ElementMap(
-          element_id,
-          [&block]() -> std::unique_ptr<domain::CoordinateMapBase<
-                         Frame::BlockLogical, TargetFrame, Dim>> {
-            if constexpr (std::is_same_v<TargetFrame, Frame::Inertial>) {
-              if (block.is_time_dependent()) {
-                using CompositionType = domain::CoordinateMaps::Composition<
-                    tmpl::list<Frame::BlockLogical, Frame::Grid,
-                               Frame::Inertial>,
-                    Dim>;
-                return std::make_unique<CompositionType>(
-                    block.moving_mesh_logical_to_grid_map().get_clone(),
-                    block.moving_mesh_grid_to_inertial_map().get_clone());
-              } else {
-                return block.stationary_map().get_clone();
-              }
-            } else if constexpr (std::is_same_v<TargetFrame, Frame::Grid>) {
-              if (block.is_time_dependent()) {
-                return block.moving_mesh_logical_to_grid_map().get_clone();
-              } else {
-                return block.stationary_map().get_to_grid_frame();
-              }
-            }
-          }()) {
+    : ElementMap(element_id, block.template element_block_map<TargetFrame>()) {
   ASSERT(element_id.block_id() == block.id(),
          "Element " << element_id << " is not in block " << block.id() << ".");
+  ASSERT(block_map_ != nullptr,
+         "Block " << block.id() << " has no map to the element's frame.");
 }
 
 template <size_t Dim, typename TargetFrame>
 void ElementMap<Dim, TargetFrame>::pup(PUP::er& p) {
-  p | block_map_;
+  // The map is serialized as if it was owned by this element. After unpacking,
+  // elements no longer share their block map.
+  using BlockMapType =
+      domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto* block_map = const_cast<BlockMapType*>(block_map_.get());
+  p | block_map;
+  if (p.isUnpacking()) {
+    block_map_.reset(block_map);
+  }
   p | map_slope_;
   p | map_offset_;
 }
@@ -47,12 +47,22 @@ class ElementMap {
                                                        TargetFrame, Dim>>
                  block_map);
 
+  /// Construct from a `block_map` that may be shared with other elements. The
+  /// map is never modified through the `ElementMap`.
+  ElementMap(const ElementId<Dim>& element_id,
+             std::shared_ptr<const domain::CoordinateMapBase<
+                 Frame::BlockLogical, TargetFrame, Dim>>
+                 block_map);
+
   /// Construct from an `element_id` within the `block`. The (affine)
   /// ElementLogical to BlockLogical map is determined by the `element_id`. The
   /// BlockLogical to TargetFrame map is determined by the `block`:
   /// - If the block is time-independent: the `block.stationary_map()` is used.
   /// - If the block is time-dependent: The `block.moving_mesh_*_map()` maps
   ///   are used. Which maps are used depends on the TargetFrame.
+  ///
+  /// The block map is shared with all other elements in the `block` (see
+  /// `Block::element_block_map()`), so this does not allocate.
   ElementMap(const ElementId<Dim>& element_id, const Block<Dim>& block);
 
   const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>&
@@ -141,8 +151,8 @@ class ElementMap {
     return block_source_point;
   }
 
-  std::unique_ptr<
-      domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
+  std::shared_ptr<
+      const domain::CoordinateMapBase<Frame::BlockLogical, TargetFrame, Dim>>
       block_map_{nullptr};
   // map_slope_[i] = 0.5 * (segment_ids[i].endpoint(Side::Upper) -
   //                        segment_ids[i].endpoint(Side::Lower))
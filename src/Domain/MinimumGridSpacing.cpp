@@ -6,65 +6,194 @@
 // For std::min
 #include <algorithm>  // IWYU pragma: keep
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <limits>
+#include <optional>
+#include <tuple>
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/Index.hpp"
 #include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/StdArrayHelpers.hpp"
 
 namespace {
-template <size_t Dim, typename Frame>
-std::array<double, Dim> nth_point(const tnsr::I<DataVector, Dim, Frame>& tensor,
-                                  const size_t index) {
-  std::array<double, Dim> result{};
-  for (size_t d = 0; d < Dim; ++d) {
-    gsl::at(result, d) = tensor.get(d)[index];
+// Relative tolerance for deciding that the grid-to-inertial map is a rigid
+// motion or uniform scaling on an element. Only roundoff is tolerated, so the
+// rescaled minimum spacing agrees with a direct computation to roundoff.
+constexpr double rigid_map_tolerance =
+    100.0 * std::numeric_limits<double>::epsilon();
+
+// The Jacobian of a rigid motion combined with a uniform scaling by a factor s
+// is s times a rotation matrix at every point, so the inverse Jacobian times
+// its transpose is the identity over s^2. Returns s if the inverse Jacobian
+// has this form, and std::nullopt otherwise.
+template <size_t Dim>
+std::optional<double> rigid_scale_factor(
+    const InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>&
+        inv_jacobian) {
+  std::array<std::array<double, Dim>, Dim> inv_jac_at_first_point{};
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      gsl::at(gsl::at(inv_jac_at_first_point, i), j) =
+          inv_jacobian.get(i, j)[0];
+    }
   }
-  return result;
+  double inverse_scale_squared = 0.0;
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      inverse_scale_squared +=
+          square(gsl::at(gsl::at(inv_jac_at_first_point, i), j));
+    }
+  }
+  inverse_scale_squared /= static_cast<double>(Dim);
+  if (inverse_scale_squared == 0.0) {
+    return std::nullopt;
+  }
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      double product = 0.0;
+      for (size_t k = 0; k < Dim; ++k) {
+        product += gsl::at(gsl::at(inv_jac_at_first_point, i), k) *
+                   gsl::at(gsl::at(inv_jac_at_first_point, j), k);
+      }
+      if (std::abs(product - (i == j ? inverse_scale_squared : 0.0)) >
+          rigid_map_tolerance * inverse_scale_squared) {
+        return std::nullopt;
+      }
+    }
+  }
+  const double inverse_scale = sqrt(inverse_scale_squared);
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      if (max(abs(inv_jacobian.get(i, j) -
+                  gsl::at(gsl::at(inv_jac_at_first_point, i), j))) >
+          rigid_map_tolerance * inverse_scale) {
+        return std::nullopt;
+      }
+    }
+  }
+  return 1.0 / inverse_scale;
 }
 }  // namespace
 
 template <size_t Dim, typename Frame>
 double minimum_grid_spacing(const Index<Dim>& extents,
                             const tnsr::I<DataVector, Dim, Frame>& coords) {
-  double minimum_spacing = std::numeric_limits<double>::max();
-  for (IndexIterator<Dim> point(extents); point; ++point) {
-    const auto point_coords = nth_point(coords, point.collapsed_index());
-    // We assume that the coordinates are not too distorted in that
-    // the closest point to a given point cannot be off by more than
-    // one index in any dimension.
-    for (IndexIterator<Dim> offset(Index<Dim>(3)); offset; ++offset) {
-      if (*offset == Index<Dim>(1)) {
-        // All the remaining directions are the opposite of ones we
-        // have already checked.  They will be checked from the other
-        // point.
-        break;
+  // We assume that the coordinates are not too distorted in that the closest
+  // point to a given point cannot be off by more than one index in any
+  // dimension. So we check the distance between all pairs of points that are
+  // offset by at most one index in each dimension. Each pair is visited once by
+  // skipping the offsets that are the opposite of ones already checked, i.e.
+  // the offsets after Index<Dim>(1) in the iteration order.
+  //
+  // For each offset the pairs form a rectangular range of points, which is
+  // traversed row by row so the innermost loop runs over contiguous memory
+  // with a fixed stride to the other point and can be vectorized. Only squared
+  // distances are compared, taking a single square root at the end.
+  std::array<const double*, Dim> coords_data{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(coords_data, d) = coords.get(d).data();
+  }
+  double minimum_spacing_squared = std::numeric_limits<double>::max();
+  for (IndexIterator<Dim> offset(Index<Dim>(3)); offset; ++offset) {
+    if (*offset == Index<Dim>(1)) {
+      break;
+    }
+    // The points in the range are those with a neighbor at this offset
+    Index<Dim> range_extents{};
+    size_t range_start = 0;
+    ptrdiff_t shift_to_neighbor = 0;
+    size_t stride = 1;
+    bool range_is_empty = false;
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto offset_in_dim = static_cast<ptrdiff_t>((*offset)[d]) - 1;
+      range_extents[d] = extents[d] - (offset_in_dim == 0 ? 0 : 1);
+      range_is_empty = range_is_empty or range_extents[d] == 0;
+      if (offset_in_dim < 0) {
+        range_start += stride;
       }
-      // On initialization this is one-indexed.
-      Index<Dim> other_point(point->indices() + offset->indices());
-      for (size_t d = 0; d < Dim; ++d) {
-        if (other_point[d] == 0 or other_point[d] == extents[d] + 1) {
-          goto next_offset;
+      shift_to_neighbor += offset_in_dim * static_cast<ptrdiff_t>(stride);
+      stride *= extents[d];
+    }
+    if (range_is_empty) {
+      continue;
+    }
+    Index<Dim> rows = range_extents;
+    rows[0] = 1;
+    for (IndexIterator<Dim> row(rows); row; ++row) {
+      size_t row_start = range_start;
+      stride = extents[0];
+      for (size_t d = 1; d < Dim; ++d) {
+        row_start += (*row)[d] * stride;
+        stride *= extents[d];
+      }
+      double row_minimum = std::numeric_limits<double>::max();
+      // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      for (size_t i = row_start; i < row_start + range_extents[0]; ++i) {
+        const auto neighbor = static_cast<size_t>(
+            static_cast<ptrdiff_t>(i) + shift_to_neighbor);
+        double distance_squared = 0.0;
+        for (size_t d = 0; d < Dim; ++d) {
+          distance_squared += square(gsl::at(coords_data, d)[neighbor] -
+                                     gsl::at(coords_data, d)[i]);
         }
-        --other_point[d];
+        row_minimum = std::min(row_minimum, distance_squared);
       }
-      minimum_spacing = std::min(
-          minimum_spacing,
-          magnitude(nth_point(coords, collapsed_index(other_point, extents)) -
-                    point_coords));
-
-    next_offset:;
+      // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      minimum_spacing_squared = std::min(minimum_spacing_squared, row_minimum);
     }
   }
 
-  return minimum_spacing;
+  if (minimum_spacing_squared == std::numeric_limits<double>::max()) {
+    // A single point has no neighbors
+    return minimum_spacing_squared;
+  }
+  return sqrt(minimum_spacing_squared);
 }
 
+template <size_t Dim>
+double minimum_grid_spacing(
+    const Index<Dim>& extents,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+    const double grid_minimum_spacing,
+    const InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>&
+        inv_jacobian_grid_to_inertial) {
+  const std::optional<double> scale_factor =
+      rigid_scale_factor(inv_jacobian_grid_to_inertial);
+  if (scale_factor.has_value()) {
+    return *scale_factor * grid_minimum_spacing;
+  }
+  return minimum_grid_spacing(extents, inertial_coords);
+}
+
+namespace domain::Tags {
+template <size_t Dim>
+void MinimumGridSpacingFromGridCompute<Dim>::function(
+    const gsl::not_null<double*> result, const ::Mesh<Dim>& mesh,
+    const double grid_minimum_spacing,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+    const std::optional<std::tuple<
+        tnsr::I<DataVector, Dim, Frame::Inertial>,
+        ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
+        ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
+        tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+        grid_to_inertial_quantities) {
+  if (not grid_to_inertial_quantities.has_value()) {
+    // The grid-to-inertial map is the identity
+    *result = grid_minimum_spacing;
+    return;
+  }
+  *result = minimum_grid_spacing(mesh.extents(), inertial_coords,
+                                 grid_minimum_spacing,
+                                 std::get<1>(*grid_to_inertial_quantities));
+}
+}  // namespace domain::Tags
+
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
 
@@ -75,6 +204,19 @@ double minimum_grid_spacing(const Index<Dim>& extents,
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (Frame::Grid, Frame::Inertial))
 
-#undef DIM
 #undef FRAME
 #undef INSTANTIATE
+
+#define INSTANTIATE(_, data)                                                  \
+  template double minimum_grid_spacing(                                       \
+      const Index<DIM(data)>& extents,                                        \
+      const tnsr::I<DataVector, DIM(data), Frame::Inertial>& inertial_coords, \
+      double grid_minimum_spacing,                                            \
+      const InverseJacobian<DataVector, DIM(data), Frame::Grid,               \
+                            Frame::Inertial>& inv_jacobian_grid_to_inertial); \
+  template struct domain::Tags::MinimumGridSpacingFromGridCompute<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
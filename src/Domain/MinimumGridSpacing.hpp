@@ -4,7 +4,9 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <string>
+#include <tuple>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -18,6 +20,10 @@ template <size_t Dim>
 class Index;
 template <size_t Dim>
 class Mesh;
+namespace domain::Tags {
+template <size_t Dim>
+struct CoordinatesMeshVelocityAndJacobians;
+}  // namespace domain::Tags
 /// \endcond
 
 /// \ingroup ComputationalDomainGroup
@@ -26,6 +32,24 @@ template <size_t Dim, typename Frame>
 double minimum_grid_spacing(const Index<Dim>& extents,
                             const tnsr::I<DataVector, Dim, Frame>& coords);
 
+/// \ingroup ComputationalDomainGroup
+/// Finds the minimum coordinate distance between grid points in the inertial
+/// frame, reusing the `grid_minimum_spacing` if possible.
+///
+/// If the grid-to-inertial map is a rigid motion combined with a uniform
+/// scaling on this element, i.e. the Jacobian is the same multiple of a
+/// rotation matrix at all points, then all distances are scaled by the same
+/// factor and the minimum spacing is computed analytically from the
+/// `grid_minimum_spacing`. Otherwise it is computed from the
+/// `inertial_coords`.
+template <size_t Dim>
+double minimum_grid_spacing(
+    const Index<Dim>& extents,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+    double grid_minimum_spacing,
+    const InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>&
+        inv_jacobian_grid_to_inertial);
+
 namespace domain {
 namespace Tags {
 /// @{
@@ -49,6 +73,36 @@ struct MinimumGridSpacingCompute : MinimumGridSpacing<Dim, Frame>,
   }
   using argument_tags = tmpl::list<Mesh<Dim>, Coordinates<Dim, Frame>>;
 };
+
+/// Computes the minimum coordinate distance between grid points in the
+/// inertial frame from the one in the grid frame when the grid-to-inertial map
+/// is a rigid motion or uniform scaling on the element.
+///
+/// The grid-frame spacing only changes with the mesh, whereas the inertial
+/// coordinates change every substep with a moving mesh. See the
+/// `minimum_grid_spacing` overload that takes the `grid_minimum_spacing` for
+/// details.
+template <size_t Dim>
+struct MinimumGridSpacingFromGridCompute
+    : MinimumGridSpacing<Dim, Frame::Inertial>,
+      db::ComputeTag {
+  using base = MinimumGridSpacing<Dim, Frame::Inertial>;
+  using return_type = double;
+  static void function(
+      gsl::not_null<double*> result, const ::Mesh<Dim>& mesh,
+      double grid_minimum_spacing,
+      const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+      const std::optional<std::tuple<
+          tnsr::I<DataVector, Dim, Frame::Inertial>,
+          ::InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
+          ::Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>,
+          tnsr::I<DataVector, Dim, Frame::Inertial>>>&
+          grid_to_inertial_quantities);
+  using argument_tags =
+      tmpl::list<Mesh<Dim>, MinimumGridSpacing<Dim, Frame::Grid>,
+                 Coordinates<Dim, Frame::Inertial>,
+                 CoordinatesMeshVelocityAndJacobians<Dim>>;
+};
 /// @}
 }  // namespace Tags
 }  // namespace domain
@@ -5,7 +5,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <map>
 #include <numeric>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -293,28 +297,108 @@ std::vector<size_t> oriented_offset_on_slice(
       neighbor_second_axis_is_aligned, neighbor_axes_are_transposed);
 }
 
-template <typename T>
-void orient_each_component(
-    const gsl::not_null<gsl::span<T>*> oriented_variables,
-    const gsl::span<const T>& variables, const size_t num_pts,
-    const std::vector<size_t>& oriented_offset) {
+// Encodes the orientation, the extents, and the sliced dimension (if any) in a
+// key that uniquely identifies a permutation.
+template <size_t VolumeDim, size_t Dim>
+std::array<size_t, 2 * VolumeDim + 1> permutation_key(
+    const Index<Dim>& extents, const size_t sliced_dim,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor) {
+  static_assert(Dim == VolumeDim or Dim + 1 == VolumeDim);
+  std::array<size_t, 2 * VolumeDim + 1> key{};
+  for (size_t d = 0; d < VolumeDim; ++d) {
+    const Direction<VolumeDim> neighbor_axis =
+        orientation_of_neighbor(Direction<VolumeDim>(d, Side::Upper));
+    gsl::at(key, d) = 2 * neighbor_axis.dimension() +
+                      (neighbor_axis.side() == Side::Upper ? 1 : 0);
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(key, VolumeDim + d) = extents[d];
+  }
+  gsl::at(key, 2 * VolumeDim) = sliced_dim;
+  return key;
+}
+
+// Inverts the permutation computed by `oriented_offset` or
+// `oriented_offset_on_slice` into gather indices and caches the result.
+//
+// The cache is thread-local so lookups don't need to be synchronized. It holds
+// one table for each combination of orientation and extents that the thread
+// has seen, which is a small number for any domain. Since entries are never
+// removed and `std::map` doesn't invalidate references on insertion, the
+// returned references stay valid for the lifetime of the thread.
+template <size_t VolumeDim, size_t Dim, typename ComputeOffsets>
+const std::vector<size_t>& cached_gather_indices(
+    const Index<Dim>& extents, const size_t sliced_dim,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor,
+    const ComputeOffsets& compute_offsets) {
+  thread_local std::map<std::array<size_t, 2 * VolumeDim + 1>,
+                        std::vector<size_t>>
+      cache{};
+  const auto key =
+      permutation_key(extents, sliced_dim, orientation_of_neighbor);
+  const auto cached = cache.find(key);
+  if (cached != cache.end()) {
+    return cached->second;
+  }
+  const std::vector<size_t> oriented_offsets = compute_offsets();
+  std::vector<size_t> gather_indices(oriented_offsets.size());
+  for (size_t s = 0; s < oriented_offsets.size(); ++s) {
+    gather_indices[oriented_offsets[s]] = s;
+  }
+  return cache.emplace(key, std::move(gather_indices)).first->second;
+}
+
+void orient_each_component(const gsl::not_null<DataVector*> oriented_variables,
+                           const DataVector& variables, const size_t num_pts,
+                           const std::vector<size_t>& gather_indices) {
   const size_t num_components = variables.size() / num_pts;
   ASSERT(oriented_variables->size() == variables.size(),
          "The number of oriented variables, "
              << oriented_variables->size() / num_pts
              << ", must be equal to the number of variables, "
              << variables.size() / num_pts);
+  ASSERT(gather_indices.size() == num_pts,
+         "Expected " << num_pts << " gather indices, but got "
+                     << gather_indices.size());
   for (size_t component_index = 0; component_index < num_components;
        ++component_index) {
-    const size_t offset = component_index * num_pts;
+    const double* const component =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        variables.data() + component_index * num_pts;
+    double* const oriented_component =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        oriented_variables->data() + component_index * num_pts;
     for (size_t s = 0; s < num_pts; ++s) {
-      gsl::at((*oriented_variables), offset + oriented_offset[s]) =
-          gsl::at(variables, offset + s);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      oriented_component[s] = component[gather_indices[s]];
     }
   }
 }
 }  // namespace
 
+template <size_t VolumeDim>
+const std::vector<size_t>& orientation_gather_indices(
+    const Index<VolumeDim>& extents,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor) {
+  return cached_gather_indices(extents, 0, orientation_of_neighbor, [&]() {
+    return oriented_offset(extents, orientation_of_neighbor);
+  });
+}
+
+template <size_t VolumeDim>
+const std::vector<size_t>& orientation_gather_indices_on_slice(
+    const Index<VolumeDim - 1>& slice_extents, const size_t sliced_dim,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor) {
+  ASSERT(sliced_dim < VolumeDim,
+         "Cannot slice dimension " << sliced_dim << " of a " << VolumeDim
+                                   << "D volume.");
+  return cached_gather_indices(
+      slice_extents, sliced_dim, orientation_of_neighbor, [&]() {
+        return oriented_offset_on_slice(slice_extents, sliced_dim,
+                                        orientation_of_neighbor);
+      });
+}
+
 template <size_t VolumeDim>
 void orient_variables(
     const gsl::not_null<DataVector*> result, const DataVector& variables,
@@ -334,12 +418,9 @@ void orient_variables(
     return;
   }
 
-  const auto oriented_extents =
-      oriented_offset(extents, orientation_of_neighbor);
-  auto oriented_vars_view = gsl::make_span(result->data(), result->size());
-  orient_each_component(make_not_null(&oriented_vars_view),
-                        gsl::make_span(variables.data(), variables.size()),
-                        number_of_grid_points, oriented_extents);
+  orient_each_component(
+      result, variables, number_of_grid_points,
+      orientation_gather_indices(extents, orientation_of_neighbor));
 }
 
 template <size_t VolumeDim>
@@ -363,14 +444,10 @@ void orient_variables_on_slice(
     return;
   }
 
-  const auto oriented_offset = oriented_offset_on_slice(
-      slice_extents, sliced_dim, orientation_of_neighbor);
-
-  auto oriented_vars_view = gsl::make_span(result->data(), result->size());
   orient_each_component(
-      make_not_null(&oriented_vars_view),
-      gsl::make_span(variables_on_slice.data(), variables_on_slice.size()),
-      number_of_grid_points, oriented_offset);
+      result, variables_on_slice, number_of_grid_points,
+      orientation_gather_indices_on_slice(slice_extents, sliced_dim,
+                                          orientation_of_neighbor));
 }
 
 template <size_t VolumeDim>
@@ -428,6 +505,12 @@ DataVector orient_variables_on_slice(
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data)                                               \
+  template const std::vector<size_t>& orientation_gather_indices(            \
+      const Index<DIM(data)>& extents,                                       \
+      const OrientationMap<DIM(data)>& orientation_of_neighbor);             \
+  template const std::vector<size_t>& orientation_gather_indices_on_slice(   \
+      const Index<DIM(data) - 1>& slice_extents, size_t sliced_dim,          \
+      const OrientationMap<DIM(data)>& orientation_of_neighbor);             \
   template void orient_variables(                                            \
       const gsl::not_null<DataVector*> result, const DataVector& variables,  \
       const Index<DIM(data)>& extents,                                       \
@@ -20,6 +20,30 @@ template <typename TagsList>
 class Variables;
 /// \endcond
 
+/// @{
+/// \ingroup ComputationalDomainGroup
+/// \brief The indices to gather data from to orient it to the data-storage
+/// order of a neighbor element with the given orientation.
+///
+/// Each tensor component is oriented as `oriented[i] = data[indices[i]]`. This
+/// is what `orient_variables` and `orient_variables_on_slice` do, but the
+/// indices can also be used to orient data directly into a buffer, or to fuse
+/// the orientation with another operation on the data.
+///
+/// The indices are computed once per thread for every combination of
+/// orientation and extents, so the returned reference remains valid for the
+/// lifetime of the calling thread.
+template <size_t VolumeDim>
+const std::vector<size_t>& orientation_gather_indices(
+    const Index<VolumeDim>& extents,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor);
+
+template <size_t VolumeDim>
+const std::vector<size_t>& orientation_gather_indices_on_slice(
+    const Index<VolumeDim - 1>& slice_extents, size_t sliced_dim,
+    const OrientationMap<VolumeDim>& orientation_of_neighbor);
+/// @}
+
 /// @{
 /// \ingroup ComputationalDomainGroup
 /// \brief Orient variables to the data-storage order of a neighbor element with
@@ -24,6 +24,7 @@
 #include "Domain/Tags/Faces.hpp"
 #include "Domain/Tags/SurfaceJacobian.hpp"
 #include "Elliptic/BoundaryConditions/ApplyBoundaryCondition.hpp"
+#include "Elliptic/DiscontinuousGalerkin/AssembledOperator.hpp"
 #include "Elliptic/DiscontinuousGalerkin/DgOperator.hpp"
 #include "Elliptic/DiscontinuousGalerkin/Initialization.hpp"
 #include "Elliptic/DiscontinuousGalerkin/Tags.hpp"
@@ -148,6 +149,8 @@ struct PrepareAndSendMortarData<
       MortarDataInboxTag<Dim, TemporalIdTag,
                          typename PrimalMortarFieldsTag::tags_list,
                          typename PrimalMortarFluxesTag::tags_list>;
+  using assembled_operator_tag =
+      elliptic::dg::Tags::AssembledOperator<Dim, OperatorAppliedToFieldsTag>;
   using BoundaryConditionsBase = typename System::boundary_conditions_base;
 
  public:
@@ -162,20 +165,17 @@ struct PrepareAndSendMortarData<
   using const_global_cache_tags =
       tmpl::list<domain::Tags::ExternalBoundaryConditions<Dim>>;
 
-  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
-            typename ActionList, typename ParallelComponent>
-  static Parallel::iterable_action_return_t apply(
-      db::DataBox<DbTagsList>& box,
-      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
-      Parallel::GlobalCache<Metavariables>& cache,
-      const ElementId<Dim>& element_id, const ActionList /*meta*/,
-      const ParallelComponent* const /*meta*/) {
-    const auto& temporal_id = db::get<TemporalIdTag>(box);
-    const auto& element = db::get<domain::Tags::Element<Dim>>(box);
+  // Compute the primal fluxes and the mortar data from the `primal_vars`,
+  // taking all other arguments from the DataBox. This is also used to assemble
+  // the operator.
+  template <typename DbTagsList>
+  static void prepare_mortar_data(
+      const gsl::not_null<typename PrimalFluxesTag::type*> primal_fluxes,
+      const gsl::not_null<typename all_mortar_data_tag::type*> all_mortar_data,
+      const typename PrimalFieldsTag::type& primal_vars,
+      const db::DataBox<DbTagsList>& box, const ElementId<Dim>& element_id) {
     const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
     const size_t num_points = mesh.number_of_grid_points();
-    const auto& mortar_meshes =
-        db::get<::Tags::Mortars<domain::Tags::Mesh<Dim - 1>, Dim>>(box);
     const auto& boundary_conditions =
         db::get<domain::Tags::ExternalBoundaryConditions<Dim>>(box).at(
             element_id.block_id());
@@ -202,24 +202,6 @@ struct PrepareAndSendMortarData<
               std::forward<decltype(fields_and_fluxes)>(fields_and_fluxes)...);
         };
 
-    // Can't `db::get` the arguments for the boundary conditions within
-    // `db::mutate`, so we extract the data to mutate and move it back in when
-    // we're done.
-    // Possible optimization: also keep memory for the mortar data around in the
-    // DataBox. Currently the mortar data is extracted and erased by
-    // `apply_operator` anyway, so we can just create a new map here to avoid
-    // dealing with AMR resizing the mortars. When we keep the memory around,
-    // its size has to be adjusted when the mesh changes during AMR.
-    typename PrimalFluxesTag::type primal_fluxes;
-    typename all_mortar_data_tag::type all_mortar_data{};
-    db::mutate<PrimalFluxesTag>(
-        [&primal_fluxes](const auto local_primal_fluxes) {
-          primal_fluxes = std::move(*local_primal_fluxes);
-        },
-        make_not_null(&box));
-
-    // Prepare mortar data
-    //
     // These memory buffers will be discarded when the action returns so we
     // don't inflate the memory usage of the simulation when the element is
     // inactive.
@@ -228,25 +210,82 @@ struct PrepareAndSendMortarData<
                                tmpl::size_t<Dim>, Frame::Inertial>>
         deriv_fields{num_points};
     elliptic::dg::prepare_mortar_data<System, Linearized>(
-        make_not_null(&deriv_fields), make_not_null(&primal_fluxes),
-        make_not_null(&all_mortar_data), db::get<PrimalFieldsTag>(box), element,
-        db::get<domain::Tags::Mesh<Dim>>(box),
+        make_not_null(&deriv_fields), primal_fluxes, all_mortar_data,
+        primal_vars, db::get<domain::Tags::Element<Dim>>(box), mesh,
         db::get<domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
                                               Frame::Inertial>>(box),
         db::get<domain::Tags::Faces<Dim, domain::Tags::FaceNormal<Dim>>>(box),
-        mortar_meshes,
+        db::get<::Tags::Mortars<domain::Tags::Mesh<Dim - 1>, Dim>>(box),
         db::get<::Tags::Mortars<::Tags::MortarSize<Dim - 1>, Dim>>(box),
-        temporal_id, apply_boundary_condition,
+        db::get<TemporalIdTag>(box), apply_boundary_condition,
         std::forward_as_tuple(db::get<FluxesArgsTags>(box)...));
+  }
 
-    // Move the mutated data back into the DataBox
-    db::mutate<PrimalFluxesTag, all_mortar_data_tag>(
-        [&primal_fluxes, &all_mortar_data](const auto local_primal_fluxes,
-                                           const auto local_all_mortar_data) {
-          *local_primal_fluxes = std::move(primal_fluxes);
-          *local_all_mortar_data = std::move(all_mortar_data);
-        },
-        make_not_null(&box));
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const auto& temporal_id = db::get<TemporalIdTag>(box);
+    const auto& element = db::get<domain::Tags::Element<Dim>>(box);
+    const auto& mortar_meshes =
+        db::get<::Tags::Mortars<domain::Tags::Mesh<Dim - 1>, Dim>>(box);
+    using BoundaryData =
+        elliptic::dg::BoundaryData<typename PrimalMortarFieldsTag::tags_list,
+                                   typename PrimalMortarFluxesTag::tags_list>;
+    constexpr bool is_assembled =
+        db::tag_is_retrievable_v<assembled_operator_tag,
+                                 db::DataBox<DbTagsList>>;
+
+    if constexpr (is_assembled) {
+      // Apply the assembled operator. The mortar data isn't stored in the
+      // DataBox because the assembled operator doesn't need it to compute the
+      // boundary corrections.
+      ASSERT(db::get<assembled_operator_tag>(box).has_value(),
+             "The DG operator has not been assembled. Add the "
+             "'AssembleOperator' action before applying the operator.");
+      db::mutate<PrimalFluxesTag>(
+          [](const auto primal_fluxes, const auto& assembled_operator,
+             const auto& primal_vars) {
+            *primal_fluxes = assembled_operator->primal_fluxes *
+                             primal_vars.get_variable_data();
+          },
+          make_not_null(&box), db::get<assembled_operator_tag>(box),
+          db::get<PrimalFieldsTag>(box));
+    } else {
+      // Can't `db::get` the arguments for the boundary conditions within
+      // `db::mutate`, so we extract the data to mutate and move it back in when
+      // we're done.
+      // Possible optimization: also keep memory for the mortar data around in
+      // the DataBox. Currently the mortar data is extracted and erased by
+      // `apply_operator` anyway, so we can just create a new map here to avoid
+      // dealing with AMR resizing the mortars. When we keep the memory around,
+      // its size has to be adjusted when the mesh changes during AMR.
+      typename PrimalFluxesTag::type primal_fluxes;
+      typename all_mortar_data_tag::type all_mortar_data{};
+      db::mutate<PrimalFluxesTag>(
+          [&primal_fluxes](const auto local_primal_fluxes) {
+            primal_fluxes = std::move(*local_primal_fluxes);
+          },
+          make_not_null(&box));
+
+      // Prepare mortar data
+      prepare_mortar_data(make_not_null(&primal_fluxes),
+                          make_not_null(&all_mortar_data),
+                          db::get<PrimalFieldsTag>(box), box, element_id);
+
+      // Move the mutated data back into the DataBox
+      db::mutate<PrimalFluxesTag, all_mortar_data_tag>(
+          [&primal_fluxes, &all_mortar_data](const auto local_primal_fluxes,
+                                             const auto local_all_mortar_data) {
+            *local_primal_fluxes = std::move(primal_fluxes);
+            *local_all_mortar_data = std::move(all_mortar_data);
+          },
+          make_not_null(&box));
+    }
 
     // Send mortar data to neighbors
     auto& receiver_proxy =
@@ -259,9 +298,16 @@ struct PrepareAndSendMortarData<
         const ::dg::MortarId<Dim> mortar_id{direction, neighbor_id};
         // Make a copy of the local boundary data on the mortar to send to the
         // neighbor
-        auto remote_boundary_data_on_mortar =
-            get<all_mortar_data_tag>(box).at(mortar_id).local_data(
-                temporal_id);
+        BoundaryData remote_boundary_data_on_mortar{};
+        if constexpr (is_assembled) {
+          remote_boundary_data_on_mortar.field_data =
+              db::get<assembled_operator_tag>(box)->mortar_data.at(mortar_id) *
+              db::get<PrimalFieldsTag>(box).get_variable_data();
+        } else {
+          remote_boundary_data_on_mortar =
+              get<all_mortar_data_tag>(box).at(mortar_id).local_data(
+                  temporal_id);
+        }
         // Reorient the data to the neighbor orientation if necessary
         if (not orientation.is_aligned()) {
           remote_boundary_data_on_mortar.orient_on_slice(
@@ -314,6 +360,8 @@ struct ReceiveMortarDataAndApplyOperator<
       MortarDataInboxTag<Dim, TemporalIdTag,
                          typename PrimalMortarFieldsTag::tags_list,
                          typename PrimalMortarFluxesTag::tags_list>;
+  using assembled_operator_tag =
+      elliptic::dg::Tags::AssembledOperator<Dim, OperatorAppliedToFieldsTag>;
 
  public:
   using const_global_cache_tags =
@@ -321,44 +369,22 @@ struct ReceiveMortarDataAndApplyOperator<
                  elliptic::dg::Tags::Massive, elliptic::dg::Tags::Formulation>;
   using inbox_tags = tmpl::list<mortar_data_inbox_tag>;
 
-  template <typename DbTags, typename... InboxTags, typename Metavariables,
-            typename ArrayIndex, typename ActionList,
-            typename ParallelComponent>
-  static Parallel::iterable_action_return_t apply(
-      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
-      const Parallel::GlobalCache<Metavariables>& /*cache*/,
-      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
-      const ParallelComponent* const /*meta*/) {
-    const auto& temporal_id = get<TemporalIdTag>(box);
-    const auto& element = get<domain::Tags::Element<Dim>>(box);
-
-    if (not ::dg::has_received_from_all_mortars<mortar_data_inbox_tag>(
-            temporal_id, element, inboxes)) {
-      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
-    }
-
-    // Move received "remote" mortar data into the DataBox
-    if (LIKELY(element.number_of_neighbors() > 0)) {
-      auto received_mortar_data =
-          std::move(tuples::get<mortar_data_inbox_tag>(inboxes)
-                        .extract(temporal_id)
-                        .mapped());
-      db::mutate<all_mortar_data_tag>(
-          [&received_mortar_data, &temporal_id](const auto all_mortar_data) {
-            for (auto& [mortar_id, mortar_data] : received_mortar_data) {
-              all_mortar_data->at(mortar_id).remote_insert(
-                  temporal_id, std::move(mortar_data));
-            }
-          },
-          make_not_null(&box));
-    }
-
+  // Apply the DG operator to the `primal_vars`, given their `primal_fluxes`
+  // and the data on both sides of all mortars. All other arguments are taken
+  // from the DataBox. This is also used to assemble the operator.
+  template <typename DbTags>
+  static void apply_operator(
+      const gsl::not_null<typename OperatorAppliedToFieldsTag::type*>
+          operator_applied_to_vars,
+      const gsl::not_null<typename all_mortar_data_tag::type*> all_mortar_data,
+      const typename PrimalFieldsTag::type& primal_vars,
+      const typename PrimalFluxesTag::type& primal_fluxes,
+      const db::DataBox<DbTags>& box) {
     // Used to retrieve items out of the DataBox to forward to functions
     const auto get_items = [](const auto&... args) {
       return std::forward_as_tuple(args...);
     };
 
-    // Apply DG operator
     using fluxes_args_tags = typename System::fluxes_computer::argument_tags;
     using fluxes_args_volume_tags =
         typename System::fluxes_computer::volume_tags;
@@ -371,12 +397,9 @@ struct ReceiveMortarDataAndApplyOperator<
                                                  fluxes_args_volume_tags>,
                          fluxes_args_volume_tags>(get_items, box, direction));
     }
-    db::mutate<OperatorAppliedToFieldsTag, all_mortar_data_tag>(
-        [](const auto&... args) {
-          elliptic::dg::apply_operator<System, Linearized>(args...);
-        },
-        make_not_null(&box), db::get<PrimalFieldsTag>(box),
-        db::get<PrimalFluxesTag>(box), element,
+    elliptic::dg::apply_operator<System, Linearized>(
+        operator_applied_to_vars, all_mortar_data, primal_vars, primal_fluxes,
+        db::get<domain::Tags::Element<Dim>>(box),
         db::get<domain::Tags::Mesh<Dim>>(box),
         db::get<domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
                                               Frame::Inertial>>(box),
@@ -405,10 +428,294 @@ struct ReceiveMortarDataAndApplyOperator<
                                 Dim>>(box),
         db::get<::Tags::Mortars<elliptic::dg::Tags::PenaltyFactor, Dim>>(box),
         db::get<elliptic::dg::Tags::Massive>(box),
-        db::get<elliptic::dg::Tags::Formulation>(box), temporal_id,
-        fluxes_args_on_faces,
+        db::get<elliptic::dg::Tags::Formulation>(box),
+        db::get<TemporalIdTag>(box), fluxes_args_on_faces,
         std::forward_as_tuple(db::get<SourcesArgsTags>(box)...));
+  }
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const auto& temporal_id = get<TemporalIdTag>(box);
+    const auto& element = get<domain::Tags::Element<Dim>>(box);
 
+    if (not ::dg::has_received_from_all_mortars<mortar_data_inbox_tag>(
+            temporal_id, element, inboxes)) {
+      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    }
+
+    if constexpr (db::tag_is_retrievable_v<assembled_operator_tag,
+                                           db::DataBox<DbTags>>) {
+      // Apply the assembled operator: the local block acts on the primal
+      // fields and the remote blocks act on the received mortar data
+      ASSERT(db::get<assembled_operator_tag>(box).has_value(),
+             "The DG operator has not been assembled. Add the "
+             "'AssembleOperator' action before applying the operator.");
+      typename mortar_data_inbox_tag::type::mapped_type received_mortar_data{};
+      if (LIKELY(element.number_of_neighbors() > 0)) {
+        received_mortar_data =
+            std::move(tuples::get<mortar_data_inbox_tag>(inboxes)
+                          .extract(temporal_id)
+                          .mapped());
+      }
+      db::mutate<OperatorAppliedToFieldsTag>(
+          [&received_mortar_data](const auto operator_applied_to_vars,
+                                  const auto& assembled_operator,
+                                  const auto& primal_vars) {
+            *operator_applied_to_vars =
+                assembled_operator->local * primal_vars.get_variable_data();
+            for (const auto& [mortar_id, mortar_data] : received_mortar_data) {
+              *operator_applied_to_vars +=
+                  assembled_operator->remote.at(mortar_id) *
+                  mortar_data.field_data.get_variable_data();
+            }
+          },
+          make_not_null(&box), db::get<assembled_operator_tag>(box),
+          db::get<PrimalFieldsTag>(box));
+      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+    }
+
+    // Can't `db::get` the arguments for the operator within `db::mutate`, so
+    // we extract the data to mutate and move it back in when we're done.
+    typename OperatorAppliedToFieldsTag::type operator_applied_to_vars;
+    typename all_mortar_data_tag::type all_mortar_data;
+    db::mutate<OperatorAppliedToFieldsTag, all_mortar_data_tag>(
+        [&operator_applied_to_vars, &all_mortar_data](
+            const auto local_operator_applied_to_vars,
+            const auto local_all_mortar_data) {
+          operator_applied_to_vars = std::move(*local_operator_applied_to_vars);
+          all_mortar_data = std::move(*local_all_mortar_data);
+        },
+        make_not_null(&box));
+
+    // Move received "remote" mortar data into the mortar data
+    if (LIKELY(element.number_of_neighbors() > 0)) {
+      auto received_mortar_data =
+          std::move(tuples::get<mortar_data_inbox_tag>(inboxes)
+                        .extract(temporal_id)
+                        .mapped());
+      for (auto& [mortar_id, mortar_data] : received_mortar_data) {
+        all_mortar_data.at(mortar_id).remote_insert(temporal_id,
+                                                    std::move(mortar_data));
+      }
+    }
+
+    // Apply DG operator
+    apply_operator(make_not_null(&operator_applied_to_vars),
+                   make_not_null(&all_mortar_data),
+                   db::get<PrimalFieldsTag>(box), db::get<PrimalFluxesTag>(box),
+                   box);
+
+    // Move the mutated data back into the DataBox
+    db::mutate<OperatorAppliedToFieldsTag, all_mortar_data_tag>(
+        [&operator_applied_to_vars, &all_mortar_data](
+            const auto local_operator_applied_to_vars,
+            const auto local_all_mortar_data) {
+          *local_operator_applied_to_vars = std::move(operator_applied_to_vars);
+          *local_all_mortar_data = std::move(all_mortar_data);
+        },
+        make_not_null(&box));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+// Assemble the DG operator on this element into sparse matrices by feeding
+// unit vectors through the matrix-free operator, unless it is already
+// assembled. Once assembled, `PrepareAndSendMortarData` and
+// `ReceiveMortarDataAndApplyOperator` apply the matrices instead of the
+// matrix-free operator.
+template <typename System, bool Linearized, typename TemporalIdTag,
+          typename PrimalFieldsTag, typename PrimalFluxesTag,
+          typename OperatorAppliedToFieldsTag, typename PrimalMortarFieldsTag,
+          typename PrimalMortarFluxesTag>
+struct AssembleOperator {
+ private:
+  static_assert(Linearized,
+                "Only the linearized DG operator can be assembled because it "
+                "must be linear in the primal fields.");
+  static constexpr size_t Dim = System::volume_dim;
+  using prepare_action =
+      PrepareAndSendMortarData<System, Linearized, TemporalIdTag,
+                               PrimalFieldsTag, PrimalFluxesTag,
+                               OperatorAppliedToFieldsTag,
+                               PrimalMortarFieldsTag, PrimalMortarFluxesTag>;
+  using apply_action = ReceiveMortarDataAndApplyOperator<
+      System, Linearized, TemporalIdTag, PrimalFieldsTag, PrimalFluxesTag,
+      OperatorAppliedToFieldsTag, PrimalMortarFieldsTag, PrimalMortarFluxesTag>;
+  using all_mortar_data_tag = ::Tags::Mortars<
+      elliptic::dg::Tags::MortarData<typename TemporalIdTag::type,
+                                     typename PrimalMortarFieldsTag::tags_list,
+                                     typename PrimalMortarFluxesTag::tags_list>,
+      Dim>;
+  using assembled_operator_tag =
+      elliptic::dg::Tags::AssembledOperator<Dim, OperatorAppliedToFieldsTag>;
+  using BoundaryData =
+      elliptic::dg::BoundaryData<typename PrimalMortarFieldsTag::tags_list,
+                                 typename PrimalMortarFluxesTag::tags_list>;
+  using ColumnMajorMatrix = blaze::CompressedMatrix<double, blaze::columnMajor>;
+
+ public:
+  using simple_tags = tmpl::list<assembled_operator_tag>;
+  using compute_tags = tmpl::list<>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    if (db::get<assembled_operator_tag>(box).has_value()) {
+      return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+    }
+    const auto& temporal_id = db::get<TemporalIdTag>(box);
+    const auto& element = db::get<domain::Tags::Element<Dim>>(box);
+    const auto& mortar_meshes =
+        db::get<::Tags::Mortars<domain::Tags::Mesh<Dim - 1>, Dim>>(box);
+    const size_t num_points =
+        db::get<domain::Tags::Mesh<Dim>>(box).number_of_grid_points();
+
+    typename PrimalFieldsTag::type operand{num_points, 0.};
+    typename PrimalFluxesTag::type primal_fluxes{};
+    typename OperatorAppliedToFieldsTag::type operator_applied_to_operand{};
+    typename all_mortar_data_tag::type all_mortar_data{};
+    const size_t num_columns = operand.size();
+    const size_t num_rows =
+        OperatorAppliedToFieldsTag::type::number_of_independent_components *
+        num_points;
+    // Insert remote data on all internal mortars so the operator can be
+    // applied. The data is zero, except for a one at the `unit_index` on the
+    // mortar with the `unit_mortar_id`.
+    const auto insert_remote_data =
+        [&element, &temporal_id, &mortar_meshes, &all_mortar_data](
+            const std::optional<::dg::MortarId<Dim>>& unit_mortar_id,
+            const size_t unit_index) {
+          for (const auto& [direction, neighbors] : element.neighbors()) {
+            for (const auto& neighbor_id : neighbors) {
+              const ::dg::MortarId<Dim> mortar_id{direction, neighbor_id};
+              BoundaryData remote_data{};
+              remote_data.field_data.initialize(
+                  mortar_meshes.at(mortar_id).number_of_grid_points(), 0.);
+              if (mortar_id == unit_mortar_id) {
+                remote_data.field_data.data()[unit_index] = 1.;  // NOLINT
+              }
+              all_mortar_data.at(mortar_id).remote_insert(
+                  temporal_id, std::move(remote_data));
+            }
+          }
+        };
+
+    // Local blocks: feed unit vectors in the primal fields with zero remote
+    // data on all internal mortars
+    ColumnMajorMatrix primal_fluxes_matrix(
+        PrimalFluxesTag::type::number_of_independent_components * num_points,
+        num_columns);
+    ColumnMajorMatrix local_matrix(num_rows, num_columns);
+    ::dg::MortarMap<Dim, ColumnMajorMatrix> mortar_data_matrices{};
+    for (const auto& [direction, neighbors] : element.neighbors()) {
+      for (const auto& neighbor_id : neighbors) {
+        const ::dg::MortarId<Dim> mortar_id{direction, neighbor_id};
+        mortar_data_matrices.emplace(
+            mortar_id,
+            ColumnMajorMatrix(
+                decltype(BoundaryData::field_data)::
+                        number_of_independent_components *
+                    mortar_meshes.at(mortar_id).number_of_grid_points(),
+                num_columns));
+      }
+    }
+    for (size_t i = 0; i < num_columns; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      operand.data()[i] = 1.;
+      all_mortar_data = typename all_mortar_data_tag::type{};
+      prepare_action::prepare_mortar_data(make_not_null(&primal_fluxes),
+                                          make_not_null(&all_mortar_data),
+                                          operand, box, element_id);
+      elliptic::dg::detail::store_sparse_column(
+          make_not_null(&primal_fluxes_matrix), i, primal_fluxes.data());
+      for (auto& [mortar_id, mortar_data_matrix] : mortar_data_matrices) {
+        elliptic::dg::detail::store_sparse_column(
+            make_not_null(&mortar_data_matrix), i,
+            all_mortar_data.at(mortar_id)
+                .local_data(temporal_id)
+                .field_data.data());
+      }
+      insert_remote_data(std::nullopt, 0);
+      apply_action::apply_operator(
+          make_not_null(&operator_applied_to_operand),
+          make_not_null(&all_mortar_data), operand, primal_fluxes, box);
+      elliptic::dg::detail::store_sparse_column(
+          make_not_null(&local_matrix), i, operator_applied_to_operand.data());
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      operand.data()[i] = 0.;
+    }
+
+    // Remote blocks: feed unit vectors in the remote data on each internal
+    // mortar with zero primal fields
+    ::dg::MortarMap<Dim, ColumnMajorMatrix> remote_matrices{};
+    for (const auto& [mortar_id, mortar_data_matrix] : mortar_data_matrices) {
+      const size_t mortar_size = mortar_data_matrix.rows();
+      ColumnMajorMatrix remote_matrix(num_rows, mortar_size);
+      for (size_t j = 0; j < mortar_size; ++j) {
+        all_mortar_data = typename all_mortar_data_tag::type{};
+        prepare_action::prepare_mortar_data(make_not_null(&primal_fluxes),
+                                            make_not_null(&all_mortar_data),
+                                            operand, box, element_id);
+        insert_remote_data(mortar_id, j);
+        apply_action::apply_operator(
+            make_not_null(&operator_applied_to_operand),
+            make_not_null(&all_mortar_data), operand, primal_fluxes, box);
+        elliptic::dg::detail::store_sparse_column(
+            make_not_null(&remote_matrix), j,
+            operator_applied_to_operand.data());
+      }
+      remote_matrices.emplace(mortar_id, std::move(remote_matrix));
+    }
+
+    // Store row-major matrices for fast matrix-vector products
+    db::mutate<assembled_operator_tag>(
+        [&primal_fluxes_matrix, &local_matrix, &mortar_data_matrices,
+         &remote_matrices](const auto assembled_operator) {
+          *assembled_operator = elliptic::dg::AssembledOperator<Dim>{};
+          (*assembled_operator)->primal_fluxes = primal_fluxes_matrix;
+          (*assembled_operator)->local = local_matrix;
+          for (const auto& [mortar_id, matrix] : mortar_data_matrices) {
+            (*assembled_operator)->mortar_data.emplace(mortar_id, matrix);
+          }
+          for (const auto& [mortar_id, matrix] : remote_matrices) {
+            (*assembled_operator)->remote.emplace(mortar_id, matrix);
+          }
+        },
+        make_not_null(&box));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+// Discard the assembled DG operator so it gets re-assembled before it is
+// applied the next time
+template <size_t Dim, typename OperatorAppliedToFieldsTag>
+struct ResetAssembledOperator {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    db::mutate<elliptic::dg::Tags::AssembledOperator<
+        Dim, OperatorAppliedToFieldsTag>>(
+        [](const auto assembled_operator) {
+          *assembled_operator = std::nullopt;
+        },
+        make_not_null(&box));
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
@@ -488,20 +795,44 @@ using amr_projectors = tmpl::append<
  * the `PrimalFieldsTag` and the `PrimalFluxesTag`, meaning memory buffers
  * corresponding to these tags are set up in the DataBox.
  *
+ * \par Assembled operator
+ * Set `Assemble` to `true` to apply the linearized operator with precomputed
+ * sparse matrices instead of matrix-free. The operator on each element is then
+ * assembled the first time it is applied (see
+ * `elliptic::dg::AssembledOperator`) and each subsequent application is a set
+ * of sparse matrix-vector products, which is much cheaper than the matrix-free
+ * operator when it is applied many times, e.g. in the iterations of a linear
+ * solver. The assembled operator remains valid as long as the background and,
+ * for a nonlinear system, the fields that the operator is linearized around
+ * don't change. Add the `reset_actions` wherever they change (e.g. at every
+ * nonlinear-solver iteration) so the operator gets re-assembled. The mortar
+ * data is not stored in the DataBox when the operator is assembled.
+ *
  * \par AMR
  * Also add the `amr_projectors` to the list of AMR projectors to support AMR.
+ * They also reset the assembled operator.
  */
 template <typename System, bool Linearized, typename TemporalIdTag,
           typename PrimalFieldsTag, typename PrimalFluxesTag,
           typename OperatorAppliedToFieldsTag,
           typename PrimalMortarFieldsTag = PrimalFieldsTag,
-          typename PrimalMortarFluxesTag = PrimalFluxesTag>
+          typename PrimalMortarFluxesTag = PrimalFluxesTag,
+          bool Assemble = false>
 struct DgOperator {
  private:
   static constexpr size_t Dim = System::volume_dim;
+  using assembled_operator_tag =
+      elliptic::dg::Tags::AssembledOperator<Dim, OperatorAppliedToFieldsTag>;
 
  public:
-  using apply_actions =
+  using apply_actions = tmpl::append<
+      tmpl::conditional_t<
+          Assemble,
+          tmpl::list<detail::AssembleOperator<
+              System, Linearized, TemporalIdTag, PrimalFieldsTag,
+              PrimalFluxesTag, OperatorAppliedToFieldsTag,
+              PrimalMortarFieldsTag, PrimalMortarFluxesTag>>,
+          tmpl::list<>>,
       tmpl::list<detail::PrepareAndSendMortarData<
                      System, Linearized, TemporalIdTag, PrimalFieldsTag,
                      PrimalFluxesTag, OperatorAppliedToFieldsTag,
@@ -509,14 +840,23 @@ struct DgOperator {
                  detail::ReceiveMortarDataAndApplyOperator<
                      System, Linearized, TemporalIdTag, PrimalFieldsTag,
                      PrimalFluxesTag, OperatorAppliedToFieldsTag,
-                     PrimalMortarFieldsTag, PrimalMortarFluxesTag>>;
+                     PrimalMortarFieldsTag, PrimalMortarFluxesTag>>>;
+  using reset_actions =
+      tmpl::conditional_t<Assemble,
+                          tmpl::list<detail::ResetAssembledOperator<
+                              Dim, OperatorAppliedToFieldsTag>>,
+                          tmpl::list<>>;
   using amr_projectors = tmpl::list<::amr::projectors::DefaultInitialize<
-      PrimalFluxesTag, OperatorAppliedToFieldsTag,
-      ::Tags::Mortars<elliptic::dg::Tags::MortarData<
-                          typename TemporalIdTag::type,
-                          typename PrimalMortarFieldsTag::tags_list,
-                          typename PrimalMortarFluxesTag::tags_list>,
-                      Dim>>>;
+      tmpl::append<
+          tmpl::list<PrimalFluxesTag, OperatorAppliedToFieldsTag,
+                     ::Tags::Mortars<
+                         elliptic::dg::Tags::MortarData<
+                             typename TemporalIdTag::type,
+                             typename PrimalMortarFieldsTag::tags_list,
+                             typename PrimalMortarFluxesTag::tags_list>,
+                         Dim>>,
+          tmpl::conditional_t<Assemble, tmpl::list<assembled_operator_tag>,
+                              tmpl::list<>>>>>;
 };
 
 /*!
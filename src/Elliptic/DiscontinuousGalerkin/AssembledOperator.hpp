@@ -0,0 +1,98 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <blaze/math/Column.h>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <pup.h>
+
+#include "DataStructures/CompressedMatrix.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
+
+namespace elliptic::dg {
+
+/*!
+ * \brief The linear elliptic DG operator on an element, assembled as sparse
+ * matrices
+ *
+ * The DG operator on an element is a linear function of the primal fields on
+ * the element and the mortar data received from its neighbors (when it is
+ * linear or linearized). These matrices represent that function:
+ *
+ * - `primal_fluxes`: maps the primal fields to the primal fluxes, which are
+ *   kept around as an intermediate result of the operator.
+ * - `mortar_data`: maps the primal fields to the data on this element's side
+ *   of each internal mortar, before it is oriented and sent to the neighbor.
+ * - `local`: maps the primal fields to the operator applied to them, including
+ *   external boundary conditions and the local side of all internal mortars.
+ * - `remote`: maps the mortar data received from the neighbor on each internal
+ *   mortar to its contribution to the operator.
+ *
+ * \see elliptic::dg::Actions::DgOperator
+ */
+template <size_t Dim>
+struct AssembledOperator {
+  using matrix_type = blaze::CompressedMatrix<double, blaze::rowMajor>;
+
+  matrix_type primal_fluxes{};
+  matrix_type local{};
+  ::dg::MortarMap<Dim, matrix_type> mortar_data{};
+  ::dg::MortarMap<Dim, matrix_type> remote{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | primal_fluxes;
+    p | local;
+    p | mortar_data;
+    p | remote;
+  }
+};
+
+namespace detail {
+// Store the `column_data` in column `column` of the `matrix`, skipping entries
+// with a magnitude of at most `100 * epsilon * max_k |column_data[k]|`. The
+// threshold is relative to the largest entry of the column so that operators
+// with very small scales, e.g. far out in large domains, keep all their
+// entries. This differs from `LinearSolver::Serial::build_matrix`, which skips
+// entries that are zero within the absolute `equal_within_roundoff` tolerance.
+inline void store_sparse_column(
+    const gsl::not_null<blaze::CompressedMatrix<double, blaze::columnMajor>*>
+        matrix,
+    const size_t column, const double* const column_data) {
+  double max_magnitude = 0.;
+  for (size_t k = 0; k < matrix->rows(); ++k) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    max_magnitude = std::max(max_magnitude, std::abs(column_data[k]));
+  }
+  const double threshold =
+      100. * std::numeric_limits<double>::epsilon() * max_magnitude;
+  auto col = blaze::column(*matrix, column);
+  for (size_t k = 0; k < matrix->rows(); ++k) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const double value = column_data[k];
+    if (std::abs(value) > threshold) {
+      col[k] = value;
+    }
+  }
+}
+}  // namespace detail
+
+namespace Tags {
+/// The `elliptic::dg::AssembledOperator` that computes the
+/// `OperatorAppliedToFieldsTag`, or `std::nullopt` if it needs to be
+/// (re-)assembled
+template <size_t Dim, typename OperatorAppliedToFieldsTag>
+struct AssembledOperator : db::SimpleTag {
+  using type = std::optional<elliptic::dg::AssembledOperator<Dim>>;
+};
+}  // namespace Tags
+}  // namespace elliptic::dg
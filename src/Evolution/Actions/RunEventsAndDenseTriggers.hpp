@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <tuple>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -61,6 +63,15 @@ namespace evolution::Actions {
 /// provided for convenience to provide an `is_ready` function when a
 /// pure mutate-apply is desired.
 ///
+/// When dense output is first needed in a step, it is also computed
+/// at the already-scheduled checks later in the step of all triggers
+/// with events that need the evolved variables, using a single pass
+/// over the time-stepper history.  If the dense output is not
+/// available at all of those times, only the current trigger time is
+/// computed.  The events are still run one time
+/// at a time, with the precomputed values reused as the checks are
+/// reached.
+///
 /// At the end of the action, the values of the time, evolved
 /// variables, and anything appearing in the `return_tags` of the \p
 /// Postprocessors will be restored to their initial values.
@@ -204,6 +215,7 @@ struct RunEventsAndDenseTriggers {
 
     const auto step_end =
         time_step_id.step_time() + db::get<::Tags::TimeStep>(box);
+    const evolution_less<double> before{time_step_id.time_runs_forward()};
     const evolution_less_equal<double> before_equal{
         time_step_id.time_runs_forward()};
 
@@ -222,6 +234,10 @@ struct RunEventsAndDenseTriggers {
     StateRestorer<DbTags, postprocessor_restore_tags> postprocessor_restorer(
         make_not_null(&box));
 
+    // Dense output precomputed for checks later in this step.
+    std::vector<double> dense_output_times{};
+    std::vector<typename variables_tag::type> dense_output_values{};
+
     for (;;) {
       const double next_trigger = events_and_dense_triggers.next_trigger(box);
       if (before_equal(step_end.value(), next_trigger)) {
@@ -246,24 +262,50 @@ struct RunEventsAndDenseTriggers {
           return {Parallel::AlgorithmExecution::Retry, std::nullopt};
         case TriggeringState::NeedsEvolvedVariables: {
           using history_tag = ::Tags::HistoryEvolvedVariables<variables_tag>;
-          bool dense_output_succeeded = false;
+          auto dense_output_index = static_cast<size_t>(
+              std::find(dense_output_times.begin(), dense_output_times.end(),
+                        next_trigger) -
+              dense_output_times.begin());
+          if (dense_output_index == dense_output_times.size()) {
+            dense_output_times.assign(1, next_trigger);
+            for (const double check :
+                 events_and_dense_triggers
+                     .scheduled_checks_needing_evolved_variables()) {
+              if (before(next_trigger, check) and
+                  before(check, step_end.value())) {
+                dense_output_times.push_back(check);
+              }
+            }
+            const auto& time_stepper =
+                db::get<::Tags::TimeStepper<TimeStepper>>(box);
+            const auto& history = db::get<history_tag>(box);
+            const auto& initial = *history.complete_step_start().value;
+            dense_output_values.assign(dense_output_times.size(), initial);
+            if (not time_stepper.dense_update_u(
+                    make_not_null(&dense_output_values), initial, history,
+                    dense_output_times)) {
+              // The later checks can be past the end of the available
+              // history (e.g., for substep methods, which only
+              // produce dense output up to the most recent step), so
+              // try again with only the current trigger.
+              dense_output_times.resize(1);
+              dense_output_values.assign(1, initial);
+              if (not time_stepper.dense_update_u(
+                      make_not_null(&dense_output_values.front()), history,
+                      next_trigger)) {
+                // Need to take another time step
+                return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+              }
+            }
+            dense_output_index = 0;
+          }
           variables_restorer.save();
           db::mutate<variables_tag>(
-              [&dense_output_succeeded, &next_trigger](
-                  gsl::not_null<typename variables_tag::type*> vars,
-                  const TimeStepper& stepper,
-                  const typename history_tag::type& history) {
-                *vars = *history.complete_step_start().value;
-                dense_output_succeeded =
-                    stepper.dense_update_u(vars, history, next_trigger);
+              [&dense_output_values, &dense_output_index](
+                  gsl::not_null<typename variables_tag::type*> vars) {
+                *vars = dense_output_values[dense_output_index];
               },
-              make_not_null(&box),
-              db::get<::Tags::TimeStepper<TimeStepper>>(box),
-              db::get<history_tag>(box));
-          if (not dense_output_succeeded) {
-            // Need to take another time step
-            return {Parallel::AlgorithmExecution::Continue, std::nullopt};
-          }
+              make_not_null(&box));
 
           bool ready = true;
           tmpl::for_each<Postprocessors>([&](auto postprocessor_v) {
@@ -14,6 +14,7 @@
 #include "Domain/Structure/Side.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/OperatorCache.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -23,7 +24,6 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Numeric.hpp"  // IWYU pragma: keep
-#include "Utilities/StaticCache.hpp"
 
 namespace evolution::dg::subcell::fd {
 const Matrix& projection_matrix(
@@ -37,118 +37,19 @@ const Matrix& projection_matrix(
              subcell_quadrature == Spectral::Quadrature::CellCentered,
          "subcell_quadrature option in projection_matrix should be "
          "FaceCentered or CellCentered");
-  switch (dg_mesh.quadrature(0)) {
-    case Spectral::Quadrature::GaussLobatto: {
-      switch (subcell_quadrature) {
-        case Spectral::Quadrature::CellCentered: {
-          static const auto cache_gl = make_static_cache<
-              CacheRange<Spectral::minimum_number_of_points<
-                             Spectral::Basis::Legendre,
-                             Spectral::Quadrature::GaussLobatto>,
-                         Spectral::maximum_number_of_points<
-                             Spectral::Basis::Legendre> +
-                             1>,
-              CacheRange<Spectral::minimum_number_of_points<
-                             Spectral::Basis::FiniteDifference,
-                             Spectral::Quadrature::CellCentered>,
-                         Spectral::maximum_number_of_points<
-                             Spectral::Basis::FiniteDifference> +
-                             1>>([](const size_t local_num_dg_points,
-                                    const size_t local_num_fd_points) {
-            return Spectral::interpolation_matrix<
-                Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto>(
-                local_num_dg_points,
-                Spectral::collocation_points<
-                    Spectral::Basis::FiniteDifference,
-                    Spectral::Quadrature::CellCentered>(local_num_fd_points));
-          });
-          return cache_gl(dg_mesh.extents(0), subcell_extents);
-        }
-        case Spectral::Quadrature::FaceCentered: {
-          static const auto cache_gl = make_static_cache<
-              CacheRange<Spectral::minimum_number_of_points<
-                             Spectral::Basis::Legendre,
-                             Spectral::Quadrature::GaussLobatto>,
-                         Spectral::maximum_number_of_points<
-                             Spectral::Basis::Legendre> +
-                             1>,
-              CacheRange<Spectral::minimum_number_of_points<
-                             Spectral::Basis::FiniteDifference,
-                             Spectral::Quadrature::CellCentered>,
-                         Spectral::maximum_number_of_points<
-                             Spectral::Basis::FiniteDifference> +
-                             1>>([](const size_t local_num_dg_points,
-                                    const size_t local_num_fd_points) {
-            return Spectral::interpolation_matrix<
-                Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto>(
-                local_num_dg_points,
-                Spectral::collocation_points<
-                    Spectral::Basis::FiniteDifference,
-                    Spectral::Quadrature::FaceCentered>(local_num_fd_points));
-          });
-          return cache_gl(dg_mesh.extents(0), subcell_extents);
-        }
-        default:
-          ERROR("Unsupported quadrature type in FD subcell projection matrix");
-      }
-    }
-    case Spectral::Quadrature::Gauss: {
-      switch (subcell_quadrature) {
-        case Spectral::Quadrature::CellCentered: {
-          static const auto cache_g = make_static_cache<
-              CacheRange<
-                  Spectral::minimum_number_of_points<
-                      Spectral::Basis::Legendre, Spectral::Quadrature::Gauss>,
-                  Spectral::maximum_number_of_points<
-                      Spectral::Basis::Legendre> +
-                      1>,
-              CacheRange<Spectral::minimum_number_of_points<
-                             Spectral::Basis::FiniteDifference,
-                             Spectral::Quadrature::CellCentered>,
-                         Spectral::maximum_number_of_points<
-                             Spectral::Basis::FiniteDifference> +
-                             1>>([](const size_t local_num_dg_points,
-                                    const size_t local_num_fd_points) {
-            return Spectral::interpolation_matrix<Spectral::Basis::Legendre,
-                                                  Spectral::Quadrature::Gauss>(
-                local_num_dg_points,
-                Spectral::collocation_points<
-                    Spectral::Basis::FiniteDifference,
-                    Spectral::Quadrature::CellCentered>(local_num_fd_points));
-          });
-          return cache_g(dg_mesh.extents(0), subcell_extents);
-        }
-        case Spectral::Quadrature::FaceCentered: {
-          static const auto cache_g = make_static_cache<
-              CacheRange<
-                  Spectral::minimum_number_of_points<
-                      Spectral::Basis::Legendre, Spectral::Quadrature::Gauss>,
-                  Spectral::maximum_number_of_points<
-                      Spectral::Basis::Legendre> +
-                      1>,
-              CacheRange<Spectral::minimum_number_of_points<
+  ASSERT(dg_mesh.quadrature(0) == Spectral::Quadrature::Gauss or
+             dg_mesh.quadrature(0) == Spectral::Quadrature::GaussLobatto,
+         "Unsupported quadrature type in FD subcell projection matrix: "
+             << dg_mesh.quadrature(0));
+  const Mesh<1> subcell_mesh{subcell_extents,
                              Spectral::Basis::FiniteDifference,
-                             Spectral::Quadrature::CellCentered>,
-                         Spectral::maximum_number_of_points<
-                             Spectral::Basis::FiniteDifference> +
-                             1>>([](const size_t local_num_dg_points,
-                                    const size_t local_num_fd_points) {
-            return Spectral::interpolation_matrix<Spectral::Basis::Legendre,
-                                                  Spectral::Quadrature::Gauss>(
-                local_num_dg_points,
-                Spectral::collocation_points<
-                    Spectral::Basis::FiniteDifference,
-                    Spectral::Quadrature::FaceCentered>(local_num_fd_points));
-          });
-          return cache_g(dg_mesh.extents(0), subcell_extents);
-        }
-        default:
-          ERROR("Unsupported quadrature type in FD subcell projection matrix");
-      }
-    }
-    default:
-      ERROR("Unsupported quadrature type in FD subcell projection matrix");
-  };
+                             subcell_quadrature};
+  return Spectral::cached_operator(
+      {"SubcellProjection", dg_mesh, subcell_mesh},
+      [&dg_mesh, &subcell_mesh]() {
+        return Spectral::interpolation_matrix(
+            dg_mesh, Spectral::collocation_points(subcell_mesh));
+      });
 }
 
 namespace {
@@ -436,79 +337,32 @@ const Matrix& projection_matrix(const Mesh<1>& dg_mesh,
   ASSERT(ghost_zone_size <= max_ghost_zone_size and ghost_zone_size >= 2,
          "ghost_zone_size must be in [2, " << max_ghost_zone_size
                                            << " ] but got " << ghost_zone_size);
-  switch (dg_mesh.quadrature(0)) {
-    case Spectral::Quadrature::GaussLobatto: {
-      static const auto cache_gl = make_static_cache<
-          CacheRange<
-              Spectral::minimum_number_of_points<
-                  Spectral::Basis::Legendre,
-                  Spectral::Quadrature::GaussLobatto>,
-              Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
-                  1>,
-          CacheRange<Spectral::minimum_number_of_points<
-                         Spectral::Basis::FiniteDifference,
-                         Spectral::Quadrature::CellCentered>,
-                     Spectral::maximum_number_of_points<
-                         Spectral::Basis::FiniteDifference> +
-                         1>,
-          CacheRange<2_st, max_ghost_zone_size + 1>,
-          CacheEnumeration<Side, Side::Lower, Side::Upper>>(
-          [](const size_t local_num_dg_points, const size_t local_num_fd_points,
-             const size_t local_ghost_zone_size, const Side local_side) {
-            const DataVector& fd_points = Spectral::collocation_points<
-                Spectral::Basis::FiniteDifference,
-                Spectral::Quadrature::CellCentered>(local_num_fd_points);
-            DataVector target_points(local_ghost_zone_size);
-            for (size_t i = 0; i < local_ghost_zone_size; ++i) {
-              target_points[i] = fd_points[local_side == Side::Lower
-                                               ? i
-                                               : (local_num_fd_points -
-                                                  local_ghost_zone_size + i)];
-            }
-            return Spectral::interpolation_matrix<
-                Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto>(
-                local_num_dg_points, target_points);
-          });
-      return cache_gl(dg_mesh.extents(0), subcell_extents, ghost_zone_size,
-                      side);
-    }
-    case Spectral::Quadrature::Gauss: {
-      static const auto cache_g = make_static_cache<
-          CacheRange<
-              Spectral::minimum_number_of_points<Spectral::Basis::Legendre,
-                                                 Spectral::Quadrature::Gauss>,
-              Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
-                  1>,
-          CacheRange<Spectral::minimum_number_of_points<
-                         Spectral::Basis::FiniteDifference,
-                         Spectral::Quadrature::CellCentered>,
-                     Spectral::maximum_number_of_points<
-                         Spectral::Basis::FiniteDifference> +
-                         1>,
-          CacheRange<2_st, max_ghost_zone_size + 1>,
-          CacheEnumeration<Side, Side::Lower, Side::Upper>>(
-          [](const size_t local_num_dg_points, const size_t local_num_fd_points,
-             const size_t local_ghost_zone_size, const Side local_side) {
-            const DataVector& fd_points = Spectral::collocation_points<
-                Spectral::Basis::FiniteDifference,
-                Spectral::Quadrature::CellCentered>(local_num_fd_points);
-            DataVector target_points(local_ghost_zone_size);
-            for (size_t i = 0; i < local_ghost_zone_size; ++i) {
-              target_points[i] = fd_points[local_side == Side::Lower
-                                               ? i
-                                               : (local_num_fd_points -
-                                                  local_ghost_zone_size + i)];
-            }
-            return Spectral::interpolation_matrix<Spectral::Basis::Legendre,
-                                                  Spectral::Quadrature::Gauss>(
-                local_num_dg_points, target_points);
-          });
-      return cache_g(dg_mesh.extents(0), subcell_extents, ghost_zone_size,
-                     side);
-    }
-    default:
-      ERROR("Unsupported quadrature type in FD subcell projection matrix");
-  };
+  ASSERT(dg_mesh.quadrature(0) == Spectral::Quadrature::Gauss or
+             dg_mesh.quadrature(0) == Spectral::Quadrature::GaussLobatto,
+         "Unsupported quadrature type in FD subcell projection matrix: "
+             << dg_mesh.quadrature(0));
+  const Mesh<1> subcell_mesh{subcell_extents,
+                             Spectral::Basis::FiniteDifference,
+                             Spectral::Quadrature::CellCentered};
+  // Encode the ghost zone size and the side in the key's parameter
+  const size_t ghost_zone_parameter =
+      2 * ghost_zone_size + (side == Side::Upper ? 1 : 0);
+  return Spectral::cached_operator(
+      {"SubcellGhostZoneProjection", dg_mesh, subcell_mesh,
+       ghost_zone_parameter},
+      [&dg_mesh, &subcell_mesh, &ghost_zone_size, &side]() {
+        const size_t num_fd_points = subcell_mesh.extents(0);
+        const DataVector& fd_points =
+            Spectral::collocation_points(subcell_mesh);
+        DataVector target_points(ghost_zone_size);
+        for (size_t i = 0; i < ghost_zone_size; ++i) {
+          target_points[i] =
+              fd_points[side == Side::Lower
+                            ? i
+                            : (num_fd_points - ghost_zone_size + i)];
+        }
+        return Spectral::interpolation_matrix(dg_mesh, target_points);
+      });
 }
 
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
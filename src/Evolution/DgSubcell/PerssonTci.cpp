@@ -30,6 +30,14 @@ bool persson_tci_impl(const gsl::not_null<DataVector*> filtered_component,
              << component.size() << " grid points while the DG mesh has "
              << dg_mesh.number_of_grid_points() << " grid points.");
 
+  // The norm of the component is the same for all dimensions, so it is
+  // computed once. A vanishing component has no power in any mode and can't
+  // be troubled, so we skip applying the filters altogether.
+  const double component_norm_squared = sqrNorm(component);
+  if (component_norm_squared == 0.0) {
+    return false;
+  }
+
   const Matrix identity{};
   for (size_t d = 0; d < Dim; ++d) {
     auto matrices = make_array<Dim>(std::cref(identity));
@@ -75,11 +83,11 @@ bool persson_tci_impl(const gsl::not_null<DataVector*> filtered_component,
     // would be sufficient to stick to the case 2 for now.
     //
 
-    const double component_norm{l2Norm(component)};
-
-    if (pow(dg_mesh.extents(d) - num_highest_modes, alpha) *
-            l2Norm(*filtered_component) >
-        component_norm) {
+    // Both sides of the criterion are non-negative, so we compare the squared
+    // norms to avoid taking square roots.
+    if (pow(dg_mesh.extents(d) - num_highest_modes, 2.0 * alpha) *
+            sqrNorm(*filtered_component) >
+        component_norm_squared) {
       return true;
     }
   }
@@ -114,19 +114,21 @@ int rdmp_tci(const Variables<tmpl::list<EvolvedVarsTags...>>&
                  "If a cell has already been marked as troubled during the "
                  "RDMP TCI, we should not be continuing to check other "
                  "variables.");
-          const double max_active = max(active_var[tensor_storage_index]);
-          const double min_active = min(active_var[tensor_storage_index]);
-          const double max_inactive = max(inactive_var[tensor_storage_index]);
-          const double min_inactive = min(inactive_var[tensor_storage_index]);
           const double delta =
               max(rdmp_delta0,
                   rdmp_epsilon * (max_of_past_variables[component_index] -
                                   min_of_past_variables[component_index]));
+          const double upper_bound =
+              max_of_past_variables[component_index] + delta;
+          const double lower_bound =
+              min_of_past_variables[component_index] - delta;
+          // Check the active grid first since it usually has fewer points
+          // than the inactive grid, and stop at the first violated bound.
           cell_is_troubled =
-              max(max_active, max_inactive) >
-                  max_of_past_variables[component_index] + delta or
-              min(min_active, min_inactive) <
-                  min_of_past_variables[component_index] - delta;
+              max(active_var[tensor_storage_index]) > upper_bound or
+              min(active_var[tensor_storage_index]) < lower_bound or
+              max(inactive_var[tensor_storage_index]) > upper_bound or
+              min(inactive_var[tensor_storage_index]) < lower_bound;
           if (cell_is_troubled) {
             rdmp_tci_status = static_cast<int>(component_index + 1);
             return;
@@ -477,6 +477,9 @@ bool receive_boundary_data_local_time_stepping(
             // We don't yet communicate the integration order, because
             // we don't have any variable-order methods.  The
             // fixed-order methods ignore the field.
+            if constexpr (lts_boundary_history_in_single_precision_v<System>) {
+              neighbor_mortar_data.convert_to_single_precision();
+            }
             boundary_data_history->at(mortar_id).remote().insert(
                 mortar_next_time_step_id, std::numeric_limits<size_t>::max(),
                 std::move(neighbor_mortar_data));
@@ -734,6 +737,8 @@ struct ApplyBoundaryCorrections {
           Scalar<DataVector> face_det_jacobian{};
           Variables<mortar_tags_list> local_data_on_mortar{};
           Variables<mortar_tags_list> neighbor_data_on_mortar{};
+          DataVector local_single_precision_buffer{};
+          DataVector neighbor_single_precision_buffer{};
 
           for (auto& mortar_id_and_data : *mortar_data) {
             const auto& mortar_id = mortar_id_and_data.first;
@@ -758,8 +763,9 @@ struct ApplyBoundaryCorrections {
                 [&typed_boundary_correction, &direction, dg_formulation,
                  &dt_boundary_correction_on_mortar, &face_det_jacobian,
                  &face_mesh, &face_normal_covector_and_magnitude,
-                 &local_data_on_mortar, &mortar_id, &mortar_meshes,
-                 &mortar_sizes, &neighbor_data_on_mortar,
+                 &local_data_on_mortar, &local_single_precision_buffer,
+                 &mortar_id, &mortar_meshes, &mortar_sizes,
+                 &neighbor_data_on_mortar, &neighbor_single_precision_buffer,
                  using_gauss_lobatto_points, &volume_args_tuple,
                  &volume_det_jacobian, &volume_det_inv_jacobian,
                  &volume_dt_correction, &volume_mesh](
@@ -780,20 +786,21 @@ struct ApplyBoundaryCorrections {
 
               // Extract local and neighbor data, copy into Variables because
               // we store them in a std::vector for type erasure.
-              const std::pair<Mesh<volume_dim - 1>, DataVector>&
-                  local_mesh_and_data = *local_mortar_data.local_mortar_data();
-              const std::pair<Mesh<volume_dim - 1>, DataVector>&
-                  neighbor_mesh_and_data =
-                      *neighbor_mortar_data.neighbor_mortar_data();
+              // Data stored in single precision is converted into the
+              // buffers, which are reused for all mortars.
+              const DataVector& local_vars =
+                  local_mortar_data.local_mortar_vars(
+                      make_not_null(&local_single_precision_buffer));
+              const DataVector& neighbor_vars =
+                  neighbor_mortar_data.neighbor_mortar_vars(
+                      make_not_null(&neighbor_single_precision_buffer));
               local_data_on_mortar.set_data_ref(
                   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-                  const_cast<double*>(std::get<1>(local_mesh_and_data).data()),
-                  std::get<1>(local_mesh_and_data).size());
+                  const_cast<double*>(local_vars.data()), local_vars.size());
               neighbor_data_on_mortar.set_data_ref(
                   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-                  const_cast<double*>(
-                      std::get<1>(neighbor_mesh_and_data).data()),
-                  std::get<1>(neighbor_mesh_and_data).size());
+                  const_cast<double*>(neighbor_vars.data()),
+                  neighbor_vars.size());
 
               // The boundary computations and lifting can be further
               // optimized by in the h-refinement case having only one
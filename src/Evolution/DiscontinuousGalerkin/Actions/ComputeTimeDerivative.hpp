@@ -857,6 +857,10 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
                          << " because the unordered map has not been "
                             "initialized "
                             "to have the mortar id.");
+              if constexpr (lts_boundary_history_in_single_precision_v<
+                                EvolutionSystem>) {
+                mortar_data->at(mortar_id).convert_to_single_precision();
+              }
               boundary_data_history->at(mortar_id).local().insert(
                   time_step_id, integration_order,
                   std::move(mortar_data->at(mortar_id)));
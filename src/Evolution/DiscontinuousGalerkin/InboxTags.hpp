@@ -25,6 +25,7 @@
 #include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
 #include "Evolution/DiscontinuousGalerkin/Messages/BoundaryMessage.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/AtomicInbox.hpp"
 #include "Parallel/InboxInserters.hpp"
 #include "Parallel/StaticSpscQueue.hpp"
 #include "Time/TimeStepId.hpp"
@@ -131,8 +132,12 @@ struct BoundaryCorrectionAndGhostCellsInbox {
   // Used by nodegroup implementation
   using type_spsc = evolution::dg::AtomicInboxBoundaryData<Dim>;
 
-  // The actual type being used.
-  using type = type_map;
+  // The actual type being used. Elements of a nodegroup on the same node
+  // queue their data without locking the receiver's inbox, while array
+  // elements insert into the `type_map` directly.
+  using type =
+      Parallel::AtomicInbox<BoundaryCorrectionAndGhostCellsInbox, type_map,
+                            std::pair<DirectionalId<Dim>, stored_type>>;
   using value_type = type;
 
   template <typename ReceiveDataType>
@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Variables.hpp"    // IWYU pragma: keep
@@ -70,16 +71,24 @@ void reconstruct_from_weighted_sum(
   }
 
   // Update `local_weights` and `neighbor_weights` to hold the unnormalized
-  // nonlinear weights.
-  local_weight = unnormalized_nonlinear_weight(
-      local_weight,
-      oscillation_indicator(derivative_weight, *local_polynomial, mesh));
+  // nonlinear weights. The oscillation indicators of the local and all
+  // neighbor polynomials share the mesh, so they are computed together.
+  std::vector<const DataVector*> polynomials{};
+  polynomials.reserve(neighbor_polynomials.size() + 1);
+  polynomials.push_back(local_polynomial.get());
+  for (const auto& kv : neighbor_polynomials) {
+    polynomials.push_back(&kv.second);
+  }
+  std::vector<double> indicators{};
+  oscillation_indicators(make_not_null(&indicators), derivative_weight,
+                         polynomials, mesh);
+  local_weight = unnormalized_nonlinear_weight(local_weight, indicators[0]);
+  size_t neighbor_index = 1;
   for (const auto& kv : neighbor_polynomials) {
     const auto& key = kv.first;
-    const auto& neighbor_polynomial = kv.second;
     neighbor_weights[key] = unnormalized_nonlinear_weight(
-        neighbor_weights[key],
-        oscillation_indicator(derivative_weight, neighbor_polynomial, mesh));
+        neighbor_weights[key], indicators[neighbor_index]);
+    ++neighbor_index;
   }
 
   // Update `local_weights` and `neighbor_weights` to hold the normalized
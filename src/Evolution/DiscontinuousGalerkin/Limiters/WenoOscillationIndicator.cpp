@@ -3,20 +3,22 @@
 
 #include "Evolution/DiscontinuousGalerkin/Limiters/WenoOscillationIndicator.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/IndexIterator.hpp"  // IWYU pragma: keep
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/ModalVector.hpp"
-#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Blas.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -167,53 +169,125 @@ Matrix compute_indicator_matrix(
   return result;
 }
 
+// Compute the indicator matrix acting directly on the nodal values of the data.
+//
+// The indicator is the quadratic form c^T M c of the Legendre modes c with the
+// matrix M computed in `compute_indicator_matrix` (omitting the mean mode).
+// Writing the modes as c = T u, where u are the nodal values and T is the
+// tensor-product nodal-to-modal transformation, the indicator is u^T K u with
+// K = T^T M T. Precomputing K avoids transforming the data to modal
+// coefficients for each call, and allows evaluating the indicator for many
+// data vectors on the same mesh with a single matrix-matrix product.
+template <size_t VolumeDim>
+Matrix compute_nodal_indicator_matrix(
+    const Limiters::Weno_detail::DerivativeWeight derivative_weight,
+    const Spectral::Quadrature quadrature, const Index<VolumeDim>& extents) {
+  const size_t number_of_grid_points = extents.product();
+  const Matrix modal_indicator_matrix =
+      compute_indicator_matrix(derivative_weight, extents);
+
+  std::array<const Matrix*, VolumeDim> nodal_to_modal_1d{};
+  for (size_t dim = 0; dim < VolumeDim; ++dim) {
+    gsl::at(nodal_to_modal_1d, dim) =
+        &Spectral::nodal_to_modal_matrix(Mesh<1>{
+            extents[dim], Spectral::Basis::Legendre, quadrature});
+  }
+  // Rows of the tensor-product nodal-to-modal matrix for all modes except the
+  // mean mode, matching the offset indexing of the modal indicator matrix
+  Matrix nodal_to_modal(number_of_grid_points - 1, number_of_grid_points);
+  for (IndexIterator<VolumeDim> m(extents); m; ++m) {
+    if (m.collapsed_index() == 0) {
+      continue;
+    }
+    for (IndexIterator<VolumeDim> i(extents); i; ++i) {
+      double& entry =
+          nodal_to_modal(m.collapsed_index() - 1, i.collapsed_index());
+      entry = (*nodal_to_modal_1d[0])(m()[0], i()[0]);
+      for (size_t dim = 1; dim < VolumeDim; ++dim) {
+        entry *= (*gsl::at(nodal_to_modal_1d, dim))(m()[dim], i()[dim]);
+      }
+    }
+  }
+  return blaze::trans(nodal_to_modal) * modal_indicator_matrix *
+         nodal_to_modal;
+}
+
 // Helper function for caching a matrix that depends on the extents of a Mesh.
 // The helper handles converting from the extents (passed in as an Index) to a
 // series of integers (used to call into the StaticCache) and back to an Index
 // (used to compute the matrix).
 template <size_t VolumeDim>
-const Matrix& cached_indicator_matrix_from_mesh_index(
+const Matrix& cached_nodal_indicator_matrix(
     const Limiters::Weno_detail::DerivativeWeight derivative_weight,
-    const Index<VolumeDim>& extents) {
+    const Mesh<VolumeDim>& mesh) {
   using CacheEnumerationDerivativeWeight = CacheEnumeration<
       Limiters::Weno_detail::DerivativeWeight,
       Limiters::Weno_detail::DerivativeWeight::Unity,
       Limiters::Weno_detail::DerivativeWeight::PowTwoEll,
       Limiters::Weno_detail::DerivativeWeight::PowTwoEllOverEllFactorial>;
+  using CacheEnumerationQuadrature =
+      CacheEnumeration<Spectral::Quadrature, Spectral::Quadrature::Gauss,
+                       Spectral::Quadrature::GaussLobatto>;
   // Oscillation indicator needs at least two grid points
   constexpr size_t min = 2;
   constexpr size_t max =
       Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+  // The quadrature is the same in all dimensions, which is checked by the
+  // callers
+  const Spectral::Quadrature quadrature = mesh.quadrature(0);
+  const Index<VolumeDim>& extents = mesh.extents();
   if constexpr (VolumeDim == 1) {
-    const auto cache = make_static_cache<CacheEnumerationDerivativeWeight,
-                                         CacheRange<min, max>>(
-        [](const Limiters::Weno_detail::DerivativeWeight dw,
-           const size_t nx) -> Matrix {
-          return compute_indicator_matrix(dw, Index<1>(nx));
-        });
-    return cache(derivative_weight, extents[0]);
+    const auto cache =
+        make_static_cache<CacheEnumerationDerivativeWeight,
+                          CacheEnumerationQuadrature, CacheRange<min, max>>(
+            [](const Limiters::Weno_detail::DerivativeWeight dw,
+               const Spectral::Quadrature q, const size_t nx) -> Matrix {
+              return compute_nodal_indicator_matrix(dw, q, Index<1>(nx));
+            });
+    return cache(derivative_weight, quadrature, extents[0]);
   } else if constexpr (VolumeDim == 2) {
     const auto cache =
         make_static_cache<CacheEnumerationDerivativeWeight,
-                          CacheRange<min, max>, CacheRange<min, max>>(
+                          CacheEnumerationQuadrature, CacheRange<min, max>,
+                          CacheRange<min, max>>(
             [](const Limiters::Weno_detail::DerivativeWeight dw,
-               const size_t nx, const size_t ny) -> Matrix {
-              return compute_indicator_matrix(dw, Index<2>(nx, ny));
+               const Spectral::Quadrature q, const size_t nx,
+               const size_t ny) -> Matrix {
+              return compute_nodal_indicator_matrix(dw, q, Index<2>(nx, ny));
             });
-    return cache(derivative_weight, extents[0], extents[1]);
+    return cache(derivative_weight, quadrature, extents[0], extents[1]);
   } else {
     const auto cache =
         make_static_cache<CacheEnumerationDerivativeWeight,
-                          CacheRange<min, max>, CacheRange<min, max>,
-                          CacheRange<min, max>>(
+                          CacheEnumerationQuadrature, CacheRange<min, max>,
+                          CacheRange<min, max>, CacheRange<min, max>>(
             [](const Limiters::Weno_detail::DerivativeWeight dw,
-               const size_t nx, const size_t ny, const size_t nz) -> Matrix {
-              return compute_indicator_matrix(dw, Index<3>(nx, ny, nz));
+               const Spectral::Quadrature q, const size_t nx, const size_t ny,
+               const size_t nz) -> Matrix {
+              return compute_nodal_indicator_matrix(dw, q,
+                                                    Index<3>(nx, ny, nz));
             });
-    return cache(derivative_weight, extents[0], extents[1], extents[2]);
+    return cache(derivative_weight, quadrature, extents[0], extents[1],
+                 extents[2]);
   }
 }
 
+template <size_t VolumeDim>
+void assert_supported_mesh(const Mesh<VolumeDim>& mesh) {
+  ASSERT(mesh.basis() == make_array<VolumeDim>(Spectral::Basis::Legendre),
+         "Unsupported basis: " << mesh);
+  ASSERT(mesh.quadrature() ==
+                 make_array<VolumeDim>(Spectral::Quadrature::GaussLobatto) or
+             mesh.quadrature() ==
+                 make_array<VolumeDim>(Spectral::Quadrature::Gauss),
+         "Unsupported quadrature: " << mesh);
+  // The oscillation indicator is computed from the N>0 spectral modes of the
+  // input data, so we need at least two modes => at least two grid points.
+  ASSERT(*alg::min_element(mesh.extents().indices()) > 1,
+         "Unsupported extents: " << mesh);
+  (void)mesh;
+}
+
 }  // namespace
 
 namespace Limiters::Weno_detail {
@@ -235,42 +309,74 @@ template <size_t VolumeDim>
 double oscillation_indicator(const DerivativeWeight derivative_weight,
                              const DataVector& data,
                              const Mesh<VolumeDim>& mesh) {
-  ASSERT(mesh.basis() == make_array<VolumeDim>(Spectral::Basis::Legendre),
-         "Unsupported basis: " << mesh);
-  ASSERT(mesh.quadrature() ==
-                 make_array<VolumeDim>(Spectral::Quadrature::GaussLobatto) or
-             mesh.quadrature() ==
-                 make_array<VolumeDim>(Spectral::Quadrature::Gauss),
-         "Unsupported quadrature: " << mesh);
-  // The oscillation indicator is computed from the N>0 spectral modes of the
-  // input data, so we need at least two modes => at least two grid points.
-  ASSERT(*alg::min_element(mesh.extents().indices()) > 1,
-         "Unsupported extents: " << mesh);
-
-  const Matrix& indicator_matrix = cached_indicator_matrix_from_mesh_index(
-      derivative_weight, mesh.extents());
-  const ModalVector coeffs = to_modal_coefficients(data, mesh);
+  assert_supported_mesh(mesh);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  ASSERT(data.size() == number_of_grid_points,
+         "Data has size " << data.size() << ", but expected "
+                          << number_of_grid_points << " for mesh " << mesh);
+  const Matrix& indicator_matrix =
+      cached_nodal_indicator_matrix(derivative_weight, mesh);
 
+  // Evaluate u^T K u column by column. The columns of the column-major matrix
+  // are contiguous, and no temporary buffer is needed.
   double result = 0.;
-  // Note: because the 0'th modal coefficient encodes the mean of the data and
-  // does not contribute to the oscillation, it is safe to exclude it from the
-  // sum and start summing at m == 1, n == 1. Note also that the indicator
-  // matrix is computed excluding the m == 0, n == 0 elements, so the indexing
-  // is offset by 1.
-  for (size_t m = 1; m < mesh.number_of_grid_points(); ++m) {
-    for (size_t n = 1; n < mesh.number_of_grid_points(); ++n) {
-      result += coeffs[m] * coeffs[n] * indicator_matrix(m - 1, n - 1);
-    }
+  for (size_t j = 0; j < number_of_grid_points; ++j) {
+    result += data[j] * ddot_(number_of_grid_points,
+                              indicator_matrix.data() +
+                                  j * indicator_matrix.spacing(),
+                              1, data.data(), 1);
   }
   return result;
 }
 
+template <size_t VolumeDim>
+void oscillation_indicators(const gsl::not_null<std::vector<double>*> result,
+                            const DerivativeWeight derivative_weight,
+                            const std::vector<const DataVector*>& data,
+                            const Mesh<VolumeDim>& mesh) {
+  assert_supported_mesh(mesh);
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const size_t number_of_vectors = data.size();
+  result->resize(number_of_vectors);
+  if (number_of_vectors == 0) {
+    return;
+  }
+  const Matrix& indicator_matrix =
+      cached_nodal_indicator_matrix(derivative_weight, mesh);
+
+  // Stack the data as the columns of a matrix U and compute all quadratic
+  // forms u_i^T K u_i from the diagonal of U^T K U with a single
+  // matrix-matrix product.
+  Matrix stacked_data(number_of_grid_points, number_of_vectors);
+  for (size_t i = 0; i < number_of_vectors; ++i) {
+    ASSERT(data[i]->size() == number_of_grid_points,
+           "Data " << i << " has size " << data[i]->size() << ", but expected "
+                   << number_of_grid_points << " for mesh " << mesh);
+    std::copy(data[i]->begin(), data[i]->end(),
+              stacked_data.data() + i * stacked_data.spacing());
+  }
+  Matrix product(number_of_grid_points, number_of_vectors);
+  dgemm_<true>('N', 'N', number_of_grid_points, number_of_vectors,
+               number_of_grid_points, 1., indicator_matrix.data(),
+               indicator_matrix.spacing(), stacked_data.data(),
+               stacked_data.spacing(), 0., product.data(), product.spacing());
+  for (size_t i = 0; i < number_of_vectors; ++i) {
+    (*result)[i] =
+        ddot_(number_of_grid_points,
+              stacked_data.data() + i * stacked_data.spacing(), 1,
+              product.data() + i * product.spacing(), 1);
+  }
+}
+
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATE(_, data)                        \
-  template double oscillation_indicator<DIM(data)>( \
-      DerivativeWeight, const DataVector&, const Mesh<DIM(data)>&);
+#define INSTANTIATE(_, data)                                             \
+  template double oscillation_indicator<DIM(data)>(                      \
+      DerivativeWeight, const DataVector&, const Mesh<DIM(data)>&);      \
+  template void oscillation_indicators<DIM(data)>(                       \
+      gsl::not_null<std::vector<double>*>, DerivativeWeight,             \
+      const std::vector<const DataVector*>&, const Mesh<DIM(data)>&);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
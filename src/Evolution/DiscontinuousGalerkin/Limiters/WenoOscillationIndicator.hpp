@@ -5,6 +5,9 @@
 
 #include <cstddef>
 #include <ostream>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
 
 /// \cond
 class DataVector;
@@ -37,9 +40,25 @@ std::ostream& operator<<(std::ostream& os, DerivativeWeight derivative_weight);
 // indicator because it is formulated in the reference coordinates, which we
 // use for the WENO reconstruction, and because it lends itself to an efficient
 // implementation.
+//
+// The indicator is evaluated as a quadratic form of the nodal data with a
+// matrix that is precomputed once per DerivativeWeight and Mesh, so no
+// transformation to modal coefficients is needed for each call.
 template <size_t VolumeDim>
 double oscillation_indicator(DerivativeWeight derivative_weight,
                              const DataVector& data,
                              const Mesh<VolumeDim>& mesh);
 
+// Compute the WENO oscillation indicator for each of the `data` on the same
+// mesh, e.g. for the local and all neighbor polynomials of a WENO
+// reconstruction, or for many elements with the same mesh.
+//
+// All indicators are evaluated with a single matrix-matrix product, which is
+// more efficient than calling `oscillation_indicator` for each of the `data`.
+template <size_t VolumeDim>
+void oscillation_indicators(gsl::not_null<std::vector<double>*> result,
+                            DerivativeWeight derivative_weight,
+                            const std::vector<const DataVector*>& data,
+                            const Mesh<VolumeDim>& mesh);
+
 }  // namespace Limiters::Weno_detail
@@ -3,6 +3,7 @@
 
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <ostream>
@@ -18,6 +19,7 @@
 #include "Time/TimeStepId.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 
 namespace evolution::dg {
@@ -27,9 +29,28 @@ MortarData<Dim>::MortarData(const size_t number_of_buffers)
   time_step_id_.resize(number_of_buffers_);
   local_mortar_data_.resize(number_of_buffers_);
   neighbor_mortar_data_.resize(number_of_buffers_);
+  single_precision_local_vars_.resize(number_of_buffers_);
+  single_precision_neighbor_vars_.resize(number_of_buffers_);
   mortar_index_ = 0;
 }
 
+namespace {
+void convert_to_float(const gsl::not_null<std::vector<float>*> result,
+                      const gsl::not_null<DataVector*> vars) {
+  result->resize(vars->size());
+  std::transform(vars->begin(), vars->end(), result->begin(),
+                 [](const double value) { return static_cast<float>(value); });
+  *vars = DataVector{};
+}
+
+const DataVector& convert_to_double(const gsl::not_null<DataVector*> buffer,
+                                    const std::vector<float>& vars) {
+  buffer->destructive_resize(vars.size());
+  std::copy(vars.begin(), vars.end(), buffer->begin());
+  return *buffer;
+}
+}  // namespace
+
 template <size_t Dim>
 void MortarData<Dim>::insert_local_mortar_data(
     TimeStepId time_step_id, Mesh<Dim - 1> local_interface_mesh,
@@ -49,6 +70,7 @@ void MortarData<Dim>::insert_local_mortar_data(
   time_step_id_[mortar_index_] = std::move(time_step_id);
   local_mortar_data_[mortar_index_] =
       std::pair{std::move(local_interface_mesh), std::move(local_mortar_vars)};
+  single_precision_local_vars_[mortar_index_].clear();
 }
 
 template <size_t Dim>
@@ -70,6 +92,7 @@ void MortarData<Dim>::insert_neighbor_mortar_data(
   time_step_id_[mortar_index_] = std::move(time_step_id);
   neighbor_mortar_data_[mortar_index_] = std::pair{
       std::move(neighbor_interface_mesh), std::move(neighbor_mortar_vars)};
+  single_precision_neighbor_vars_[mortar_index_].clear();
 }
 
 template <size_t Dim>
@@ -215,6 +238,51 @@ void MortarData<Dim>::get_local_face_normal_magnitude(
           num_face_points);
 }
 
+template <size_t Dim>
+void MortarData<Dim>::convert_to_single_precision() {
+  if (local_mortar_data_[mortar_index_].has_value() and
+      single_precision_local_vars_[mortar_index_].empty()) {
+    convert_to_float(
+        make_not_null(&single_precision_local_vars_[mortar_index_]),
+        make_not_null(&local_mortar_data_[mortar_index_]->second));
+  }
+  if (neighbor_mortar_data_[mortar_index_].has_value() and
+      single_precision_neighbor_vars_[mortar_index_].empty()) {
+    convert_to_float(
+        make_not_null(&single_precision_neighbor_vars_[mortar_index_]),
+        make_not_null(&neighbor_mortar_data_[mortar_index_]->second));
+  }
+}
+
+template <size_t Dim>
+bool MortarData<Dim>::stored_in_single_precision() const {
+  return not single_precision_local_vars_[mortar_index_].empty() or
+         not single_precision_neighbor_vars_[mortar_index_].empty();
+}
+
+template <size_t Dim>
+const DataVector& MortarData<Dim>::local_mortar_vars(
+    const gsl::not_null<DataVector*> buffer) const {
+  ASSERT(local_mortar_data_[mortar_index_].has_value(),
+         "The local mortar data has not been set.");
+  if (single_precision_local_vars_[mortar_index_].empty()) {
+    return local_mortar_data_[mortar_index_]->second;
+  }
+  return convert_to_double(buffer, single_precision_local_vars_[mortar_index_]);
+}
+
+template <size_t Dim>
+const DataVector& MortarData<Dim>::neighbor_mortar_vars(
+    const gsl::not_null<DataVector*> buffer) const {
+  ASSERT(neighbor_mortar_data_[mortar_index_].has_value(),
+         "The neighbor mortar data has not been set.");
+  if (single_precision_neighbor_vars_[mortar_index_].empty()) {
+    return neighbor_mortar_data_[mortar_index_]->second;
+  }
+  return convert_to_double(buffer,
+                           single_precision_neighbor_vars_[mortar_index_]);
+}
+
 template <size_t Dim>
 std::pair<std::pair<Mesh<Dim - 1>, DataVector>,
           std::pair<Mesh<Dim - 1>, DataVector>>
@@ -230,6 +298,16 @@ MortarData<Dim>::extract() {
           << " data.");
   auto result = std::pair{std::move(*local_mortar_data_[mortar_index_]),
                           std::move(*neighbor_mortar_data_[mortar_index_])};
+  if (not single_precision_local_vars_[mortar_index_].empty()) {
+    convert_to_double(make_not_null(&result.first.second),
+                      single_precision_local_vars_[mortar_index_]);
+    single_precision_local_vars_[mortar_index_].clear();
+  }
+  if (not single_precision_neighbor_vars_[mortar_index_].empty()) {
+    convert_to_double(make_not_null(&result.second.second),
+                      single_precision_neighbor_vars_[mortar_index_]);
+    single_precision_neighbor_vars_[mortar_index_].clear();
+  }
   local_mortar_data_[mortar_index_].reset();
   neighbor_mortar_data_[mortar_index_].reset();
   return result;
@@ -258,6 +336,8 @@ void MortarData<Dim>::pup(PUP::er& p) {
   p | time_step_id_;
   p | local_mortar_data_;
   p | neighbor_mortar_data_;
+  p | single_precision_local_vars_;
+  p | single_precision_neighbor_vars_;
   p | local_geometric_quantities_;
   p | using_volume_and_face_jacobians_;
   p | using_only_face_normal_magnitude_;
@@ -281,6 +361,10 @@ bool operator==(const MortarData<Dim>& lhs, const MortarData<Dim>& rhs) {
          lhs.time_step_id() == rhs.time_step_id() and
          lhs.local_mortar_data() == rhs.local_mortar_data() and
          lhs.neighbor_mortar_data() == rhs.neighbor_mortar_data() and
+         lhs.single_precision_local_vars_[lhs.mortar_index_] ==
+             rhs.single_precision_local_vars_[rhs.mortar_index_] and
+         lhs.single_precision_neighbor_vars_[lhs.mortar_index_] ==
+             rhs.single_precision_neighbor_vars_[rhs.mortar_index_] and
          lhs.local_geometric_quantities_ == rhs.local_geometric_quantities_ and
          lhs.using_volume_and_face_jacobians_ ==
              rhs.using_volume_and_face_jacobians_ and
@@ -9,6 +9,7 @@
 #include <pup.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -16,8 +17,27 @@
 #include "Time/TimeStepId.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace evolution::dg {
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(
+    lts_boundary_history_in_single_precision)
+}  // namespace detail
+
+/*!
+ * \brief Whether the local time stepping boundary history of the `System`
+ * stores the mortar data in single precision.
+ *
+ * Systems opt in by defining
+ * `static constexpr bool lts_boundary_history_in_single_precision = true;`.
+ * See `evolution::dg::MortarData::convert_to_single_precision()`.
+ */
+template <typename System>
+constexpr bool lts_boundary_history_in_single_precision_v =
+    detail::get_lts_boundary_history_in_single_precision_or_default_v<System,
+                                                                      false>;
+
 /*!
  * \brief Data on the mortar used to compute the boundary correction for the
  * DG scheme.
@@ -141,6 +161,39 @@ class MortarData {
   void get_local_face_normal_magnitude(
       gsl::not_null<Scalar<DataVector>*> local_face_normal_magnitude) const;
 
+  /*!
+   * \brief Store the local and neighbor mortar data of the current buffer in
+   * single precision, releasing the double-precision storage.
+   *
+   * This halves the memory needed for the mortar data. It is intended for the
+   * long boundary histories kept for local time stepping, where the mortar
+   * data of many past steps is stored on every element. The geometric
+   * quantities are kept in double precision.
+   *
+   * After conversion the `DataVector`s held by `local_mortar_data()` and
+   * `neighbor_mortar_data()` are empty (the meshes are still available), so
+   * the data must be retrieved with `local_mortar_vars()` and
+   * `neighbor_mortar_vars()`.
+   */
+  void convert_to_single_precision();
+
+  /// Whether the mortar data of the current buffer is stored in single
+  /// precision
+  bool stored_in_single_precision() const;
+
+  /*!
+   * \brief The local (neighbor) mortar data of the current buffer.
+   *
+   * If the data is stored in double precision a reference to it is returned
+   * and the `buffer` is not used. Otherwise the data is converted to double
+   * precision into the `buffer` and a reference to the `buffer` is returned.
+   */
+  /// @{
+  const DataVector& local_mortar_vars(gsl::not_null<DataVector*> buffer) const;
+  const DataVector& neighbor_mortar_vars(
+      gsl::not_null<DataVector*> buffer) const;
+  /// @}
+
   /// Return the inserted data and reset the state to empty.
   ///
   /// The first element is the local data while the second element is the
@@ -199,6 +252,10 @@ class MortarData {
   std::vector<TimeStepId> time_step_id_{};
   std::vector<MortarType> local_mortar_data_{};
   std::vector<MortarType> neighbor_mortar_data_{};
+  // Single-precision copies of the mortar data for each buffer. Empty unless
+  // `convert_to_single_precision()` was called for the buffer.
+  std::vector<std::vector<float>> single_precision_local_vars_{};
+  std::vector<std::vector<float>> single_precision_neighbor_vars_{};
   size_t mortar_index_{0};
   DataVector local_geometric_quantities_{};
   bool using_volume_and_face_jacobians_{false};
@@ -55,6 +55,12 @@ using ForwardTuple = tmpl::wrap<
 /// variables used for the explicit portion of the time derivative,
 /// which may still undergo variable-fixing-like corrections.
 ///
+/// In `imex::Mode::Implicit`, each point is first solved with a
+/// Newton-Raphson iteration on fixed-size arrays, which does not
+/// allocate.  Points where that fails are retried with
+/// `RootFinder::gsl_multiroot` before counting as a failure of the
+/// solve attempt.
+///
 /// \warning
 /// This will use the value of `::Tags::Time` from the DataBox.  Most
 /// of the time, the value appropriate for evaluating the explicit RHS
@@ -6,9 +6,11 @@
 #include "Evolution/Imex/SolveImplicitSector.hpp"
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -17,7 +19,6 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/ExtractPoint.hpp"
-#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -25,7 +26,6 @@
 #include "Evolution/Imex/Mode.hpp"
 #include "Evolution/Imex/Protocols/ImplicitSector.hpp"
 #include "Evolution/Imex/Tags/Jacobian.hpp"
-#include "NumericalAlgorithms/LinearSolver/Lapack.hpp"
 #include "NumericalAlgorithms/RootFinding/GslMultiRoot.hpp"
 #include "Time/History.hpp"
 #include "Time/TimeSteppers/ImexTimeStepper.hpp"
@@ -122,6 +122,121 @@ class ImplicitEquation {
   std::vector<GuessResult> initial_guess_types_{};
 };
 
+// Solves the linear system `matrix * x = rhs` in place using
+// Gaussian elimination with partial pivoting, leaving the solution
+// in `rhs`.  The matrix is stored as an array of rows.  Returns false
+// if the matrix is singular.
+//
+// The sector dimension is known at compile time, so this performs no
+// allocations, unlike the LAPACK and GSL routines that operate on
+// dynamically sized matrices.
+template <size_t Dim>
+bool fixed_size_linear_solve(
+    const gsl::not_null<std::array<std::array<double, Dim>, Dim>*> matrix,
+    const gsl::not_null<std::array<double, Dim>*> rhs) {
+  auto& a = *matrix;
+  auto& b = *rhs;
+  for (size_t column = 0; column < Dim; ++column) {
+    size_t pivot_row = column;
+    for (size_t row = column + 1; row < Dim; ++row) {
+      if (std::abs(gsl::at(gsl::at(a, row), column)) >
+          std::abs(gsl::at(gsl::at(a, pivot_row), column))) {
+        pivot_row = row;
+      }
+    }
+    if (gsl::at(gsl::at(a, pivot_row), column) == 0.0) {
+      return false;
+    }
+    if (pivot_row != column) {
+      std::swap(gsl::at(a, pivot_row), gsl::at(a, column));
+      std::swap(gsl::at(b, pivot_row), gsl::at(b, column));
+    }
+    const auto& pivot_row_values = gsl::at(a, column);
+    for (size_t row = column + 1; row < Dim; ++row) {
+      auto& row_values = gsl::at(a, row);
+      const double factor =
+          gsl::at(row_values, column) / gsl::at(pivot_row_values, column);
+      if (factor == 0.0) {
+        continue;
+      }
+      for (size_t i = column + 1; i < Dim; ++i) {
+        gsl::at(row_values, i) -= factor * gsl::at(pivot_row_values, i);
+      }
+      gsl::at(b, row) -= factor * gsl::at(b, column);
+    }
+  }
+  for (size_t row = Dim; row-- > 0;) {
+    const auto& row_values = gsl::at(a, row);
+    for (size_t i = row + 1; i < Dim; ++i) {
+      gsl::at(b, row) -= gsl::at(row_values, i) * gsl::at(b, i);
+    }
+    gsl::at(b, row) /= gsl::at(row_values, row);
+  }
+  return true;
+}
+
+// The norm used by gsl_multiroot_test_residual, so that the native
+// solver and the GSL fallback agree on what a converged solution is.
+template <size_t Dim>
+double residual_norm(const std::array<double, Dim>& residual) {
+  double norm = 0.0;
+  for (const double component : residual) {
+    norm += std::abs(component);
+  }
+  return norm;
+}
+
+// Newton-Raphson iteration with a backtracking line search on the
+// residual norm.  Returns false if the iteration did not converge to
+// `tolerance` in `maximum_iterations` iterations, the jacobian was
+// singular, or the line search failed to reduce the residual, in
+// which case the caller should fall back to a more robust solver.
+// The `solver` is called with the same interface as for
+// RootFinder::gsl_multiroot.
+//
+// The residual is always evaluated before the jacobian at the same
+// point, so any preparation shared between the two calculations is
+// only done once per iteration.
+template <size_t Dim, typename Solver>
+bool fixed_size_newton_solve(const gsl::not_null<std::array<double, Dim>*> x,
+                             const Solver& solver, const double tolerance,
+                             const size_t maximum_iterations) {
+  constexpr size_t maximum_step_reductions = 10;
+  std::array<double, Dim> residual = solver(*x);
+  double norm = residual_norm(residual);
+  for (size_t iteration = 0;; ++iteration) {
+    if (norm < tolerance) {
+      return true;
+    }
+    if (iteration == maximum_iterations or not std::isfinite(norm)) {
+      return false;
+    }
+    std::array<std::array<double, Dim>, Dim> jacobian = solver.jacobian(*x);
+    std::array<double, Dim> step = -residual;
+    if (not fixed_size_linear_solve(make_not_null(&jacobian),
+                                    make_not_null(&step))) {
+      return false;
+    }
+    std::array<double, Dim> trial_x = *x + step;
+    std::array<double, Dim> trial_residual = solver(trial_x);
+    double trial_norm = residual_norm(trial_residual);
+    for (size_t reduction = 0;
+         not(trial_norm < norm) and reduction < maximum_step_reductions;
+         ++reduction) {
+      step *= 0.5;
+      trial_x = *x + step;
+      trial_residual = solver(trial_x);
+      trial_norm = residual_norm(trial_residual);
+    }
+    if (not(trial_norm < norm)) {
+      return false;
+    }
+    *x = trial_x;
+    residual = trial_residual;
+    norm = trial_norm;
+  }
+}
+
 // Calculates the residual and jacobian for the ImplicitEquation
 // pointwise, using the source from the SolveAttempt.  This involved
 // setting up a local DataBox for the tags specified in the
@@ -427,10 +542,6 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
   }
 
   const size_t number_of_grid_points = get(*solve_failures).size();
-  // Only allocated if used.
-  Matrix semi_implicit_jacobian_matrix{};
-  // Only allocated if used.
-  std::vector<int> lapack_scratch{};
 
   bool solve_succeeded = false;
   tmpl::for_each<
@@ -479,6 +590,17 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
       }
       switch (implicit_solve_mode) {
         case Mode::Implicit: {
+          // Try a plain Newton solve first, as it is much cheaper
+          // than the GSL solver for the small systems typical of
+          // implicit sectors.  If it fails, retry from the initial
+          // guess with the globally convergent GSL hybrid method.
+          const size_t max_newton_iterations = 20;
+          pointwise_vars_array = initial_guess;
+          if (solve_implicit_sector_detail::fixed_size_newton_solve(
+                  make_not_null(&pointwise_vars_array), solver,
+                  implicit_solve_tolerance, max_newton_iterations)) {
+            break;
+          }
           const size_t max_iterations = 100;
           try {
             pointwise_vars_array = RootFinder::gsl_multiroot(
@@ -499,32 +621,19 @@ void SolveImplicitSector<SystemVariablesTag, ImplicitSector>::apply_impl(
         }
         case Mode::SemiImplicit: {
           std::array<double, solve_dimension> correction_array =
-              solver(initial_guess);
-          DataVector correction(correction_array.data(),
-                                correction_array.size());
-          correction *= -1.0;
-          const std::array<std::array<double, solve_dimension>, solve_dimension>
+              -solver(initial_guess);
+          std::array<std::array<double, solve_dimension>, solve_dimension>
               semi_implicit_jacobian = solver.jacobian(initial_guess);
-          // Copy into the dynamically allocated Matrix required by
-          // the LAPACK wrapper.
-          semi_implicit_jacobian_matrix = semi_implicit_jacobian;
-          // Allocate scratch buffer (storing pivots from the
-          // decomposition).  This does nothing after the first point.
-          lapack_scratch.resize(solve_dimension);
-          const int lapack_info = lapack::general_matrix_linear_solve(
-              &correction, &lapack_scratch, &semi_implicit_jacobian_matrix);
-          if (lapack_info != 0) {
-            if (lapack_info < 0) {
-              ERROR("LAPACK invalid argument: " << -lapack_info);
+          if (not solve_implicit_sector_detail::fixed_size_linear_solve(
+                  make_not_null(&semi_implicit_jacobian),
+                  make_not_null(&correction_array))) {
+            if constexpr (have_fallback) {
+              ++get(*solve_failures)[point];
+              solve_succeeded = false;
+              continue;
             } else {
-              if constexpr (have_fallback) {
-                ++get(*solve_failures)[point];
-                solve_succeeded = false;
-                continue;
-              } else {
-                ERROR("Semi-implicit inversion was singular at\n"
-                      << pointwise_vars);
-              }
+              ERROR("Semi-implicit inversion was singular at\n"
+                    << pointwise_vars);
             }
           }
           pointwise_vars_array = initial_guess + correction_array;
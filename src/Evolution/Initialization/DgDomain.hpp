@@ -126,8 +126,11 @@ struct Domain {
                                             Frame::Inertial>,
       ::domain::Tags::InertialMeshVelocityCompute<Dim>,
       evolution::domain::Tags::DivMeshVelocityCompute<Dim>,
-      // Compute tags for other mesh quantities
-      ::domain::Tags::MinimumGridSpacingCompute<Dim, Frame::Inertial>>;
+      // Compute tags for other mesh quantities. The grid-frame spacing only
+      // changes with the mesh and is rescaled to the inertial frame where
+      // possible.
+      ::domain::Tags::MinimumGridSpacingCompute<Dim, Frame::Grid>,
+      ::domain::Tags::MinimumGridSpacingFromGridCompute<Dim>>;
 
   /// Given the items fetched from a DataBox by the argument_tags, mutate
   /// the items in the DataBox corresponding to return_tags
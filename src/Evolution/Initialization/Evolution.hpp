@@ -332,6 +332,8 @@ struct ProjectTimeStepperHistory : tt::ConformsTo<amr::protocols::Projector> {
     }
     const auto projection_matrices =
         Spectral::p_projection_matrices(old_mesh, new_mesh);
+    // Each entry is projected on its own. Batching the entries would need
+    // buffers the size of the whole history.
     const auto& old_extents = old_mesh.extents();
     history->map_entries(
         [&projection_matrices, &old_extents](const auto entry) {
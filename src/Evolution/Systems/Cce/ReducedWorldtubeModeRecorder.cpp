@@ -4,18 +4,19 @@
 #include "Evolution/Systems/Cce/ReducedWorldtubeModeRecorder.hpp"
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/ComplexModalVector.hpp"
 #include "IO/H5/Dat.hpp"
 #include "IO/H5/File.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ForceInline.hpp"
 
 namespace Cce {
-
-void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
-    const std::string& dataset_path, const double time,
-    const ComplexModalVector& modes, const size_t l_max, const bool is_real) {
+namespace {
+std::vector<std::string> mode_data_legend(const size_t l_max,
+                                          const bool is_real) {
   std::vector<std::string> legend;
   const size_t output_size = square(l_max + 1);
   legend.reserve(is_real ? output_size + 1 : 2 * output_size + 1);
@@ -30,8 +31,13 @@ void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
       }
     }
   }
-  auto& output_mode_dataset =
-      output_file_.try_insert<h5::Dat>(dataset_path, legend, 0);
+  return legend;
+}
+
+std::vector<double> mode_data_row(const double time,
+                                  const ComplexModalVector& modes,
+                                  const size_t l_max, const bool is_real) {
+  const size_t output_size = square(l_max + 1);
   std::vector<double> data_to_write;
   if (is_real) {
     data_to_write.resize(output_size + 1);
@@ -73,6 +79,37 @@ void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
       }
     }
   }
+  return data_to_write;
+}
+}  // namespace
+
+void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
+    const std::string& dataset_path, const double time,
+    const ComplexModalVector& modes, const size_t l_max, const bool is_real) {
+  auto& output_mode_dataset = output_file_.try_insert<h5::Dat>(
+      dataset_path, mode_data_legend(l_max, is_real), 0);
+  output_mode_dataset.append(mode_data_row(time, modes, l_max, is_real));
+  output_file_.close_current_object();
+}
+
+void ReducedWorldtubeModeRecorder::append_worldtube_mode_data(
+    const std::string& dataset_path, const std::vector<double>& times,
+    const std::vector<ComplexModalVector>& modes, const size_t l_max,
+    const bool is_real) {
+  ASSERT(times.size() == modes.size(),
+         "The number of times (" << times.size()
+                                 << ") must match the number of mode sets ("
+                                 << modes.size() << ")");
+  if (times.empty()) {
+    return;
+  }
+  std::vector<std::vector<double>> data_to_write;
+  data_to_write.reserve(times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    data_to_write.push_back(mode_data_row(times[i], modes[i], l_max, is_real));
+  }
+  auto& output_mode_dataset = output_file_.try_insert<h5::Dat>(
+      dataset_path, mode_data_legend(l_max, is_real), 0);
   output_mode_dataset.append(data_to_write);
   output_file_.close_current_object();
 }
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "Evolution/Systems/Cce/Tags.hpp"
 #include "IO/H5/File.hpp"
@@ -93,6 +94,14 @@ struct ReducedWorldtubeModeRecorder {
                                   const ComplexModalVector& modes, size_t l_max,
                                   bool is_real = false);
 
+  /// append to `dataset_path` one row for each of the `times`, with the
+  /// corresponding entry of `modes` in the same format as the single-time
+  /// overload. All rows are written with a single H5 append.
+  void append_worldtube_mode_data(const std::string& dataset_path,
+                                  const std::vector<double>& times,
+                                  const std::vector<ComplexModalVector>& modes,
+                                  size_t l_max, bool is_real = false);
+
  private:
   h5::H5File<h5::AccessType::ReadWrite> output_file_;
 };
@@ -1,9 +1,15 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <algorithm>
+#include <array>
 #include <boost/program_options.hpp>
+#include <complex>
 #include <cstddef>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -20,6 +26,7 @@
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/TMPL.hpp"
 
 // Charm looks for this function but since we build without a main function or
@@ -148,12 +155,175 @@ void slice_buffers_to_libsharp_modes(
   }
 }
 
+using reduced_boundary_tags =
+    tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
+               Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
+               Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
+
+constexpr size_t number_of_reduced_tags = tmpl::size<reduced_boundary_tags>{};
+
+// The reduced modes of a block of consecutive time slices, stored separately
+// for each tag so that each dataset can be written with a single append.
+struct ReducedBlock {
+  std::vector<double> times;
+  std::array<std::vector<ComplexModalVector>, number_of_reduced_tags> modes;
+};
+
+// The scratch memory used by a single thread to reduce one time slice at a
+// time.
+struct ReductionWorkspace {
+  explicit ReductionWorkspace(const size_t computation_l_max)
+      : coefficients_set{Spectral::Swsh::size_of_libsharp_coefficient_vector(
+            computation_l_max)},
+        boundary_data_variables{
+            Spectral::Swsh::number_of_swsh_collocation_points(
+                computation_l_max)},
+        output_goldberg_mode_buffer{square(computation_l_max + 1)},
+        output_libsharp_mode_buffer{
+            Spectral::Swsh::size_of_libsharp_coefficient_vector(
+                computation_l_max)} {}
+
+  static size_t size_in_bytes(const size_t computation_l_max) {
+    return sizeof(std::complex<double>) *
+           (Variables<Cce::cce_metric_input_tags>::
+                    number_of_independent_components *
+                Spectral::Swsh::size_of_libsharp_coefficient_vector(
+                    computation_l_max) +
+            Variables<Cce::Tags::characteristic_worldtube_boundary_tags<
+                Cce::Tags::BoundaryValue>>::number_of_independent_components *
+                Spectral::Swsh::number_of_swsh_collocation_points(
+                    computation_l_max) +
+            square(computation_l_max + 1) +
+            Spectral::Swsh::size_of_libsharp_coefficient_vector(
+                computation_l_max));
+  }
+
+  Variables<Cce::cce_metric_input_tags> coefficients_set;
+  Variables<Cce::Tags::characteristic_worldtube_boundary_tags<
+      Cce::Tags::BoundaryValue>>
+      boundary_data_variables;
+  ComplexModalVector output_goldberg_mode_buffer;
+  ComplexModalVector output_libsharp_mode_buffer;
+};
+
+// Perform the boundary computation for the time slice at `buffer_time_offset`
+// in the `coefficients_buffers` and store the reduced modes of each tag in
+// entry `block_offset` of the `block`. Only the `workspace` and the
+// `block_offset` entries of the `block` are modified, so different time slices
+// may be reduced concurrently.
+void reduce_time_slice(
+    const gsl::not_null<ReductionWorkspace*> workspace,
+    const gsl::not_null<ReducedBlock*> block, const size_t block_offset,
+    const Variables<Cce::cce_metric_input_tags>& coefficients_buffers,
+    const size_t time_span, const size_t buffer_time_offset,
+    const size_t l_max, const size_t computation_l_max,
+    const double extraction_radius, const bool apply_normalization_fix) {
+  auto& coefficients_set = workspace->coefficients_set;
+  slice_buffers_to_libsharp_modes(make_not_null(&coefficients_set),
+                                  coefficients_buffers, time_span,
+                                  buffer_time_offset, l_max, computation_l_max);
+
+  if (apply_normalization_fix) {
+    Cce::create_bondi_boundary_data_from_unnormalized_spec_modes(
+        make_not_null(&workspace->boundary_data_variables),
+        get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
+            coefficients_set),
+        get<Cce::Tags::detail::Shift>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Lapse>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(coefficients_set),
+        extraction_radius, computation_l_max);
+  } else {
+    Cce::create_bondi_boundary_data(
+        make_not_null(&workspace->boundary_data_variables),
+        get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
+            coefficients_set),
+        get<Cce::Tags::detail::Shift>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(coefficients_set),
+        get<Cce::Tags::detail::Lapse>(coefficients_set),
+        get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
+        get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(coefficients_set),
+        extraction_radius, computation_l_max);
+  }
+  // loop over the tags that we want to dump.
+  tmpl::for_each<reduced_boundary_tags>([&workspace, &block, &block_offset,
+                                         &l_max,
+                                         &computation_l_max](auto tag_v) {
+    using tag = typename decltype(tag_v)::type;
+    SpinWeighted<ComplexModalVector, tag::type::type::spin>
+        spin_weighted_libsharp_view;
+    spin_weighted_libsharp_view.set_data_ref(
+        workspace->output_libsharp_mode_buffer.data(),
+        workspace->output_libsharp_mode_buffer.size());
+    Spectral::Swsh::swsh_transform(
+        computation_l_max, 1, make_not_null(&spin_weighted_libsharp_view),
+        get(get<tag>(workspace->boundary_data_variables)));
+    SpinWeighted<ComplexModalVector, tag::type::type::spin>
+        spin_weighted_goldberg_view;
+    spin_weighted_goldberg_view.set_data_ref(
+        workspace->output_goldberg_mode_buffer.data(),
+        workspace->output_goldberg_mode_buffer.size());
+    Spectral::Swsh::libsharp_to_goldberg_modes(
+        make_not_null(&spin_weighted_goldberg_view),
+        spin_weighted_libsharp_view, computation_l_max);
+
+    // The goldberg format type is in strictly increasing l modes, so to
+    // reduce to a smaller l_max, we can just take the first (l_max + 1)^2
+    // values.
+    auto& reduced_modes =
+        gsl::at(block->modes, tmpl::index_of<reduced_boundary_tags, tag>::value)
+            [block_offset];
+    reduced_modes.destructive_resize(square(l_max + 1));
+    std::copy(workspace->output_goldberg_mode_buffer.begin(),
+              workspace->output_goldberg_mode_buffer.begin() +
+                  static_cast<std::ptrdiff_t>(square(l_max + 1)),
+              reduced_modes.begin());
+  });
+}
+
+void write_reduced_block(
+    const gsl::not_null<Cce::ReducedWorldtubeModeRecorder*> recorder,
+    const ReducedBlock& block, const size_t l_max) {
+  tmpl::for_each<reduced_boundary_tags>(
+      [&recorder, &block, &l_max](auto tag_v) {
+        using tag = typename decltype(tag_v)::type;
+        recorder->append_worldtube_mode_data(
+            "/" + Cce::dataset_label_for_tag<tag>(), block.times,
+            gsl::at(block.modes,
+                    tmpl::index_of<reduced_boundary_tags, tag>::value),
+            l_max, tag::type::type::spin == 0);
+      });
+}
+
 // read in the data from a (previously standard) SpEC worldtube file
 // `input_file`, perform the boundary computation, and dump the (considerably
 // smaller) dataset associated with the spin-weighted scalars to `output_file`.
+//
+// The time slices are reduced in blocks, with the slices of each block
+// distributed over `number_of_threads` threads. The reads from `input_file`
+// happen in chunks of `buffer_depth` rows and the writes to `output_file` in
+// chunks of one block, both on the main thread, and the writes of each block
+// overlap with the computation of the next. The number of threads and the size
+// of the blocks are chosen such that the buffers, the per-thread scratch
+// memory, and the reduced modes waiting to be written fit in
+// `memory_budget_in_mb` megabytes, if possible.
 void perform_cce_worldtube_reduction(
     const std::string& input_file, const std::string& output_file,
     const size_t buffer_depth, const size_t l_max_factor,
+    const size_t requested_number_of_threads, const size_t memory_budget_in_mb,
     const bool fix_spec_normalization = false) {
   Cce::MetricWorldtubeH5BufferUpdater buffer_updater{input_file};
   const size_t l_max = buffer_updater.get_l_max();
@@ -165,114 +335,112 @@ void perform_cce_worldtube_reduction(
   // at a time.
   const size_t size_of_buffer = square(l_max + 1) * (buffer_depth);
   const DataVector& time_buffer = buffer_updater.get_time_buffer();
+  const double extraction_radius = buffer_updater.get_extraction_radius();
+  const bool apply_normalization_fix =
+      not buffer_updater.has_version_history() and fix_spec_normalization;
 
   Variables<Cce::cce_metric_input_tags> coefficients_buffers{size_of_buffer};
-  Variables<Cce::cce_metric_input_tags> coefficients_set{
-      Spectral::Swsh::size_of_libsharp_coefficient_vector(computation_l_max)};
 
-  Variables<Cce::Tags::characteristic_worldtube_boundary_tags<
-      Cce::Tags::BoundaryValue>>
-      boundary_data_variables{
-          Spectral::Swsh::number_of_swsh_collocation_points(computation_l_max)};
-
-  using reduced_boundary_tags =
-      tmpl::list<Cce::Tags::BoundaryValue<Cce::Tags::BondiBeta>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiU>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiQ>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiW>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiJ>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Dr<Cce::Tags::BondiJ>>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiJ>>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::BondiR>,
-                 Cce::Tags::BoundaryValue<Cce::Tags::Du<Cce::Tags::BondiR>>>;
+  // Each slice in flight holds its reduced modes, and the same data again as
+  // rows of doubles while it is written.
+  const size_t memory_budget = memory_budget_in_mb * 1024 * 1024;
+  const size_t buffer_bytes =
+      sizeof(std::complex<double>) * coefficients_buffers.size();
+  const size_t workspace_bytes =
+      ReductionWorkspace::size_in_bytes(computation_l_max);
+  const size_t slice_bytes = 2 * number_of_reduced_tags *
+                             sizeof(std::complex<double>) * square(l_max + 1);
+  // The modes of the block being written and of the block being computed are
+  // in flight at the same time.
+  const auto fixed_bytes = [&buffer_bytes, &workspace_bytes,
+                            &slice_bytes](const size_t threads) {
+    return buffer_bytes + threads * (workspace_bytes + 2 * slice_bytes);
+  };
+  size_t number_of_threads = std::max(requested_number_of_threads, 1_st);
+  while (number_of_threads > 1 and
+         fixed_bytes(number_of_threads) > memory_budget) {
+    --number_of_threads;
+  }
+  if (number_of_threads < requested_number_of_threads) {
+    Parallel::printf(
+        "Reducing the number of threads from %zu to %zu to fit the memory "
+        "budget of %zu MB.\n",
+        requested_number_of_threads, number_of_threads, memory_budget_in_mb);
+  }
+  if (fixed_bytes(number_of_threads) > memory_budget) {
+    Parallel::printf(
+        "Warning: the buffer_depth of %zu requires more memory than the "
+        "memory budget of %zu MB.\n",
+        buffer_depth, memory_budget_in_mb);
+  }
+  const size_t block_size = std::max(
+      number_of_threads,
+      fixed_bytes(number_of_threads) > memory_budget
+          ? 0_st
+          : (memory_budget - buffer_bytes -
+             number_of_threads * workspace_bytes) /
+                (2 * slice_bytes));
+
+  std::vector<ReductionWorkspace> workspaces{};
+  workspaces.reserve(number_of_threads);
+  for (size_t thread = 0; thread < number_of_threads; ++thread) {
+    workspaces.emplace_back(computation_l_max);
+  }
 
   size_t time_span_start = 0;
   size_t time_span_end = 0;
   Cce::ReducedWorldtubeModeRecorder recorder{output_file};
 
-  ComplexModalVector output_goldberg_mode_buffer{square(computation_l_max + 1)};
-  ComplexModalVector output_libsharp_mode_buffer{
-      Spectral::Swsh::size_of_libsharp_coefficient_vector(computation_l_max)};
-
-  for (size_t i = 0; i < time_buffer.size(); ++i) {
-    const double time = time_buffer[i];
-    Parallel::printf("reducing data at time : %f / %f \r", time,
-                     time_buffer[time_buffer.size() - 1]);
+  ReducedBlock current_block{};
+  ReducedBlock previous_block{};
+  for (size_t i = 0; i < time_buffer.size();) {
     buffer_updater.update_buffers_for_time(
         make_not_null(&coefficients_buffers), make_not_null(&time_span_start),
-        make_not_null(&time_span_end), time, l_max, 0, buffer_depth);
-
-    slice_buffers_to_libsharp_modes(
-        make_not_null(&coefficients_set), coefficients_buffers,
-        time_span_end - time_span_start, i - time_span_start, l_max,
-        computation_l_max);
-
-    if (not buffer_updater.has_version_history() and fix_spec_normalization) {
-      Cce::create_bondi_boundary_data_from_unnormalized_spec_modes(
-          make_not_null(&boundary_data_variables),
-          get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Shift>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Lapse>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(
-              coefficients_set),
-          buffer_updater.get_extraction_radius(), computation_l_max);
-    } else {
-      Cce::create_bondi_boundary_data(
-          make_not_null(&boundary_data_variables),
-          get<Cce::Tags::detail::SpatialMetric>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::SpatialMetric>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::SpatialMetric>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Shift>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Shift>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Shift>>(
-              coefficients_set),
-          get<Cce::Tags::detail::Lapse>(coefficients_set),
-          get<Tags::dt<Cce::Tags::detail::Lapse>>(coefficients_set),
-          get<Cce::Tags::detail::Dr<Cce::Tags::detail::Lapse>>(
-              coefficients_set),
-          buffer_updater.get_extraction_radius(), computation_l_max);
+        make_not_null(&time_span_end), time_buffer[i], l_max, 0, buffer_depth);
+    // A block never extends past the time slices currently in the buffers.
+    const size_t block_end = std::min(time_span_end, i + block_size);
+    const size_t slices_in_block = block_end - i;
+    Parallel::printf("reducing data at time : %f / %f \r", time_buffer[i],
+                     time_buffer[time_buffer.size() - 1]);
+
+    current_block.times.assign(
+        time_buffer.begin() + static_cast<std::ptrdiff_t>(i),
+        time_buffer.begin() + static_cast<std::ptrdiff_t>(block_end));
+    for (auto& tag_modes : current_block.modes) {
+      tag_modes.resize(slices_in_block);
     }
-    // loop over the tags that we want to dump.
-    tmpl::for_each<reduced_boundary_tags>(
-        [&recorder, &boundary_data_variables, &output_goldberg_mode_buffer,
-         &output_libsharp_mode_buffer, &l_max, &computation_l_max,
-         &time](auto tag_v) {
-          using tag = typename decltype(tag_v)::type;
-          SpinWeighted<ComplexModalVector, tag::type::type::spin>
-              spin_weighted_libsharp_view;
-          spin_weighted_libsharp_view.set_data_ref(
-              output_libsharp_mode_buffer.data(),
-              output_libsharp_mode_buffer.size());
-          Spectral::Swsh::swsh_transform(
-              computation_l_max, 1, make_not_null(&spin_weighted_libsharp_view),
-              get(get<tag>(boundary_data_variables)));
-          SpinWeighted<ComplexModalVector, tag::type::type::spin>
-              spin_weighted_goldberg_view;
-          spin_weighted_goldberg_view.set_data_ref(
-              output_goldberg_mode_buffer.data(),
-              output_goldberg_mode_buffer.size());
-          Spectral::Swsh::libsharp_to_goldberg_modes(
-              make_not_null(&spin_weighted_goldberg_view),
-              spin_weighted_libsharp_view, computation_l_max);
-
-          // The goldberg format type is in strictly increasing l modes, so to
-          // reduce to a smaller l_max, we can just take the first (l_max + 1)^2
-          // values.
-          ComplexModalVector reduced_goldberg_view{
-              output_goldberg_mode_buffer.data(), square(l_max + 1)};
-          recorder.append_worldtube_mode_data(
-              "/" + Cce::dataset_label_for_tag<tag>(), time,
-              reduced_goldberg_view, l_max, tag::type::type::spin == 0);
-        });
+    const auto reduce_slices = [&workspaces, &current_block,
+                                &coefficients_buffers, &time_span_start,
+                                &time_span_end, &i, &slices_in_block, &l_max,
+                                &computation_l_max, &extraction_radius,
+                                &apply_normalization_fix,
+                                &number_of_threads](const size_t thread) {
+      for (size_t slice = thread; slice < slices_in_block;
+           slice += number_of_threads) {
+        reduce_time_slice(make_not_null(&workspaces[thread]),
+                          make_not_null(&current_block), slice,
+                          coefficients_buffers, time_span_end - time_span_start,
+                          i + slice - time_span_start, l_max,
+                          computation_l_max, extraction_radius,
+                          apply_normalization_fix);
+      }
+    };
+    std::vector<std::thread> workers{};
+    workers.reserve(number_of_threads - 1);
+    for (size_t thread = 1; thread < number_of_threads; ++thread) {
+      workers.emplace_back(reduce_slices, thread);
+    }
+    // The H5 file is only accessed from the main thread, which writes the
+    // previous block while the workers reduce the current one.
+    write_reduced_block(make_not_null(&recorder), previous_block, l_max);
+    reduce_slices(0);
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    std::swap(previous_block, current_block);
+    i = block_end;
   }
+  write_reduced_block(make_not_null(&recorder), previous_block, l_max);
   Parallel::printf("\n");
 }
 }  // namespace
@@ -301,7 +469,17 @@ int main(int argc, char** argv) {
       "routines. Higher values mean fewer, larger loads from file into RAM.")(
       "lmax_factor", boost::program_options::value<size_t>()->default_value(2),
       "the boundary computations will be performed at a resolution that is "
-      "lmax_factor times the input file lmax to avoid aliasing");
+      "lmax_factor times the input file lmax to avoid aliasing")(
+      "num_threads", boost::program_options::value<size_t>()->default_value(1),
+      "number of threads to reduce the time slices with. The reads from the "
+      "input file and the writes to the output file are always performed by a "
+      "single thread.")(
+      "memory_budget",
+      boost::program_options::value<size_t>()->default_value(4096),
+      "approximate memory in MB to use for the buffers, the per-thread "
+      "scratch memory, and the reduced data waiting to be written. Determines "
+      "how many time slices are reduced before each write to the output file, "
+      "and may limit the number of threads.");
 
   boost::program_options::variables_map vars;
 
@@ -322,5 +500,7 @@ int main(int argc, char** argv) {
                                   vars["output_file"].as<std::string>(),
                                   vars["buffer_depth"].as<size_t>(),
                                   vars["lmax_factor"].as<size_t>(),
+                                  vars["num_threads"].as<size_t>(),
+                                  vars["memory_budget"].as<size_t>(),
                                   vars.count("fix_spec_normalization") != 0u);
 }
@@ -4,8 +4,12 @@
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "IO/Exporter/Exporter.hpp"
+#include "IO/Exporter/TransformVolumeData.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ErrorHandling/SegfaultHandler.hpp"
 #include "Utilities/MakeArray.hpp"
@@ -50,4 +54,26 @@ PYBIND11_MODULE(_Pybindings, m) {  // NOLINT
       py::arg("volume_files_or_glob"), py::arg("subfile_name"),
       py::arg("observation_id"), py::arg("tensor_components"),
       py::arg("target_points"), py::arg("num_threads") = std::nullopt);
+  py::class_<spectre::Exporter::TransformKernel>(m, "TransformKernel")
+      .def(py::init([](std::string name,
+                       std::vector<std::string> input_components,
+                       std::optional<std::string> output_name) {
+             return spectre::Exporter::TransformKernel{
+                 std::move(name), std::move(input_components),
+                 std::move(output_name)};
+           }),
+           py::arg("name"),
+           py::arg("input_components") = std::vector<std::string>{},
+           py::arg("output_name") = std::nullopt)
+      .def_readwrite("name", &spectre::Exporter::TransformKernel::name)
+      .def_readwrite("input_components",
+                     &spectre::Exporter::TransformKernel::input_components)
+      .def_readwrite("output_name",
+                     &spectre::Exporter::TransformKernel::output_name);
+  m.def("registered_transform_kernels",
+        &spectre::Exporter::registered_transform_kernels);
+  m.def("transform_volume_data", &spectre::Exporter::transform_volume_data,
+        py::arg("volume_files_or_glob"), py::arg("subfile_name"),
+        py::arg("kernels"), py::arg("overwrite_existing") = false,
+        py::arg("num_threads") = std::nullopt);
 }
@@ -0,0 +1,486 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Exporter/TransformVolumeData.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <csignal>  // For Blaze error handling without PCH
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif  // _OPENMP
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/Determinant.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/Composition.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/Creators/RegisterDerivedWithCharm.hpp"
+#include "Domain/Creators/TimeDependence/RegisterDerivedWithCharm.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementToBlockLogicalMap.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Domain/FunctionsOfTime/RegisterDerivedWithCharm.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Overloader.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/StdHelpers.hpp"
+
+// Ignore OpenMP pragmas when OpenMP is not enabled
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+
+namespace spectre::Exporter {
+
+namespace {
+const std::array<std::string, 3> axis_names{{"x", "y", "z"}};
+
+// The data of a single element that kernels can operate on. The `inputs` hold
+// the input components of the kernel, restricted to the element. The
+// coordinates and Jacobians are only set if a kernel requires the element map.
+template <size_t Dim>
+struct ElementData {
+  const Mesh<Dim>& mesh;
+  const std::vector<DataVector>& inputs;
+  const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
+      inertial_coords;
+  const std::optional<
+      Jacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>>&
+      jacobian;
+  const std::optional<
+      InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>>&
+      inv_jacobian;
+};
+
+template <size_t Dim>
+struct RegisteredKernel {
+  // Whether the kernel needs the coordinates and Jacobians of the element
+  bool requires_element_map;
+  // Whether the kernel needs input components
+  bool requires_inputs;
+  // The names of the output components
+  std::vector<std::string> (*output_components)(const TransformKernel& kernel);
+  // Fill the `outputs` for a single element. They have the size of the element
+  // and are ordered like the `output_components`.
+  void (*apply)(gsl::not_null<std::vector<DataVector>*> outputs,
+                const ElementData<Dim>& element);
+};
+
+template <size_t Dim>
+std::vector<std::string> vector_output_components(const std::string& name) {
+  std::vector<std::string> result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    result.push_back(name + "_" + gsl::at(axis_names, d));
+  }
+  return result;
+}
+
+template <size_t Dim>
+const std::unordered_map<std::string, RegisteredKernel<Dim>>&
+kernel_registry() {
+  static const std::unordered_map<std::string, RegisteredKernel<Dim>> registry{
+      {"PartialDerivatives",
+       {true, true,
+        [](const TransformKernel& kernel) {
+          std::vector<std::string> result{};
+          for (const auto& input_component : kernel.input_components) {
+            const auto component_result = vector_output_components<Dim>(
+                kernel.output_name.value_or("Deriv") + input_component);
+            result.insert(result.end(), component_result.begin(),
+                          component_result.end());
+          }
+          return result;
+        },
+        [](const gsl::not_null<std::vector<DataVector>*> outputs,
+           const ElementData<Dim>& element) {
+          Scalar<DataVector> input{};
+          tnsr::i<DataVector, Dim, Frame::Inertial> deriv{};
+          for (size_t i = 0; i < element.inputs.size(); ++i) {
+            get(input).set_data_ref(
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+                const_cast<double*>(element.inputs[i].data()),
+                element.inputs[i].size());
+            for (size_t d = 0; d < Dim; ++d) {
+              deriv.get(d).set_data_ref(
+                  make_not_null(&(*outputs)[i * Dim + d]));
+            }
+            partial_derivative(make_not_null(&deriv), input, element.mesh,
+                               *element.inv_jacobian);
+          }
+        }}},
+      {"PointwiseL2Norm",
+       {false, true,
+        [](const TransformKernel& kernel) {
+          return std::vector<std::string>{
+              kernel.output_name.value_or("PointwiseL2Norm")};
+        },
+        [](const gsl::not_null<std::vector<DataVector>*> outputs,
+           const ElementData<Dim>& element) {
+          auto& norm = (*outputs)[0];
+          norm = 0.0;
+          for (const auto& input : element.inputs) {
+            norm += square(input);
+          }
+          norm = sqrt(norm);
+        }}},
+      {"InertialCoordinates",
+       {true, false,
+        [](const TransformKernel& kernel) {
+          return vector_output_components<Dim>(
+              kernel.output_name.value_or("InertialCoordinates"));
+        },
+        [](const gsl::not_null<std::vector<DataVector>*> outputs,
+           const ElementData<Dim>& element) {
+          for (size_t d = 0; d < Dim; ++d) {
+            (*outputs)[d] = element.inertial_coords->get(d);
+          }
+        }}},
+      {"DetJacobian",
+       {true, false,
+        [](const TransformKernel& kernel) {
+          return std::vector<std::string>{
+              kernel.output_name.value_or("DetJacobian")};
+        },
+        [](const gsl::not_null<std::vector<DataVector>*> outputs,
+           const ElementData<Dim>& element) {
+          (*outputs)[0] = get(determinant(*element.jacobian));
+        }}}};
+  return registry;
+}
+
+// The map from element logical to inertial coordinates, including the
+// time-dependent part. See `domain::py_bindings::bind_element_map` for details.
+template <size_t Dim>
+std::unique_ptr<domain::CoordinateMapBase<Frame::ElementLogical,
+                                          Frame::Inertial, Dim>>
+element_map(const ElementId<Dim>& element_id, const Domain<Dim>& domain) {
+  const auto& block = domain.blocks()[element_id.block_id()];
+  auto element_to_block_logical_map =
+      domain::element_to_block_logical_map(element_id);
+  if (block.is_time_dependent()) {
+    if (block.has_distorted_frame()) {
+      using CompositionType = domain::CoordinateMaps::Composition<
+          tmpl::list<Frame::ElementLogical, Frame::BlockLogical, Frame::Grid,
+                     Frame::Distorted, Frame::Inertial>,
+          Dim>;
+      return std::make_unique<CompositionType>(
+          std::move(element_to_block_logical_map),
+          block.moving_mesh_logical_to_grid_map().get_clone(),
+          block.moving_mesh_grid_to_distorted_map().get_clone(),
+          block.moving_mesh_distorted_to_inertial_map().get_clone());
+    } else {
+      using CompositionType = domain::CoordinateMaps::Composition<
+          tmpl::list<Frame::ElementLogical, Frame::BlockLogical, Frame::Grid,
+                     Frame::Inertial>,
+          Dim>;
+      return std::make_unique<CompositionType>(
+          std::move(element_to_block_logical_map),
+          block.moving_mesh_logical_to_grid_map().get_clone(),
+          block.moving_mesh_grid_to_inertial_map().get_clone());
+    }
+  } else {
+    using CompositionType = domain::CoordinateMaps::Composition<
+        tmpl::list<Frame::ElementLogical, Frame::BlockLogical,
+                   Frame::Inertial>,
+        Dim>;
+    return std::make_unique<CompositionType>(
+        std::move(element_to_block_logical_map),
+        block.stationary_map().get_clone());
+  }
+}
+
+DataVector to_double_precision(
+    std::variant<DataVector, std::vector<float>> component_data) {
+  if (std::holds_alternative<DataVector>(component_data)) {
+    return std::get<DataVector>(std::move(component_data));
+  }
+  const auto& float_component_data =
+      std::get<std::vector<float>>(component_data);
+  DataVector double_component_data(float_component_data.size());
+  for (size_t i = 0; i < float_component_data.size(); ++i) {
+    double_component_data[i] = float_component_data[i];
+  }
+  return double_component_data;
+}
+
+// Apply the `kernels` to a single observation in the `volfile` and write the
+// results back into the `volfile`
+template <size_t Dim>
+void transform_observation(
+    const gsl::not_null<h5::VolumeData*> volfile, const size_t obs_id,
+    const std::vector<TransformKernel>& kernels,
+    const std::vector<const RegisteredKernel<Dim>*>& registered_kernels,
+    const std::vector<std::vector<std::string>>& output_components,
+    const bool overwrite_existing, [[maybe_unused]] const size_t num_threads) {
+  const auto grid_names = volfile->get_grid_names(obs_id);
+  const auto all_extents = volfile->get_extents(obs_id);
+  const auto all_bases = volfile->get_bases(obs_id);
+  const auto all_quadratures = volfile->get_quadratures(obs_id);
+  const size_t num_elements = grid_names.size();
+
+  // Offsets of the elements in the contiguous data, which are in the same
+  // order as the grid names
+  std::vector<size_t> offsets(num_elements + 1, 0);
+  for (size_t i = 0; i < num_elements; ++i) {
+    offsets[i + 1] = offsets[i] + alg::accumulate(all_extents[i], 1_st,
+                                                  std::multiplies<>{});
+  }
+  const size_t total_num_points = offsets.back();
+
+  // Load each input component once, even if multiple kernels use it
+  std::unordered_map<std::string, DataVector> input_data{};
+  for (const auto& kernel : kernels) {
+    for (const auto& input_component : kernel.input_components) {
+      if (input_data.count(input_component) == 0) {
+        input_data.emplace(
+            input_component,
+            to_double_precision(
+                volfile->get_tensor_component(obs_id, input_component).data));
+      }
+    }
+  }
+
+  // Load the domain if any kernel needs the element maps
+  const bool requires_element_map =
+      alg::any_of(registered_kernels, [](const auto* registered_kernel) {
+        return registered_kernel->requires_element_map;
+      });
+  std::optional<Domain<Dim>> domain{};
+  double time = std::numeric_limits<double>::signaling_NaN();
+  domain::FunctionsOfTimeMap functions_of_time{};
+  if (requires_element_map) {
+    const auto serialized_domain = volfile->get_domain(obs_id);
+    if (not serialized_domain.has_value()) {
+      ERROR_NO_TRACE(
+          "No domain found in the volume data, but it is needed to compute "
+          "coordinates and Jacobians. Ensure the domain is written in the H5 "
+          "file.");
+    }
+    domain = deserialize<Domain<Dim>>(serialized_domain->data());
+    if (domain->is_time_dependent()) {
+      time = volfile->get_observation_value(obs_id);
+      functions_of_time = deserialize<domain::FunctionsOfTimeMap>(
+          volfile->get_functions_of_time(obs_id)->data());
+    }
+  }
+
+  // Allocate the contiguous output data for all kernels
+  std::vector<std::vector<DataVector>> output_data(kernels.size());
+  for (size_t k = 0; k < kernels.size(); ++k) {
+    output_data[k].resize(output_components[k].size(),
+                          DataVector(total_num_points));
+  }
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    std::vector<DataVector> element_inputs{};
+    std::vector<DataVector> element_outputs{};
+    std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>> inertial_coords{};
+    std::optional<
+        Jacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>>
+        jacobian{};
+    std::optional<InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                                  Frame::Inertial>>
+        inv_jacobian{};
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < num_elements; ++i) {
+      const size_t offset = offsets[i];
+      const size_t num_points = offsets[i + 1] - offset;
+      const Mesh<Dim> mesh = h5::mesh_for_grid<Dim>(
+          grid_names[i], grid_names, all_extents, all_bases, all_quadratures);
+      if (requires_element_map) {
+        const ElementId<Dim> element_id(grid_names[i]);
+        const auto map = element_map(element_id, *domain);
+        const auto logical_coords = logical_coordinates(mesh);
+        inertial_coords = (*map)(logical_coords, time, functions_of_time);
+        jacobian = map->jacobian(logical_coords, time, functions_of_time);
+        inv_jacobian =
+            map->inv_jacobian(logical_coords, time, functions_of_time);
+      }
+      for (size_t k = 0; k < kernels.size(); ++k) {
+        // Point the element inputs and outputs at the element's slice of the
+        // contiguous data. Different elements write to disjoint slices.
+        element_inputs.resize(kernels[k].input_components.size());
+        for (size_t j = 0; j < element_inputs.size(); ++j) {
+          element_inputs[j].set_data_ref(
+              // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+              const_cast<double*>(
+                  input_data.at(kernels[k].input_components[j]).data()) +
+                  offset,
+              num_points);
+        }
+        element_outputs.resize(output_data[k].size());
+        for (size_t j = 0; j < element_outputs.size(); ++j) {
+          element_outputs[j].set_data_ref(output_data[k][j].data() + offset,
+                                          num_points);
+        }
+        registered_kernels[k]->apply(
+            make_not_null(&element_outputs),
+            ElementData<Dim>{mesh, element_inputs, inertial_coords, jacobian,
+                             inv_jacobian});
+      }
+    }  // omp for
+  }    // omp parallel
+
+  // Write the results back with one contiguous write per component
+  for (size_t k = 0; k < kernels.size(); ++k) {
+    for (size_t j = 0; j < output_components[k].size(); ++j) {
+      volfile->write_tensor_component(obs_id, output_components[k][j],
+                                      output_data[k][j], overwrite_existing);
+    }
+  }
+}
+
+template <size_t Dim>
+std::vector<std::string> transform_volume_data_impl(
+    const std::vector<std::string>& filenames, const std::string& subfile_name,
+    const std::vector<TransformKernel>& kernels, const bool overwrite_existing,
+    const size_t num_threads) {
+  std::vector<const RegisteredKernel<Dim>*> registered_kernels{};
+  std::vector<std::vector<std::string>> output_components{};
+  std::vector<std::string> all_output_components{};
+  const auto& registry = kernel_registry<Dim>();
+  for (const auto& kernel : kernels) {
+    const auto found_kernel = registry.find(kernel.name);
+    if (found_kernel == registry.end()) {
+      ERROR_NO_TRACE("Unknown kernel '"
+                     << kernel.name << "'. Available kernels are: "
+                     << registered_transform_kernels());
+    }
+    const auto& registered_kernel = found_kernel->second;
+    if (registered_kernel.requires_inputs and
+        kernel.input_components.empty()) {
+      ERROR_NO_TRACE("The kernel '" << kernel.name
+                                    << "' needs at least one input component.");
+    }
+    if (not registered_kernel.requires_inputs and
+        not kernel.input_components.empty()) {
+      ERROR_NO_TRACE("The kernel '" << kernel.name
+                                    << "' takes no input components, but got "
+                                    << kernel.input_components);
+    }
+    registered_kernels.push_back(&registered_kernel);
+    output_components.push_back(registered_kernel.output_components(kernel));
+    all_output_components.insert(all_output_components.end(),
+                                 output_components.back().begin(),
+                                 output_components.back().end());
+  }
+
+  // Process all volume files in serial, because loading and writing data with
+  // H5 must be done in serial anyway. Instead, the loop over elements within
+  // each observation is parallelized with OpenMP.
+  for (const auto& filename : filenames) {
+    h5::H5File<h5::AccessType::ReadWrite> h5file(filename, true);
+    auto& volfile = h5file.get<h5::VolumeData>(subfile_name);
+    if (volfile.get_dimension() != Dim) {
+      ERROR_NO_TRACE("Mismatched dimensions: expected "
+                     << Dim << "D volume data in file '" << filename
+                     << "', but got " << volfile.get_dimension() << "D.");
+    }
+    for (const size_t obs_id : volfile.list_observation_ids()) {
+      transform_observation(make_not_null(&volfile), obs_id, kernels,
+                            registered_kernels, output_components,
+                            overwrite_existing, num_threads);
+    }
+  }
+  return all_output_components;
+}
+}  // namespace
+
+std::vector<std::string> registered_transform_kernels() {
+  std::vector<std::string> result{};
+  for (const auto& [name, kernel] : kernel_registry<3>()) {
+    (void)kernel;
+    result.push_back(name);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::vector<std::string> transform_volume_data(
+    const std::variant<std::vector<std::string>, std::string>&
+        volume_files_or_glob,
+    const std::string& subfile_name,
+    const std::vector<TransformKernel>& kernels, const bool overwrite_existing,
+    const std::optional<size_t> num_threads) {
+  domain::creators::register_derived_with_charm();
+  domain::creators::time_dependence::register_derived_with_charm();
+  domain::FunctionsOfTime::register_derived_with_charm();
+
+  // Resolve number of threads to use in OpenMP parallelization
+#ifdef _OPENMP
+  const size_t resolved_num_threads =
+      num_threads.value_or(omp_get_max_threads());
+#else
+  if (num_threads.has_value()) {
+    ERROR_NO_TRACE(
+        "OpenMP is not available, so num_threads cannot be specified.");
+  }
+  const size_t resolved_num_threads = 1;
+#endif  // _OPENMP
+
+  // Get the list of volume data files
+  const std::vector<std::string> filenames =
+      std::visit(Overloader{[](const std::vector<std::string>& volume_files) {
+                              return volume_files;
+                            },
+                            [](const std::string& volume_files_glob) {
+                              return file_system::glob(volume_files_glob);
+                            }},
+                 volume_files_or_glob);
+  if (filenames.empty()) {
+    ERROR_NO_TRACE("No volume files found. Specify at least one volume file.");
+  }
+  if (kernels.empty()) {
+    return {};
+  }
+
+  // Retrieve the dimension from the first volume file
+  const size_t dim = [&filenames, &subfile_name]() {
+    const h5::H5File<h5::AccessType::ReadOnly> first_h5file(filenames.front());
+    return first_h5file.get<h5::VolumeData>(subfile_name).get_dimension();
+  }();
+  switch (dim) {
+    case 1:
+      return transform_volume_data_impl<1>(filenames, subfile_name, kernels,
+                                           overwrite_existing,
+                                           resolved_num_threads);
+    case 2:
+      return transform_volume_data_impl<2>(filenames, subfile_name, kernels,
+                                           overwrite_existing,
+                                           resolved_num_threads);
+    case 3:
+      return transform_volume_data_impl<3>(filenames, subfile_name, kernels,
+                                           overwrite_existing,
+                                           resolved_num_threads);
+    default:
+      ERROR_NO_TRACE("Invalid dimension of volume data: " << dim);
+  }
+}
+
+}  // namespace spectre::Exporter
+
+#pragma GCC diagnostic pop
@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Declares functions for transforming data in volume files with compiled
+/// kernels.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace spectre::Exporter {
+
+/*!
+ * \brief A compiled kernel to apply to volume data with
+ * `transform_volume_data`
+ *
+ * The following kernels are available (see `registered_transform_kernels`):
+ *
+ * - `PartialDerivatives`: Partial derivatives of each of the
+ *   `input_components` in inertial coordinates. The output components are
+ *   named `Deriv<Component>_<axis>`, where `Deriv` is replaced by the
+ *   `output_name` if one is given. For example, the derivatives of the
+ *   `Psi` component are named `DerivPsi_x`, `DerivPsi_y`, and `DerivPsi_z`.
+ * - `PointwiseL2Norm`: The pointwise Euclidean norm of all
+ *   `input_components`, e.g. of all components of a constraint.
+ * - `InertialCoordinates`: The inertial coordinates of the grid points.
+ *   Takes no input components.
+ * - `DetJacobian`: The determinant of the Jacobian of the map from element
+ *   logical to inertial coordinates. Takes no input components.
+ *
+ * Kernels other than `PartialDerivatives` write a single tensor named after
+ * the kernel, or the `output_name` if one is given.
+ */
+struct TransformKernel {
+  /// Name of the registered kernel
+  std::string name;
+  /// Tensor components in the volume data that the kernel is applied to, e.g.
+  /// "Psi" or "Shift_x"
+  std::vector<std::string> input_components{};
+  /// Name of the output tensor
+  std::optional<std::string> output_name = std::nullopt;
+};
+
+/// The names of all kernels that `transform_volume_data` can apply
+std::vector<std::string> registered_transform_kernels();
+
+/*!
+ * \brief Apply compiled kernels to all observations in volume files and write
+ * the results back into the files
+ *
+ * The volume files are processed one after the other. For each observation,
+ * the input components of all kernels are read once, the kernels are applied to
+ * all elements in parallel, and the output components are written back into
+ * the volume file with one contiguous write per component.
+ *
+ * \param volume_files_or_glob The list of H5 files, or a glob pattern
+ * \param subfile_name The name of the subfile in the H5 files containing the
+ * volume data
+ * \param kernels The kernels to apply, see `TransformKernel`
+ * \param overwrite_existing Overwrite output components that already exist in
+ * the volume files
+ * \param num_threads The number of threads to use if OpenMP is linked in. If
+ * not specified, OpenMP will determine the number of threads automatically.
+ * It's an error to specify num_threads if OpenMP is not linked in. Set
+ * num_threads to 1 to disable OpenMP.
+ * \return The names of the tensor components that were written
+ */
+std::vector<std::string> transform_volume_data(
+    const std::variant<std::vector<std::string>, std::string>&
+        volume_files_or_glob,
+    const std::string& subfile_name,
+    const std::vector<TransformKernel>& kernels,
+    bool overwrite_existing = false,
+    std::optional<size_t> num_threads = std::nullopt);
+
+}  // namespace spectre::Exporter
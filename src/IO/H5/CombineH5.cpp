@@ -3,15 +3,20 @@
 
 #include "IO/H5/CombineH5.hpp"
 
-#include <boost/program_options.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
+#include <hdf5.h>
 #include <iterator>
+#include <limits>
+#include <optional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/CheckH5PropertiesMatch.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/SourceArchive.hpp"
@@ -19,42 +24,51 @@
 #include "IO/H5/VolumeData.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/StdHelpers.hpp"
 
 namespace {
-// Returns all the observation_ids stored in the volume files. Assumes all
-// volume files have the same observation ids
-std::vector<size_t> get_observation_ids(
-    const std::vector<std::string>& file_names,
-    const std::string& subfile_name) {
-  const h5::H5File<h5::AccessType::ReadOnly> initial_file(file_names[0], false);
-  const auto& initial_volume_file =
-      initial_file.get<h5::VolumeData>(subfile_name);
-  return initial_volume_file.list_observation_ids();
-}
-
-// Returns total number of elements for an observation id across all volume data
-// files
-size_t get_number_of_elements(const std::vector<std::string>& input_filenames,
-                              const std::string& subfile_name,
-                              const size_t& observation_id) {
-  size_t total_elements = 0;
-  for (const auto& input_filename : input_filenames) {
-    const h5::H5File<h5::AccessType::ReadOnly> original_file(input_filename,
-                                                             false);
-    const auto& original_volume_file =
-        original_file.get<h5::VolumeData>(subfile_name);
-    total_elements += original_volume_file.get_extents(observation_id).size();
+// Reads the element data of `observation_id` from all `volume_files`, using up
+// to `number_of_threads` threads. The result holds the element data of each
+// volume file in the same order as `volume_files`.
+std::vector<std::vector<ElementVolumeData>> read_element_data(
+    const std::vector<const h5::VolumeData*>& volume_files,
+    const size_t observation_id, const size_t number_of_threads) {
+  std::vector<std::vector<ElementVolumeData>> data_by_file(volume_files.size());
+  const size_t number_of_workers =
+      std::min(number_of_threads, volume_files.size());
+  if (number_of_workers <= 1) {
+    for (size_t i = 0; i < volume_files.size(); ++i) {
+      data_by_file[i] =
+          volume_files[i]->get_observation_data_by_element(observation_id);
+    }
+    return data_by_file;
+  }
+  std::vector<std::thread> workers{};
+  workers.reserve(number_of_workers);
+  for (size_t worker = 0; worker < number_of_workers; ++worker) {
+    workers.emplace_back([&data_by_file, &volume_files, number_of_workers,
+                          observation_id, worker]() {
+      for (size_t i = worker; i < volume_files.size();
+           i += number_of_workers) {
+        data_by_file[i] =
+            volume_files[i]->get_observation_data_by_element(observation_id);
+      }
+    });
   }
-  return total_elements;
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  return data_by_file;
 }
 }  // namespace
 namespace h5 {
 
 void combine_h5(const std::vector<std::string>& file_names,
                 const std::string& subfile_name, const std::string& output,
-                const bool check_src) {
+                const bool check_src, const bool use_virtual_datasets,
+                const size_t number_of_threads) {
   // Parses for and stores all input files to be looped over
   Parallel::printf("Processing files:\n%s\n",
                    std::string{MakeString{} << file_names}.c_str());
@@ -77,76 +91,90 @@ void combine_h5(const std::vector<std::string>& file_names,
         "executable or were corrupted.");
   }
 
-  // Braces to specify scope for H5 file
-  {
-    // Instantiates the output file and the .vol subfile to be filled with the
-    // combined data later
-    Parallel::printf("Creating output file: %s\n", output.c_str());
-    h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
-    new_file.insert<h5::VolumeData>(subfile_name);
-    new_file.close_current_object();
-  }  // End of scope for H5 file
-
-  // Obtains list of observation ids to loop over
+  // Reading from multiple threads is only safe if the HDF5 library was built
+  // with thread-safety
+  size_t number_of_read_threads = std::max(number_of_threads, 1_st);
+  if (number_of_read_threads > 1 and not use_virtual_datasets) {
+    hbool_t is_threadsafe = 0;
+    CHECK_H5(H5is_library_threadsafe(&is_threadsafe),
+             "Failed to check if the HDF5 library is thread-safe");
+    if (not static_cast<bool>(is_threadsafe)) {
+      Parallel::printf(
+          "The HDF5 library is not thread-safe, so the files are read with a "
+          "single thread.\n");
+      number_of_read_threads = 1;
+    }
+  }
+
+  // Open all input files once and keep them open while processing the
+  // observations
+  std::vector<h5::H5File<h5::AccessType::ReadOnly>> input_files{};
+  input_files.reserve(file_names.size());
+  std::vector<const h5::VolumeData*> input_volume_files{};
+  input_volume_files.reserve(file_names.size());
+  for (const auto& file_name : file_names) {
+    input_files.emplace_back(file_name, false);
+    input_volume_files.push_back(
+        &input_files.back().get<h5::VolumeData>(subfile_name));
+  }
+  // Virtual datasets reference the input files by their path, so make sure
+  // the paths don't depend on the working directory
+  std::vector<std::string> source_file_names{};
+  if (use_virtual_datasets) {
+    source_file_names.reserve(file_names.size());
+    for (const auto& file_name : file_names) {
+      source_file_names.push_back(file_system::get_absolute_path(file_name));
+    }
+  }
+
+  // Instantiates the output file and the .vol subfile to be filled with the
+  // combined data
+  Parallel::printf("Creating output file: %s\n", output.c_str());
+  h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
+  auto& new_volume_file = new_file.insert<h5::VolumeData>(subfile_name);
+
+  // Obtains list of observation ids to loop over. Assumes all volume files
+  // have the same observation ids, which we checked above.
   const std::vector<size_t> observation_ids =
-      get_observation_ids(file_names, subfile_name);
+      input_volume_files.front()->list_observation_ids();
 
   // Loops over observation ids to write volume data by observation id
   for (size_t obs_index = 0; obs_index < observation_ids.size(); ++obs_index) {
     const size_t obs_id = observation_ids[obs_index];
-    // Pre-calculates size of vector to store element data and allocates
-    // corresponding memory
-    const size_t vector_dim =
-        get_number_of_elements(file_names, subfile_name, obs_id);
-    std::vector<ElementVolumeData> element_data;
-    element_data.reserve(vector_dim);
-
-    double obs_val = 0.0;
-    std::optional<std::vector<char>> serialized_domain{};
-    std::optional<std::vector<char>> serialized_functions_of_time{};
-
-    // Loops over input files to append element data into a single vector to be
-    // stored in a single H5
-    bool printed = false;
-    for (auto const& file_name : file_names) {
-      const h5::H5File<h5::AccessType::ReadOnly> original_file(file_name,
-                                                               false);
-      const auto& original_volume_file =
-          original_file.get<h5::VolumeData>(subfile_name);
-      obs_val = original_volume_file.get_observation_value(obs_id);
-      if (not printed) {
-        Parallel::printf(
-            "Processing obsevation ID %lo (%lo/%lo) with value %1.14e\n",
-            obs_id, obs_index, observation_ids.size(), obs_val);
-        printed = true;
-      }
-      Parallel::printf("  Processing file: %s\n", file_name.c_str());
-
-      serialized_domain = original_volume_file.get_domain(obs_id);
-      serialized_functions_of_time =
-          original_volume_file.get_functions_of_time(obs_id);
+    const double obs_val =
+        input_volume_files.front()->get_observation_value(obs_id);
+    Parallel::printf(
+        "Processing obsevation ID %lo (%lo/%lo) with value %1.14e\n", obs_id,
+        obs_index, observation_ids.size(), obs_val);
+
+    if (use_virtual_datasets) {
+      new_volume_file.write_virtual_volume_data(obs_id, source_file_names,
+                                                input_volume_files);
+      continue;
+    }
 
-      // Get vector of element data for this `obs_id` and `file_name`
-      std::vector<ElementVolumeData> data_by_element =
-          std::move(std::get<2>(original_volume_file.get_data_by_element(
-              obs_val * (1.0 - 4.0 * std::numeric_limits<double>::epsilon()),
-              obs_val * (1.0 + 4.0 * std::numeric_limits<double>::epsilon()),
-              std::nullopt)[0]));
+    std::vector<std::vector<ElementVolumeData>> data_by_file =
+        read_element_data(input_volume_files, obs_id, number_of_read_threads);
 
-      // Append vector to total vector of element data for this `obs_id`
+    // Append element data into a single vector to be stored in a single H5
+    size_t number_of_elements = 0;
+    for (const auto& data_by_element : data_by_file) {
+      number_of_elements += data_by_element.size();
+    }
+    std::vector<ElementVolumeData> element_data{};
+    element_data.reserve(number_of_elements);
+    for (auto& data_by_element : data_by_file) {
       element_data.insert(element_data.end(),
                           std::make_move_iterator(data_by_element.begin()),
                           std::make_move_iterator(data_by_element.end()));
       data_by_element.clear();
-      original_file.close_current_object();
     }
 
-    h5::H5File<h5::AccessType::ReadWrite> new_file(output, true);
-    auto& new_volume_file = new_file.get<h5::VolumeData>(subfile_name);
-    new_volume_file.write_volume_data(obs_id, obs_val, element_data,
-                                      serialized_domain,
-                                      serialized_functions_of_time);
-    new_file.close_current_object();
+    new_volume_file.write_volume_data(
+        obs_id, obs_val, element_data,
+        input_volume_files.back()->get_domain(obs_id),
+        input_volume_files.back()->get_functions_of_time(obs_id));
   }
+  new_file.close_current_object();
 }
 }  // namespace h5
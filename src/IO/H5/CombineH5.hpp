@@ -3,13 +3,33 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
 namespace h5 {
 
+/*!
+ * \brief Combine the volume data subfile `subfile_name` of all `file_names`
+ * into a single file `output`.
+ *
+ * Each input file is opened only once and the observations are processed one
+ * at a time, so that only the data of one observation is held in memory.
+ *
+ * - If `use_virtual_datasets` is `true`, no tensor data is copied. Instead, the
+ *   tensor components in the output file are HDF5 virtual datasets that
+ *   reference the data in the input files (see
+ *   `h5::VolumeData::write_virtual_volume_data`). The input files must stay in
+ *   place for the output file to remain readable.
+ * - Otherwise, the data is copied into the output file. The input files are
+ *   read with up to `number_of_threads` threads concurrently. Reading in
+ *   parallel requires an HDF5 library built with thread-safety, so the files
+ *   are read serially otherwise.
+ */
 void combine_h5(const std::vector<std::string>& file_names,
                 const std::string& subfile_name, const std::string& output,
-                const bool check_src = true);
+                const bool check_src = true,
+                const bool use_virtual_datasets = false,
+                const size_t number_of_threads = 1);
 
 }  // namespace h5
@@ -324,6 +324,12 @@ void delete_connectivity(const hid_t group_id) {
   H5Ldelete(group_id, "connectivity", h5p_default());
 }
 
+void link_connectivity(const hid_t group_id, const hid_t source_group_id) {
+  CHECK_H5(H5Lcreate_hard(source_group_id, "connectivity", group_id,
+                          "connectivity", h5p_default(), h5p_default()),
+           "Failed to link connectivity");
+}
+
 std::array<hsize_t, 2> append_to_dataset(
     const hid_t file_id, const std::string& name,
     const std::vector<double>& data, const hsize_t number_of_rows,
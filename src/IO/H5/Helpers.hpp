@@ -120,6 +120,13 @@ void write_connectivity(hid_t group_id, const std::vector<int>& connectivity);
  */
 void delete_connectivity(hid_t group_id);
 
+/*!
+ * \ingroup HDF5Group
+ * \brief Make the connectivity of the group in the H5 file a hard link to the
+ * connectivity of the `source_group_id`, so both groups share one dataset
+ */
+void link_connectivity(hid_t group_id, hid_t source_group_id);
+
 /*!
  * \ingroup HDF5Group
  * \brief Append rows to an existing dataset
@@ -55,7 +55,36 @@ combine_h5_command.add_command(combine_h5_dat_command, name="dat")
         " checked, False implies no src files to check."
     ),
 )
-def combine_h5_vol_command(h5files, subfile_name, output, check_src):
+@click.option(
+    "--virtual/--copy",
+    "use_virtual_datasets",
+    default=False,
+    show_default=True,
+    help=(
+        "Write HDF5 virtual datasets that reference the data in the input"
+        " files instead of copying the data. The input files must stay in"
+        " place for the output file to remain readable."
+    ),
+)
+@click.option(
+    "--num-threads",
+    "-j",
+    type=click.IntRange(min=1),
+    default=1,
+    show_default=True,
+    help=(
+        "Number of threads to read the input files with when copying the data."
+        " Requires an HDF5 library built with thread-safety."
+    ),
+)
+def combine_h5_vol_command(
+    h5files,
+    subfile_name,
+    output,
+    check_src,
+    use_virtual_datasets,
+    num_threads,
+):
     """Combines volume data spread over multiple H5 files into a single file
 
     The typical use case is to combine volume data from multiple nodes into a
@@ -67,6 +96,10 @@ def combine_h5_vol_command(h5files, subfile_name, output, check_src):
     Note that this command does not currently combine volume data from different
     time steps (e.g. from multiple segments of a simulation). All input H5 files
     must contain the same set of observation IDs.
+
+    With '--virtual' no data is copied. Instead, the output file references
+    the data in the input files through HDF5 virtual datasets, which is much
+    faster and needs no extra disk space.
     """
     # Print available subfile names and exit
     if not subfile_name:
@@ -82,7 +115,14 @@ def combine_h5_vol_command(h5files, subfile_name, output, check_src):
     if not output.endswith(".h5"):
         output += ".h5"
 
-    spectre_h5.combine_h5(h5files, subfile_name, output, check_src)
+    spectre_h5.combine_h5(
+        h5files,
+        subfile_name,
+        output,
+        check_src,
+        use_virtual_datasets=use_virtual_datasets,
+        number_of_threads=num_threads,
+    )
 
 
 if __name__ == "__main__":
@@ -9,15 +9,19 @@
 #include <boost/iterator/transform_iterator.hpp>
 #include <cstddef>
 #include <hdf5.h>
+#include <map>
 #include <memory>
 #include <optional>
 #include <ostream>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/ExtendConnectivityHelpers.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
@@ -144,6 +148,76 @@ void append_element_extents_and_connectivity(
   }
 }
 
+// Write everything in an observation group except for the tensor data, i.e.
+// the grid names, extents, bases, quadratures, connectivity, and optionally the
+// serialized domain and functions of time.
+void write_grid_metadata(
+    const detail::OpenGroup& observation_group,
+    const std::vector<size_t>& total_extents, const std::string& grid_names,
+    const std::vector<int>& quadratures, const std::vector<int>& bases,
+    const std::vector<int>& total_connectivity,
+    const std::vector<int>& pole_connectivity,
+    const std::optional<std::vector<char>>& serialized_domain,
+    const std::optional<std::vector<char>>& serialized_functions_of_time) {
+  // Write the grid extents contiguously, the first `dim` belong to the
+  // First grid, the second `dim` belong to the second grid, and so on,
+  // Ordering is `x, y, z, ... `
+  h5::write_data(observation_group.id(), total_extents, {total_extents.size()},
+                 "total_extents");
+  // Write the names of the grids as vector of chars with individual names
+  // separated by `separator()`
+  std::vector<char> grid_names_as_chars(grid_names.begin(), grid_names.end());
+  h5::write_data(observation_group.id(), grid_names_as_chars,
+                 {grid_names_as_chars.size()}, "grid_names");
+  // Write the coded quadrature, along with the dictionary
+  const auto io_quadratures = Spectral::all_quadratures();
+  std::vector<std::string> quadrature_dict(io_quadratures.size());
+  alg::transform(io_quadratures, quadrature_dict.begin(),
+                 get_output<Spectral::Quadrature>);
+  h5_detail::write_dictionary("Quadrature dictionary", quadrature_dict,
+                              observation_group);
+  h5::write_data(observation_group.id(), quadratures, {quadratures.size()},
+                 "quadratures");
+  // Write the coded basis, along with the dictionary
+  const auto io_bases = Spectral::all_bases();
+  std::vector<std::string> basis_dict(io_bases.size());
+  alg::transform(io_bases, basis_dict.begin(), get_output<Spectral::Basis>);
+  h5_detail::write_dictionary("Basis dictionary", basis_dict,
+                              observation_group);
+  h5::write_data(observation_group.id(), bases, {bases.size()}, "bases");
+  // Write the Connectivity
+  h5::write_data(observation_group.id(), total_connectivity,
+                 {total_connectivity.size()}, "connectivity");
+  // Note: pole_connectivity stores extra connections that define triangles to
+  // fill in the poles on a Strahlkorper and is empty if not outputting
+  // Strahlkorper surface data. Because these connections define triangles
+  // and not quadrilaterals, they are stored separately instead of just being
+  // included in total_connectivity.
+  if (not pole_connectivity.empty()) {
+    h5::write_data(observation_group.id(), pole_connectivity,
+                   {pole_connectivity.size()}, "pole_connectivity");
+  }
+  // Write the serialized domain
+  if (serialized_domain.has_value()) {
+    h5::write_data(observation_group.id(), *serialized_domain,
+                   {serialized_domain->size()}, "domain");
+  }
+  // Write the serialized functions of time
+  if (serialized_functions_of_time.has_value()) {
+    h5::write_data(observation_group.id(), *serialized_functions_of_time,
+                   {serialized_functions_of_time->size()}, "functions_of_time");
+  }
+}
+
+// The absolute path of an HDF5 object inside its file
+std::string object_path(const hid_t object_id) {
+  const ssize_t name_size = H5Iget_name(object_id, nullptr, 0);
+  CHECK_H5(name_size, "Failed to get the size of the object name");
+  std::string name(static_cast<size_t>(name_size), '\0');
+  CHECK_H5(H5Iget_name(object_id, name.data(), name.size() + 1),
+           "Failed to get the object name");
+  return name;
+}
 }  // namespace
 
 VolumeData::VolumeData(const bool subfile_exists, detail::OpenGroup&& group,
@@ -311,53 +385,154 @@ void VolumeData::write_volume_data(
   }  // for each component
   grid_names.pop_back();
 
-  // Write the grid extents contiguously, the first `dim` belong to the
-  // First grid, the second `dim` belong to the second grid, and so on,
-  // Ordering is `x, y, z, ... `
-  h5::write_data(observation_group.id(), total_extents, {total_extents.size()},
-                 "total_extents");
-  // Write the names of the grids as vector of chars with individual names
-  // separated by `separator()`
-  std::vector<char> grid_names_as_chars(grid_names.begin(), grid_names.end());
-  h5::write_data(observation_group.id(), grid_names_as_chars,
-                 {grid_names_as_chars.size()}, "grid_names");
-  // Write the coded quadrature, along with the dictionary
-  const auto io_quadratures = Spectral::all_quadratures();
-  std::vector<std::string> quadrature_dict(io_quadratures.size());
-  alg::transform(io_quadratures, quadrature_dict.begin(),
-                 get_output<Spectral::Quadrature>);
-  h5_detail::write_dictionary("Quadrature dictionary", quadrature_dict,
-                              observation_group);
-  h5::write_data(observation_group.id(), quadratures, {quadratures.size()},
-                 "quadratures");
-  // Write the coded basis, along with the dictionary
-  const auto io_bases = Spectral::all_bases();
-  std::vector<std::string> basis_dict(io_bases.size());
-  alg::transform(io_bases, basis_dict.begin(), get_output<Spectral::Basis>);
-  h5_detail::write_dictionary("Basis dictionary", basis_dict,
-                              observation_group);
-  h5::write_data(observation_group.id(), bases, {bases.size()}, "bases");
-  // Write the Connectivity
-  h5::write_data(observation_group.id(), total_connectivity,
-                 {total_connectivity.size()}, "connectivity");
-  // Note: pole_connectivity stores extra connections that define triangles to
-  // fill in the poles on a Strahlkorper and is empty if not outputting
-  // Strahlkorper surface data. Because these connections define triangles
-  // and not quadrilaterals, they are stored separately instead of just being
-  // included in total_connectivity.
-  if (not pole_connectivity.empty()) {
-    h5::write_data(observation_group.id(), pole_connectivity,
-                   {pole_connectivity.size()}, "pole_connectivity");
+  write_grid_metadata(observation_group, total_extents, grid_names,
+                      quadratures, bases, total_connectivity, pole_connectivity,
+                      serialized_domain, serialized_functions_of_time);
+}
+
+void VolumeData::write_virtual_volume_data(
+    const size_t observation_id,
+    const std::vector<std::string>& source_file_names,
+    const std::vector<const VolumeData*>& source_volume_files) {
+  ASSERT(not source_volume_files.empty(),
+         "Need at least one source volume file to write virtual data.");
+  ASSERT(source_file_names.size() == source_volume_files.size(),
+         "Got " << source_file_names.size() << " source file names but "
+                << source_volume_files.size() << " source volume files.");
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  const VolumeData& first_source = *source_volume_files.front();
+  detail::OpenGroup observation_group(volume_data_group_.id(), path,
+                                      AccessType::ReadWrite);
+  if (contains_attribute(observation_group.id(), "", "observation_value")) {
+    ERROR_NO_TRACE("Trying to write ObservationId "
+                   << std::to_string(observation_id)
+                   << " which already exists in file at " << path
+                   << ". Did you forget to clean up after an earlier run?");
   }
-  // Write the serialized domain
-  if (serialized_domain.has_value()) {
-    h5::write_data(observation_group.id(), *serialized_domain,
-                   {serialized_domain->size()}, "domain");
+  h5::write_to_attribute(observation_group.id(), "observation_value",
+                         first_source.get_observation_value(observation_id));
+  if (not contains_attribute(volume_data_group_.id(), "", "dimension")) {
+    h5::write_to_attribute(
+        volume_data_group_.id(), "dimension",
+        h5::read_value_attribute<size_t>(first_source.volume_data_group_.id(),
+                                         "dimension"));
   }
-  // Write the serialized functions of time
-  if (serialized_functions_of_time.has_value()) {
-    h5::write_data(observation_group.id(), *serialized_functions_of_time,
-                   {serialized_functions_of_time->size()}, "functions_of_time");
+
+  // Concatenate the grid metadata of all sources. The bases and quadratures
+  // are decoded and encoded again in case the sources were written with
+  // different dictionaries. The connectivity is offset by the number of points
+  // in the preceding sources.
+  std::vector<size_t> total_extents{};
+  std::string grid_names{};
+  std::vector<int> quadratures{};
+  std::vector<int> bases{};
+  std::vector<int> total_connectivity{};
+  std::vector<int> pole_connectivity{};
+  std::vector<hsize_t> number_of_points_per_source{};
+  number_of_points_per_source.reserve(source_volume_files.size());
+  int total_points_so_far = 0;
+  for (const VolumeData* source : source_volume_files) {
+    const detail::OpenGroup source_group(source->volume_data_group_.id(), path,
+                                         AccessType::ReadOnly);
+    const auto source_extents = h5::read_data<1, std::vector<size_t>>(
+        source_group.id(), "total_extents");
+    total_extents.insert(total_extents.end(), source_extents.begin(),
+                         source_extents.end());
+    for (const auto& grid_name : source->get_grid_names(observation_id)) {
+      grid_names += grid_name + h5::VolumeData::separator();
+    }
+    for (const auto& element_bases : source->get_bases(observation_id)) {
+      alg::transform(element_bases, std::back_inserter(bases),
+                     [](const Spectral::Basis t) {
+                       return static_cast<int>(static_cast<uint8_t>(t) >>
+                                               Spectral::basis_shift);
+                     });
+    }
+    for (const auto& element_quadratures :
+         source->get_quadratures(observation_id)) {
+      alg::transform(
+          element_quadratures, std::back_inserter(quadratures),
+          [](const Spectral::Quadrature t) { return static_cast<int>(t); });
+    }
+    const auto source_connectivity =
+        h5::read_data<1, std::vector<int>>(source_group.id(), "connectivity");
+    alg::transform(source_connectivity, std::back_inserter(total_connectivity),
+                   [&total_points_so_far](const int index) {
+                     return index + total_points_so_far;
+                   });
+    if (contains_dataset_or_group(source_group.id(), "", "pole_connectivity")) {
+      const auto source_pole_connectivity = h5::read_data<1, std::vector<int>>(
+          source_group.id(), "pole_connectivity");
+      alg::transform(source_pole_connectivity,
+                     std::back_inserter(pole_connectivity),
+                     [&total_points_so_far](const int index) {
+                       return index + total_points_so_far;
+                     });
+    }
+    size_t number_of_points = 0;
+    for (const auto& extents : source->get_extents(observation_id)) {
+      number_of_points += alg::accumulate(extents, 1_st, std::multiplies<>{});
+    }
+    number_of_points_per_source.push_back(number_of_points);
+    total_points_so_far += static_cast<int>(number_of_points);
+  }
+  grid_names.pop_back();
+  write_grid_metadata(observation_group, total_extents, grid_names,
+                      quadratures, bases, total_connectivity, pole_connectivity,
+                      first_source.get_domain(observation_id),
+                      first_source.get_functions_of_time(observation_id));
+
+  // Map the contiguous data of each source into consecutive ranges of a
+  // virtual dataset for each tensor component
+  const detail::OpenGroup first_source_group(
+      first_source.volume_data_group_.id(), path, AccessType::ReadOnly);
+  const std::string source_observation_path =
+      object_path(first_source_group.id()) + "/";
+  const hsize_t total_number_of_points =
+      static_cast<hsize_t>(total_points_so_far);
+  for (const std::string& component_name :
+       first_source.list_tensor_components(observation_id)) {
+    const hid_t source_dataset_id =
+        h5::open_dataset(first_source_group.id(), component_name);
+    const hid_t data_type = H5Dget_type(source_dataset_id);
+    CHECK_H5(data_type, "Failed to get the data type of '" << component_name
+                                                           << "'");
+    h5::close_dataset(source_dataset_id);
+
+    const hid_t virtual_space_id =
+        H5Screate_simple(1, &total_number_of_points, nullptr);
+    CHECK_H5(virtual_space_id, "Failed to create virtual dataspace");
+    const hid_t property_list_id = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK_H5(property_list_id, "Failed to create dataset property list");
+    hsize_t offset = 0;
+    for (size_t i = 0; i < source_file_names.size(); ++i) {
+      const hsize_t count = number_of_points_per_source[i];
+      const hid_t source_space_id = H5Screate_simple(1, &count, nullptr);
+      CHECK_H5(source_space_id, "Failed to create source dataspace");
+      CHECK_H5(H5Sselect_hyperslab(virtual_space_id, H5S_SELECT_SET, &offset,
+                                   nullptr, &count, nullptr),
+               "Failed to select hyperslab for source " << i);
+      CHECK_H5(H5Pset_virtual(property_list_id, virtual_space_id,
+                              source_file_names[i].c_str(),
+                              (source_observation_path + component_name).c_str(),
+                              source_space_id),
+               "Failed to map '" << component_name << "' in '"
+                                 << source_file_names[i]
+                                 << "' into virtual dataset");
+      CHECK_H5(H5Sclose(source_space_id), "Failed to close source dataspace");
+      offset += count;
+    }
+    CHECK_H5(H5Sselect_all(virtual_space_id), "Failed to select dataspace");
+    const hid_t dataset_id =
+        H5Dcreate2(observation_group.id(), component_name.c_str(), data_type,
+                   virtual_space_id, H5P_DEFAULT, property_list_id,
+                   H5P_DEFAULT);
+    CHECK_H5(dataset_id,
+             "Failed to create virtual dataset '" << component_name << "'");
+    h5::close_dataset(dataset_id);
+    CHECK_H5(H5Pclose(property_list_id), "Failed to close property list");
+    CHECK_H5(H5Sclose(virtual_space_id), "Failed to close virtual dataspace");
+    CHECK_H5(H5Tclose(data_type), "Failed to close data type");
   }
 }
 
@@ -365,15 +540,16 @@ void VolumeData::write_volume_data(
 template <size_t SpatialDim>
 void VolumeData::extend_connectivity_data(
     const std::vector<size_t>& observation_ids) {
+  using Layout = std::tuple<std::vector<std::string>,
+                            std::vector<std::vector<Spectral::Basis>>,
+                            std::vector<std::vector<Spectral::Quadrature>>,
+                            std::vector<std::vector<size_t>>>;
+  // The path of the first observation with each layout, which holds the
+  // connectivity that later observations with the same layout link to
+  std::map<Layout, std::string> path_of_layout{};
   for (const size_t& obs_id : observation_ids) {
-    auto grid_names = get_grid_names(obs_id);
-    auto extents = get_extents(obs_id);
-    auto bases = get_bases(obs_id);
-    auto quadratures = get_quadratures(obs_id);
-
-    const std::vector<int>& new_connectivity =
-        h5::detail::extend_connectivity<SpatialDim>(grid_names, bases,
-                                                    quadratures, extents);
+    Layout layout{get_grid_names(obs_id), get_bases(obs_id),
+                  get_quadratures(obs_id), get_extents(obs_id)};
 
     // Deletes the existing connectivity and replaces it with the new one
     const std::string path = "ObservationId" + std::to_string(obs_id);
@@ -381,7 +557,20 @@ void VolumeData::extend_connectivity_data(
                                         AccessType::ReadWrite);
     const hid_t group_id = observation_group.id();
     delete_connectivity(group_id);
+    const auto existing_layout = path_of_layout.find(layout);
+    if (existing_layout != path_of_layout.end()) {
+      const detail::OpenGroup source_group(volume_data_group_.id(),
+                                           existing_layout->second,
+                                           AccessType::ReadOnly);
+      link_connectivity(group_id, source_group.id());
+      continue;
+    }
+    auto& [grid_names, bases, quadratures, extents] = layout;
+    const std::vector<int> new_connectivity =
+        h5::detail::extend_connectivity<SpatialDim>(grid_names, bases,
+                                                    quadratures, extents);
     write_connectivity(group_id, new_connectivity);
+    path_of_layout.emplace(std::move(layout), path);
   }
 }
 
@@ -583,79 +772,85 @@ auto VolumeData::get_data_by_element(
 
   // Retrieve element data and insert into result
   for (auto& single_time_data : result) {
-    const auto known_components =
-        list_tensor_components(std::get<0>(single_time_data));
-
-    std::vector<ElementVolumeData> element_volume_data{};
-    const auto grid_names = get_grid_names(std::get<0>(single_time_data));
-    const auto extents = get_extents(std::get<0>(single_time_data));
-    const auto bases = get_bases(std::get<0>(single_time_data));
-    const auto quadratures = get_quadratures(std::get<0>(single_time_data));
-    element_volume_data.reserve(grid_names.size());
-
-    const auto& component_names =
-        components_to_retrieve.value_or(known_components);
-    std::vector<TensorComponent> tensors{};
-    tensors.reserve(grid_names.size());
-    for (const std::string& component : component_names) {
-      if (not alg::found(known_components, component)) {
-        using ::operator<<;  // STL streams
-        ERROR("Could not find tensor component '"
-              << component
-              << "' in file. Known components are: " << known_components);
-      }
-      tensors.emplace_back(
-          get_tensor_component(std::get<0>(single_time_data), component));
-    }
-    // Now split the data by element
-    for (size_t grid_index = 0, offset = 0; grid_index < grid_names.size();
-         ++grid_index) {
-      const size_t mesh_size =
-          alg::accumulate(extents[grid_index], 1_st, std::multiplies<>{});
-      std::vector<TensorComponent> tensor_components{tensors.size()};
-      for (size_t component_index = 0; component_index < tensors.size();
-           ++component_index) {
-        std::visit(
-            [component_index, &component_names, mesh_size, offset,
-             &tensor_components](const auto& tensor_component_data) {
-              std::decay_t<decltype(tensor_component_data)> component(
-                  mesh_size);
-              std::copy(
-                  std::next(tensor_component_data.begin(),
-                            static_cast<std::ptrdiff_t>(offset)),
-                  std::next(tensor_component_data.begin(),
-                            static_cast<std::ptrdiff_t>(offset + mesh_size)),
-                  component.begin());
-              tensor_components[component_index] = TensorComponent{
-                  component_names[component_index], std::move(component)};
-            },
-            tensors[component_index].data);
-      }
-
-      // Sort the tensor components by name so that they are in the same order
-      // in all elements.
-      alg::sort(tensor_components, [](const auto& lhs, const auto& rhs) {
-        return lhs.name < rhs.name;
-      });
-
-      element_volume_data.emplace_back(
-          grid_names[grid_index], std::move(tensor_components),
-          extents[grid_index], bases[grid_index], quadratures[grid_index]);
-      offset += mesh_size;
-    }  // for grid_index
-
-    // Sort the elements so they are in the same order at all time steps
-    alg::sort(element_volume_data,
-              [](const ElementVolumeData& lhs, const ElementVolumeData& rhs) {
-                return lhs.element_name < rhs.element_name;
-              });
-    std::get<2>(single_time_data) = std::move(element_volume_data);
+    std::get<2>(single_time_data) = get_observation_data_by_element(
+        std::get<0>(single_time_data), components_to_retrieve);
   }
   return result;
 }
 
+std::vector<ElementVolumeData> VolumeData::get_observation_data_by_element(
+    const size_t observation_id,
+    const std::optional<std::vector<std::string>>& components_to_retrieve)
+    const {
+  const auto known_components = list_tensor_components(observation_id);
+
+  std::vector<ElementVolumeData> element_volume_data{};
+  const auto grid_names = get_grid_names(observation_id);
+  const auto extents = get_extents(observation_id);
+  const auto bases = get_bases(observation_id);
+  const auto quadratures = get_quadratures(observation_id);
+  element_volume_data.reserve(grid_names.size());
+
+  const auto& component_names =
+      components_to_retrieve.value_or(known_components);
+  std::vector<TensorComponent> tensors{};
+  tensors.reserve(grid_names.size());
+  for (const std::string& component : component_names) {
+    if (not alg::found(known_components, component)) {
+      using ::operator<<;  // STL streams
+      ERROR("Could not find tensor component '"
+            << component
+            << "' in file. Known components are: " << known_components);
+    }
+    tensors.emplace_back(get_tensor_component(observation_id, component));
+  }
+  // Now split the data by element
+  for (size_t grid_index = 0, offset = 0; grid_index < grid_names.size();
+       ++grid_index) {
+    const size_t mesh_size =
+        alg::accumulate(extents[grid_index], 1_st, std::multiplies<>{});
+    std::vector<TensorComponent> tensor_components{tensors.size()};
+    for (size_t component_index = 0; component_index < tensors.size();
+         ++component_index) {
+      std::visit(
+          [component_index, &component_names, mesh_size, offset,
+           &tensor_components](const auto& tensor_component_data) {
+            std::decay_t<decltype(tensor_component_data)> component(
+                mesh_size);
+            std::copy(
+                std::next(tensor_component_data.begin(),
+                          static_cast<std::ptrdiff_t>(offset)),
+                std::next(tensor_component_data.begin(),
+                          static_cast<std::ptrdiff_t>(offset + mesh_size)),
+                component.begin());
+            tensor_components[component_index] = TensorComponent{
+                component_names[component_index], std::move(component)};
+          },
+          tensors[component_index].data);
+    }
+
+    // Sort the tensor components by name so that they are in the same order
+    // in all elements.
+    alg::sort(tensor_components, [](const auto& lhs, const auto& rhs) {
+      return lhs.name < rhs.name;
+    });
+
+    element_volume_data.emplace_back(
+        grid_names[grid_index], std::move(tensor_components),
+        extents[grid_index], bases[grid_index], quadratures[grid_index]);
+    offset += mesh_size;
+  }  // for grid_index
+
+  // Sort the elements so they are in the same order at all time steps
+  alg::sort(element_volume_data,
+            [](const ElementVolumeData& lhs, const ElementVolumeData& rhs) {
+              return lhs.element_name < rhs.element_name;
+            });
+  return element_volume_data;
+}
+
 size_t VolumeData::get_dimension() const {
-  return h5::read_value_attribute<double>(volume_data_group_.id(), "dimension");
+  return h5::read_value_attribute<size_t>(volume_data_group_.id(), "dimension");
 }
 
 std::vector<std::vector<Spectral::Basis>> VolumeData::get_bases(
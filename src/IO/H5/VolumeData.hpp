@@ -119,9 +119,35 @@ class VolumeData : public h5::Object {
       const std::optional<std::vector<char>>& serialized_functions_of_time =
           std::nullopt);
 
+  /*!
+   * \brief Insert the observation `observation_id` of all
+   * `source_volume_files` without copying the tensor data.
+   *
+   * Each tensor component is written as an HDF5 virtual dataset that maps the
+   * contiguous data of each source into consecutive ranges, in the order of the
+   * `source_volume_files`. The grid names, extents, bases, quadratures and
+   * connectivity are small, so they are concatenated and written as regular
+   * datasets. The observation value, domain and functions of time are taken
+   * from the first source.
+   *
+   * The `source_file_names` are the paths of the H5 files that hold the
+   * `source_volume_files`. They are stored in the virtual datasets, so the
+   * source files must stay in place for the data to remain readable. All
+   * sources must have the subfile at the same path as the first source.
+   */
+  void write_virtual_volume_data(
+      size_t observation_id, const std::vector<std::string>& source_file_names,
+      const std::vector<const VolumeData*>& source_volume_files);
+
   /// Overwrites the current connectivity dataset with a new one. This new
   /// connectivity dataset builds connectivity within each block in the domain
-  /// for each observation id in a list of observation id's
+  /// for each observation id in a list of observation id's.
+  ///
+  /// The connectivity is computed and written only once for each distinct
+  /// element layout (grid names, extents, bases, and quadratures). Later
+  /// observations with the same layout share the dataset of the first one
+  /// through a hard link, which keeps the file small and lets visualization
+  /// tools load the topology only once.
   template <size_t SpatialDim>
   void extend_connectivity_data(const std::vector<size_t>& observation_ids);
 
@@ -194,6 +220,15 @@ class VolumeData : public h5::Object {
       -> std::vector<
           std::tuple<size_t, double, std::vector<ElementVolumeData>>>;
 
+  /// Retrieve volume data at the integral observation id `observation_id`,
+  /// sorted by the elements' name string.
+  ///
+  /// If `components_to_retrieve` is `std::nullopt` then return all components.
+  std::vector<ElementVolumeData> get_observation_data_by_element(
+      size_t observation_id,
+      const std::optional<std::vector<std::string>>& components_to_retrieve =
+          std::nullopt) const;
+
   /// Read the dimensionality of the grids.  Note : This is the dimension of
   /// the grids as manifolds, not the dimension of the embedding space.  For
   /// example, the volume data of a sphere is 2-dimensional, even though
@@ -68,8 +68,9 @@ struct InitializeWriter {
   using simple_tags = tmpl::append<
       tmpl::list<Tags::ExpectedContributorsForObservations,
                  Tags::ContributorsOfReductionData, Tags::ReductionDataLock,
-                 Tags::ContributorsOfTensorData, Tags::VolumeDataLock,
-                 Tags::TensorData, Tags::InterpolatorTensorData,
+                 Tags::ReductionDataToSend, Tags::ContributorsOfTensorData,
+                 Tags::VolumeDataLock, Tags::TensorData,
+                 Tags::InterpolatorTensorData,
                  Tags::NodesExpectedToContributeReductions,
                  Tags::NodesThatContributedReductions, Tags::H5FileLock>,
       typename Metavariables::observed_reduction_data_tags,
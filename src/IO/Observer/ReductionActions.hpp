@@ -3,12 +3,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
+#include <iterator>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <tuple>
+#include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -30,6 +35,7 @@
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "Parallel/Reduction.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GetOutput.hpp"
@@ -38,9 +44,11 @@
 #include "Utilities/ProtocolHelpers.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
 #include "Utilities/StdHelpers.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateGetStaticMemberVariableOrDefault.hpp"
 
 namespace observers {
 
@@ -52,6 +60,7 @@ struct ObserverWriter;
 namespace ThreadedActions {
 /// \cond
 struct CollectReductionDataOnNode;
+struct WriteCombinedReductionData;
 struct WriteReductionData;
 /// \endcond
 }  // namespace ThreadedActions
@@ -256,11 +265,108 @@ void write_data(const std::string& subfile_name,
       subfile_name, std::move(legend), version_number);
   time_series_file.append(data_to_append);
 }
+
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(combine_observer_reductions)
+
+template <typename Metavariables>
+constexpr bool combine_observer_reductions_v =
+    get_combine_observer_reductions_or_default_v<Metavariables, false>;
+
+// The arguments of `WriteReductionData` that are serialized while they wait in
+// `Tags::ReductionDataToSend` to be sent to node 0
+template <typename ReductionData, typename Formatter>
+using write_reduction_data_arguments =
+    std::tuple<observers::ObservationId, size_t, std::string,
+               std::vector<std::string>, ReductionData,
+               std::optional<Formatter>>;
+
+template <typename Metavariables>
+using WriteReductionDataFunction =
+    void (*)(Parallel::GlobalCache<Metavariables>&, const std::vector<char>&);
+
+// The functions that forward serialized reduction data to
+// `WriteReductionData`, keyed by an identifier of the reduction data type.
+// The serialized data carries only the identifier, so node 0 can restore the
+// type of the data it receives in a combined message.
+template <typename Metavariables>
+std::unordered_map<size_t, WriteReductionDataFunction<Metavariables>>&
+write_reduction_data_functions() {
+  static std::unordered_map<size_t, WriteReductionDataFunction<Metavariables>>
+      functions{};
+  return functions;
+}
+
+template <typename Metavariables, typename ReductionData, typename Formatter>
+void forward_to_write_reduction_data(
+    Parallel::GlobalCache<Metavariables>& cache,
+    const std::vector<char>& serialized_arguments) {
+  auto arguments =
+      deserialize<write_reduction_data_arguments<ReductionData, Formatter>>(
+          serialized_arguments.data());
+  std::apply(
+      [&cache](auto&&... args) {
+        Parallel::threaded_action<WriteReductionData>(
+            Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+                cache)[0],
+            std::move(args)...);
+      },
+      std::move(arguments));
+}
+
+// Registers `forward_to_write_reduction_data` during static initialization
+// so it is known on all nodes, similar to `Parallel::RegisterReducerFunction`.
+// The identifier is a hash of the mangled type name, which is the same on all
+// nodes since they run the same executable.
+template <typename Metavariables, typename ReductionData, typename Formatter>
+struct RegisterWriteReductionDataFunction {
+  static size_t id() {
+    return std::hash<std::string>{}(
+        typeid(write_reduction_data_arguments<ReductionData, Formatter>)
+            .name());
+  }
+  static const bool registered;
+};
+
+template <typename Metavariables, typename ReductionData, typename Formatter>
+const bool RegisterWriteReductionDataFunction<Metavariables, ReductionData,
+                                              Formatter>::registered = []() {
+  const auto [it, inserted] =
+      write_reduction_data_functions<Metavariables>().emplace(
+          id(), &forward_to_write_reduction_data<Metavariables, ReductionData,
+                                                 Formatter>);
+  if (UNLIKELY(not inserted and
+               it->second !=
+                   &forward_to_write_reduction_data<Metavariables,
+                                                    ReductionData,
+                                                    Formatter>)) {
+    ERROR("Hash collision between reduction data types "
+          << pretty_type::get_name<ReductionData>());
+  }
+  return true;
+}();
 }  // namespace ReductionActions_detail
 
 /*!
  * \brief Gathers all the reduction data from all processing elements/cores on a
  * node.
+ *
+ * Once all data for an `ObservationId` has arrived, the combined data is sent
+ * to `WriteReductionData` on node 0. If
+ * `Metavariables::combine_observer_reductions` is `true`, nodes other than
+ * node 0 instead queue the data in `Tags::ReductionDataToSend`. Once no
+ * other reduction for the same observation value (i.e. the same time) is still
+ * being collected on the node, all queued data is sent to node 0 in one
+ * `WriteCombinedReductionData` message. This way all reductions of one time,
+ * e.g. from several observation events that run at the same time, reach node
+ * 0 in a single message per node.
+ *
+ * The observation value is all that is compared, so reductions of unrelated
+ * observations that happen to share a value (e.g. iteration numbers of
+ * different elliptic solvers) can also hold each other's data back. To bound
+ * this, queued data is also sent as soon as reduction data for a different
+ * observation value arrives on the node. Combining reductions is therefore
+ * only worthwhile when the observation values are times that all observations
+ * on the node progress through together, as in an evolution.
  */
 struct CollectReductionDataOnNode {
  public:
@@ -296,6 +402,8 @@ struct CollectReductionDataOnNode {
     std::unordered_map<observers::ObservationId,
                        std::unordered_set<Parallel::ArrayComponentId>>*
         reduction_observers_contributed = nullptr;
+    std::pair<double, std::vector<std::pair<size_t, std::vector<char>>>>*
+        reduction_data_to_send = nullptr;
     Parallel::NodeLock* reduction_data_lock = nullptr;
     Parallel::NodeLock* reduction_file_lock = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
@@ -304,12 +412,12 @@ struct CollectReductionDataOnNode {
       const std::lock_guard hold_lock(*node_lock);
       db::mutate<Tags::ReductionData<ReductionDatums...>,
                  Tags::ReductionDataNames<ReductionDatums...>,
-                 Tags::ContributorsOfReductionData, Tags::ReductionDataLock,
-                 Tags::H5FileLock>(
+                 Tags::ContributorsOfReductionData, Tags::ReductionDataToSend,
+                 Tags::ReductionDataLock, Tags::H5FileLock>(
           [&reduction_data, &reduction_names_map,
-           &reduction_observers_contributed, &reduction_data_lock,
-           &reduction_file_lock, &observation_id, &observer_group_id,
-           &observations_registered_with_id](
+           &reduction_observers_contributed, &reduction_data_to_send,
+           &reduction_data_lock, &reduction_file_lock, &observation_id,
+           &observer_group_id, &observations_registered_with_id](
               const gsl::not_null<std::unordered_map<
                   observers::ObservationId,
                   Parallel::ReductionData<ReductionDatums...>>*>
@@ -321,6 +429,9 @@ struct CollectReductionDataOnNode {
                   observers::ObservationId,
                   std::unordered_set<Parallel::ArrayComponentId>>*>
                   reduction_observers_contributed_ptr,
+              const gsl::not_null<std::pair<
+                  double, std::vector<std::pair<size_t, std::vector<char>>>>*>
+                  reduction_data_to_send_ptr,
               const gsl::not_null<Parallel::NodeLock*> reduction_data_lock_ptr,
               const gsl::not_null<Parallel::NodeLock*> reduction_file_lock_ptr,
               const std::unordered_map<
@@ -340,6 +451,7 @@ struct CollectReductionDataOnNode {
             reduction_names_map = &*reduction_names_map_ptr;
             reduction_observers_contributed =
                 &*reduction_observers_contributed_ptr;
+            reduction_data_to_send = &*reduction_data_to_send_ptr;
             reduction_data_lock = &*reduction_data_lock_ptr;
             reduction_file_lock = &*reduction_file_lock_ptr;
             observations_registered_with_id =
@@ -354,7 +466,11 @@ struct CollectReductionDataOnNode {
         "Failed to set observations_registered_with_id when mutating the "
         "DataBox. This is a bug in the code.");
 
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    const auto my_node =
+        Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy));
     bool send_data = false;
+    std::vector<std::pair<size_t, std::vector<char>>> combined_data{};
     // Now that we've retrieved pointers to the data in the DataBox we wish to
     // manipulate, lock the data and manipulate it.
     {
@@ -370,6 +486,16 @@ struct CollectReductionDataOnNode {
       }
       contributed_group_ids.insert(observer_group_id);
 
+      if constexpr (ReductionActions_detail::combine_observer_reductions_v<
+                        Metavariables>) {
+        // Don't hold back data of another observation value any longer, since
+        // this node has moved on to the value of this data.
+        if (my_node != 0 and not reduction_data_to_send->second.empty() and
+            reduction_data_to_send->first != observation_id.value()) {
+          combined_data = std::exchange(reduction_data_to_send->second, {});
+        }
+      }
+
       // If requested, write the intermediate reduction data from the particular
       // core to one file per node. This allows measuring reduction data
       // per-core, e.g. performance metrics to assess load balancing.
@@ -377,8 +503,6 @@ struct CollectReductionDataOnNode {
         auto reduction_data_this_core = received_reduction_data;
         reduction_data_this_core.finalize();
         auto reduction_names_this_core = reduction_names;
-        auto& my_proxy =
-            Parallel::get_parallel_component<ParallelComponent>(cache);
         const std::lock_guard hold_file_lock(*reduction_file_lock);
         ReductionActions_detail::write_data(
             "/Core" + std::to_string(observe_with_core_id.value()) +
@@ -387,8 +511,7 @@ struct CollectReductionDataOnNode {
             std::move(reduction_names_this_core),
             std::move(reduction_data_this_core.data()),
             Parallel::get<Tags::ReductionFileName>(cache) +
-                std::to_string(
-                    Parallel::my_node<int>(*Parallel::local_branch(my_proxy))),
+                std::to_string(my_node),
             std::make_index_sequence<sizeof...(ReductionDatums)>{});
       }
 
@@ -438,23 +561,113 @@ struct CollectReductionDataOnNode {
         reduction_observers_contributed->erase(observation_id);
         reduction_data->erase(observation_id);
         reduction_names_map->erase(observation_id);
+        if constexpr (ReductionActions_detail::combine_observer_reductions_v<
+                          Metavariables>) {
+          if (my_node != 0) {
+            send_data = false;
+            queue_reduction_data_to_send<Metavariables>(
+                make_not_null(&combined_data),
+                make_not_null(reduction_data_to_send),
+                *reduction_observers_contributed,
+                ReductionActions_detail::write_reduction_data_arguments<
+                    Parallel::ReductionData<ReductionDatums...>, Formatter>{
+                    observation_id, my_node, subfile_name,
+                    std::move(reduction_names),
+                    std::move(received_reduction_data), std::move(formatter)});
+          }
+        }
       }
     }
 
+    if (not combined_data.empty()) {
+      Parallel::threaded_action<WriteCombinedReductionData>(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache)[0],
+          std::move(combined_data));
+    }
     if (send_data) {
-      auto& my_proxy =
-          Parallel::get_parallel_component<ParallelComponent>(cache);
       Parallel::threaded_action<WriteReductionData>(
           Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
               cache)[0],
-          observation_id,
-          Parallel::my_node<size_t>(*Parallel::local_branch(my_proxy)),
-          subfile_name,
+          observation_id, my_node, subfile_name,
           // NOLINTNEXTLINE(bugprone-use-after-move)
           std::move(reduction_names), std::move(received_reduction_data),
           std::move(formatter));
     }
   }
+
+ private:
+  // Queues the `arguments` in the `reduction_data_to_send` and moves all
+  // queued data to the end of `data_to_send` once no other reduction for the
+  // same observation value is being collected on this node anymore. Must be
+  // called while holding the reduction data lock.
+  template <typename Metavariables, typename ReductionData, typename Formatter>
+  static void queue_reduction_data_to_send(
+      const gsl::not_null<std::vector<std::pair<size_t, std::vector<char>>>*>
+          data_to_send,
+      const gsl::not_null<std::pair<
+          double, std::vector<std::pair<size_t, std::vector<char>>>>*>
+          reduction_data_to_send,
+      const std::unordered_map<observers::ObservationId,
+                               std::unordered_set<Parallel::ArrayComponentId>>&
+          reduction_observers_contributed,
+      ReductionActions_detail::write_reduction_data_arguments<
+          ReductionData, Formatter>&& arguments) {
+    using registrar =
+        ReductionActions_detail::RegisterWriteReductionDataFunction<
+            Metavariables, ReductionData, Formatter>;
+    (void)registrar::registered;
+    const double observation_value = std::get<0>(arguments).value();
+    ASSERT(reduction_data_to_send->second.empty() or
+               reduction_data_to_send->first == observation_value,
+           "Queued reduction data of observation value "
+               << reduction_data_to_send->first
+               << " should have been sent before queueing data of value "
+               << observation_value);
+    reduction_data_to_send->first = observation_value;
+    reduction_data_to_send->second.emplace_back(
+        registrar::id(),
+        serialize<ReductionActions_detail::write_reduction_data_arguments<
+            ReductionData, Formatter>>(arguments));
+    if (alg::any_of(reduction_observers_contributed,
+                    [&observation_value](const auto& id_and_contributors) {
+                      return id_and_contributors.first.value() ==
+                             observation_value;
+                    })) {
+      return;
+    }
+    std::move(reduction_data_to_send->second.begin(),
+              reduction_data_to_send->second.end(),
+              std::back_inserter(*data_to_send));
+    reduction_data_to_send->second.clear();
+  }
+};
+
+/*!
+ * \ingroup ObserversGroup
+ * \brief Receive the reduction data that another node combined in
+ * `CollectReductionDataOnNode` and pass each entry on to `WriteReductionData`.
+ */
+struct WriteCombinedReductionData {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(
+      db::DataBox<DbTagsList>& /*box*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+      std::vector<std::pair<size_t, std::vector<char>>>&& combined_data) {
+    const auto& functions =
+        ReductionActions_detail::write_reduction_data_functions<
+            Metavariables>();
+    for (const auto& [id, serialized_arguments] : combined_data) {
+      const auto function = functions.find(id);
+      if (UNLIKELY(function == functions.end())) {
+        ERROR("Received reduction data of an unknown type with id " << id);
+      }
+      function->second(cache, serialized_arguments);
+    }
+  }
 };
 
 /*!
@@ -11,6 +11,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
@@ -81,6 +82,20 @@ struct ReductionDataLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
 
+/// \brief Reduction data that this node has finished collecting and that waits
+/// to be sent to node 0 in one combined message.
+///
+/// Holds the observation value of the queued data, which is the same for all
+/// entries, and the entries themselves. Each entry holds the identifier of the
+/// function that forwards the data to
+/// `observers::ThreadedActions::WriteReductionData` on node 0, and the
+/// serialized arguments for that function. Only used if
+/// `Metavariables::combine_observer_reductions` is `true`.
+struct ReductionDataToSend : db::SimpleTag {
+  using type =
+      std::pair<double, std::vector<std::pair<size_t, std::vector<char>>>>;
+};
+
 /// \brief The set of `ArrayComponentId` that have contributed to each
 /// `ObservationId` for volume observation
 ///
@@ -10,13 +10,12 @@
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Filtering.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/OperatorCache.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Options/Options.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
-#include "Utilities/Literals.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
-#include "Utilities/StaticCache.hpp"
 
 namespace Filters {
 
@@ -58,21 +57,13 @@ const Matrix& Exponential<FilterIndex>::filter_matrix(
              << ".\nUse a different FilterIndex if you need a filter with new "
                 "parameters\n");
 
-  const static auto cache = make_static_cache<
-      CacheRange<1_st,
-                 Spectral::maximum_number_of_points<Spectral::Basis::Legendre> +
-                     1>,
-      CacheEnumeration<Spectral::Basis, Spectral::Basis::Legendre,
-                       Spectral::Basis::Chebyshev>,
-      CacheEnumeration<Spectral::Quadrature, Spectral::Quadrature::Gauss,
-                       Spectral::Quadrature::GaussLobatto>>(
-      [alpha = alpha_, half_power = half_power_](
-          const size_t extents, const Spectral::Basis basis,
-          const Spectral::Quadrature quadrature) {
-        return Spectral::filtering::exponential_filter(
-            Mesh<1>{extents, basis, quadrature}, alpha, half_power);
+  // The filter parameters are fixed for each `FilterIndex`, so the index
+  // identifies the filter matrix together with the mesh.
+  return Spectral::cached_operator(
+      {"ExponentialFilter", mesh, mesh, FilterIndex},
+      [&mesh, alpha = alpha_, half_power = half_power_]() {
+        return Spectral::filtering::exponential_filter(mesh, alpha, half_power);
       });
-  return cache(mesh.extents(0), mesh.basis(0), mesh.quadrature(0));
 }
 
 template <size_t FilterIndex>
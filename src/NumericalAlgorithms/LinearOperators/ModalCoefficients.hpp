@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions and tags for the modal coefficients of tensors.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
+#include "DataStructures/Tensor/Metafunctions.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace domain::Tags {
+template <size_t Dim>
+struct Mesh;
+}  // namespace domain::Tags
+/// \endcond
+
+/*!
+ * \ingroup SpectralGroup
+ * \brief Compute the modal coefficients of all components of a tensor
+ *
+ * \see to_modal_coefficients(gsl::not_null<ModalVector*>, const DataVector&,
+ * const Mesh<Dim>&)
+ */
+template <size_t Dim, typename Symm, typename IndexList>
+void to_modal_coefficients(
+    const gsl::not_null<Tensor<ModalVector, Symm, IndexList>*>
+        modal_coefficients,
+    const Tensor<DataVector, Symm, IndexList>& nodal_coefficients,
+    const Mesh<Dim>& mesh) {
+  for (size_t i = 0; i < nodal_coefficients.size(); ++i) {
+    to_modal_coefficients(make_not_null(&(*modal_coefficients)[i]),
+                          nodal_coefficients[i], mesh);
+  }
+}
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \brief The modal coefficients of all components of the tensor `Tag`
+template <typename Tag>
+struct ModalCoefficients : db::PrefixTag, db::SimpleTag {
+  using tag = Tag;
+  using type = TensorMetafunctions::swap_type<ModalVector, typename Tag::type>;
+};
+
+/*!
+ * \ingroup DataBoxTagsGroup
+ * \brief Compute the modal coefficients of the tensor `Tag`
+ *
+ * Several consumers within a step need the modal coefficients of the same
+ * nodal fields, e.g. power monitors and the AMR truncation error criterion.
+ * Adding this compute tag to the DataBox of an element lets them share a
+ * single transformation: the DataBox recomputes the modal coefficients lazily
+ * only when `Tag` or the mesh change, i.e. at most once per (sub)step. Code
+ * that can make use of the modal coefficients checks if
+ * `Tags::ModalCoefficients<Tag>` is retrievable from the DataBox and computes
+ * the coefficients itself otherwise.
+ */
+template <typename Tag, size_t Dim>
+struct ModalCoefficientsCompute : ModalCoefficients<Tag>, db::ComputeTag {
+  using base = ModalCoefficients<Tag>;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<Tag, domain::Tags::Mesh<Dim>>;
+  static void function(const gsl::not_null<return_type*> result,
+                       const typename Tag::type& tensor,
+                       const Mesh<Dim>& mesh) {
+    to_modal_coefficients(result, tensor, mesh);
+  }
+};
+}  // namespace Tags
@@ -12,6 +12,7 @@
 
 /// \cond
 class DataVector;
+class ModalVector;
 /// \endcond
 
 /*!
@@ -35,11 +36,19 @@ namespace PowerMonitors {
  * where \f$ C_{k_0,k_1,k_2}\f$ are the modal coefficients
  * of variable \f$ \psi \f$.
  *
+ * The overload taking a `ModalVector` computes the power monitors from modal
+ * coefficients that are already available, e.g. from
+ * `Tags::ModalCoefficients`, and so avoids transforming the data again.
  */
 template <size_t Dim>
 void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
                     const DataVector& u, const Mesh<Dim>& mesh);
 
+template <size_t Dim>
+void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
+                    const ModalVector& modal_coefficients,
+                    const Mesh<Dim>& mesh);
+
 template <size_t Dim>
 std::array<DataVector, Dim> power_monitors(const DataVector& u,
                                            const Mesh<Dim>& mesh);
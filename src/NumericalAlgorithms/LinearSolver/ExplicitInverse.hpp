@@ -4,10 +4,13 @@
 #pragma once
 
 #include <algorithm>
+#include <boost/functional/hash.hpp>
 #include <cstddef>
 #include <fstream>
+#include <optional>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -24,6 +27,7 @@
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/NoSuchType.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/Serialization/PersistentCache.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -72,6 +76,12 @@ using ExplicitInverse = Registration::Registrar<Serial::ExplicitInverse>;
  *   operator only changes "a little". In that case the preconditioner solves
  *   subdomain problems only approximately, but possibly still sufficiently to
  *   provide effective preconditioning.
+ * - Inverting the matrix is usually the most expensive part of the
+ *   initialization. When a `CacheDirectory` is specified, the inverse is
+ *   written to that directory (see `persistent_cache`) keyed by a hash of the
+ *   operator matrix, and reused by later runs (e.g. restarts) that build an
+ *   identical operator matrix. The operator matrix is still built by applying
+ *   the operator, so a stale cache can never be picked up.
  */
 template <typename LinearSolverRegistrars =
               tmpl::list<Registrars::ExplicitInverse>>
@@ -90,7 +100,15 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
         "written.";
   };
 
-  using options = tmpl::list<WriteMatrixToFile>;
+  struct CacheDirectory {
+    using type = Options::Auto<std::string, Options::AutoLabel::None>;
+    static constexpr Options::String help =
+        "Store the inverted matrices in this directory and reuse them in later "
+        "runs that build identical matrices, e.g. when restarting a solve. The "
+        "directory is created if it doesn't exist.";
+  };
+
+  using options = tmpl::list<WriteMatrixToFile, CacheDirectory>;
   static constexpr Options::String help =
       "Build a matrix representation of the linear operator and invert it "
       "directly. This means that the first solve has a large initialization "
@@ -103,8 +121,10 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   ~ExplicitInverse() = default;
 
   explicit ExplicitInverse(
-      std::optional<std::string> matrix_filename = std::nullopt)
-      : matrix_filename_(std::move(matrix_filename)) {}
+      std::optional<std::string> matrix_filename = std::nullopt,
+      std::optional<std::string> cache_directory = std::nullopt)
+      : matrix_filename_(std::move(matrix_filename)),
+        cache_directory_(std::move(cache_directory)) {}
 
   /// \cond
   explicit ExplicitInverse(CkMigrateMessage* m) : Base(m) {}
@@ -151,6 +171,7 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p) override {
     p | matrix_filename_;
+    p | cache_directory_;
     p | size_;
     p | inverse_;
     if (p.isUnpacking() and size_ != std::numeric_limits<size_t>::max()) {
@@ -164,7 +185,12 @@ class ExplicitInverse : public LinearSolver<LinearSolverRegistrars> {
   }
 
  private:
+  template <typename VarsType, typename SourceType>
+  Convergence::HasConverged apply_inverse(gsl::not_null<VarsType*> solution,
+                                          const SourceType& source) const;
+
   std::optional<std::string> matrix_filename_{};
+  std::optional<std::string> cache_directory_{};
   // Caches for successive solves of the same operator
   // NOLINTNEXTLINE(spectre-mutable)
   mutable size_t size_ = std::numeric_limits<size_t>::max();
@@ -223,6 +249,21 @@ Convergence::HasConverged ExplicitInverse<LinearSolverRegistrars>::solve(
                                 filename_suffix.value_or("") + ".txt");
       write_csv(matrix_file, inverse_, " ");
     }
+    // Reuse the inverse from an earlier run if possible
+    size_t cache_key = size_;
+    if (UNLIKELY(cache_directory_.has_value())) {
+      for (size_t j = 0; j < inverse_.columns(); ++j) {
+        boost::hash_range(cache_key, inverse_.begin(j), inverse_.end(j));
+      }
+      auto cached_inverse = persistent_cache::read<
+          blaze::DynamicMatrix<double, blaze::columnMajor>>(
+          cache_directory_.value(), "ExplicitInverse", cache_key);
+      if (cached_inverse.has_value() and cached_inverse->rows() == size_ and
+          cached_inverse->columns() == size_) {
+        inverse_ = std::move(*cached_inverse);
+        return apply_inverse(solution, source);
+      }
+    }
     // Directly invert the matrix
     try {
       blaze::invert(inverse_);
@@ -230,7 +271,19 @@ Convergence::HasConverged ExplicitInverse<LinearSolverRegistrars>::solve(
       ERROR("Could not invert subdomain matrix (size " << size_
                                                        << "): " << e.what());
     }
+    if (UNLIKELY(cache_directory_.has_value())) {
+      persistent_cache::write(cache_directory_.value(), "ExplicitInverse",
+                              cache_key, inverse_);
+    }
   }
+  return apply_inverse(solution, source);
+}
+
+template <typename LinearSolverRegistrars>
+template <typename VarsType, typename SourceType>
+Convergence::HasConverged
+ExplicitInverse<LinearSolverRegistrars>::apply_inverse(
+    const gsl::not_null<VarsType*> solution, const SourceType& source) const {
   // Copy source into contiguous workspace. In cases where the source and
   // solution data are already stored contiguously we might avoid the copy and
   // the associated workspace memory. However, compared to the cost of building
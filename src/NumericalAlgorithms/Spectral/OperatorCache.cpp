@@ -0,0 +1,182 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/Spectral/OperatorCache.hpp"
+
+#include <atomic>
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "DataStructures/Matrix.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Spectral {
+namespace {
+// Usage counts of a single thread. Only the owning thread writes them, so
+// counting doesn't contend with other threads. They are atomic only so
+// `operator_cache_statistics` can read them from any thread. Aligned to a cache
+// line to avoid false sharing between the counts of different threads.
+struct alignas(64) ThreadStatistics {
+  std::atomic<size_t> hits{0};
+  std::atomic<size_t> misses{0};
+};
+
+void increment(const gsl::not_null<std::atomic<size_t>*> count) {
+  count->store(count->load(std::memory_order_relaxed) + 1,
+               std::memory_order_relaxed);
+}
+
+struct OperatorRegistry {
+  // Elements of an `std::unordered_map` are never moved on insertion, so
+  // references to the matrices remain valid.
+  std::unordered_map<OperatorCacheKey, Matrix> matrices{};
+  size_t memory_footprint_in_bytes = 0;
+  // Usage counts of all running threads, and the accumulated counts of threads
+  // that have exited
+  std::unordered_set<const ThreadStatistics*> thread_statistics{};
+  size_t exited_threads_hits = 0;
+  size_t exited_threads_misses = 0;
+  std::mutex mutex{};
+};
+
+OperatorRegistry& operator_registry() {
+  static OperatorRegistry registry{};
+  return registry;
+}
+
+// Each thread holds its own table of the matrices it has retrieved from the
+// registry, so repeated lookups neither take a lock nor write to memory that is
+// shared with other threads.
+struct ThreadLocalCache {
+  ThreadLocalCache() {
+    auto& registry = operator_registry();
+    const std::lock_guard lock(registry.mutex);
+    registry.thread_statistics.insert(&statistics);
+  }
+
+  ~ThreadLocalCache() {
+    auto& registry = operator_registry();
+    const std::lock_guard lock(registry.mutex);
+    registry.exited_threads_hits +=
+        statistics.hits.load(std::memory_order_relaxed);
+    registry.exited_threads_misses +=
+        statistics.misses.load(std::memory_order_relaxed);
+    registry.thread_statistics.erase(&statistics);
+  }
+
+  ThreadLocalCache(const ThreadLocalCache&) = delete;
+  ThreadLocalCache& operator=(const ThreadLocalCache&) = delete;
+  ThreadLocalCache(ThreadLocalCache&&) = delete;
+  ThreadLocalCache& operator=(ThreadLocalCache&&) = delete;
+
+  std::unordered_map<OperatorCacheKey, const Matrix*> matrices{};
+  ThreadStatistics statistics{};
+};
+
+ThreadLocalCache& thread_local_cache() {
+  thread_local ThreadLocalCache cache{};
+  return cache;
+}
+}  // namespace
+
+bool operator==(const OperatorCacheKey& lhs, const OperatorCacheKey& rhs) {
+  return lhs.name == rhs.name and lhs.source_mesh == rhs.source_mesh and
+         lhs.target_mesh == rhs.target_mesh and lhs.parameter == rhs.parameter;
+}
+
+bool operator!=(const OperatorCacheKey& lhs, const OperatorCacheKey& rhs) {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const OperatorCacheStatistics& statistics) {
+  return os << "Hits: " << statistics.hits
+            << ", Misses: " << statistics.misses
+            << ", Entries: " << statistics.entries
+            << ", Memory: " << statistics.memory_footprint_in_bytes
+            << " bytes";
+}
+
+namespace operator_cache_detail {
+const Matrix* find(const OperatorCacheKey& key) {
+  auto& cache = thread_local_cache();
+  if (const auto cached_matrix = cache.matrices.find(key);
+      cached_matrix != cache.matrices.end()) {
+    increment(make_not_null(&cache.statistics.hits));
+    return cached_matrix->second;
+  }
+  // First lookup of the `key` on this thread
+  const Matrix* matrix = nullptr;
+  {
+    auto& registry = operator_registry();
+    const std::lock_guard lock(registry.mutex);
+    const auto found_matrix = registry.matrices.find(key);
+    if (found_matrix != registry.matrices.end()) {
+      matrix = &found_matrix->second;
+    }
+  }
+  if (matrix == nullptr) {
+    increment(make_not_null(&cache.statistics.misses));
+    return nullptr;
+  }
+  cache.matrices.emplace(key, matrix);
+  increment(make_not_null(&cache.statistics.hits));
+  return matrix;
+}
+
+const Matrix& insert(const OperatorCacheKey& key, Matrix matrix) {
+  const Matrix* inserted_matrix = nullptr;
+  {
+    auto& registry = operator_registry();
+    const std::lock_guard lock(registry.mutex);
+    const auto [registry_entry, inserted] =
+        registry.matrices.try_emplace(key, std::move(matrix));
+    if (inserted) {
+      registry.memory_footprint_in_bytes +=
+          registry_entry->second.capacity() * sizeof(double);
+    }
+    inserted_matrix = &registry_entry->second;
+  }
+  thread_local_cache().matrices.emplace(key, inserted_matrix);
+  return *inserted_matrix;
+}
+}  // namespace operator_cache_detail
+
+OperatorCacheStatistics operator_cache_statistics() {
+  auto& registry = operator_registry();
+  const std::lock_guard lock(registry.mutex);
+  // The counts of other threads may be slightly out of date while they access
+  // the registry.
+  OperatorCacheStatistics statistics{
+      registry.exited_threads_hits, registry.exited_threads_misses,
+      registry.matrices.size(), registry.memory_footprint_in_bytes};
+  for (const ThreadStatistics* thread_statistics :
+       registry.thread_statistics) {
+    statistics.hits += thread_statistics->hits.load(std::memory_order_relaxed);
+    statistics.misses +=
+        thread_statistics->misses.load(std::memory_order_relaxed);
+  }
+  return statistics;
+}
+}  // namespace Spectral
+
+namespace std {
+size_t hash<Spectral::OperatorCacheKey>::operator()(
+    const Spectral::OperatorCacheKey& key) const {
+  size_t hash = std::hash<std::string_view>{}(key.name);
+  for (const auto* mesh : {&key.source_mesh, &key.target_mesh}) {
+    boost::hash_combine(hash, mesh->extents(0));
+    boost::hash_combine(hash, static_cast<size_t>(mesh->basis(0)));
+    boost::hash_combine(hash, static_cast<size_t>(mesh->quadrature(0)));
+  }
+  boost::hash_combine(hash, key.parameter);
+  return hash;
+}
+}  // namespace std
@@ -0,0 +1,109 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string_view>
+
+#include "DataStructures/Matrix.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+
+namespace Spectral {
+
+/*!
+ * \brief Identifies a matrix in the Spectral::cached_operator registry
+ *
+ * - `name`: Identifies the operator, e.g. "ProjectionParentToChild". It must
+ *   refer to a string with static storage duration, such as a string literal,
+ *   since the registry holds on to it.
+ * - `source_mesh`: The 1D mesh the operator acts on.
+ * - `target_mesh`: The 1D mesh the operator maps to, if different from the
+ *   `source_mesh` (e.g. for projections and interpolations).
+ * - `parameter`: Any additional discrete parameter the operator depends on,
+ *   e.g. the `Spectral::ChildSize` of a projection or the number of modes a
+ *   filter removes.
+ */
+struct OperatorCacheKey {
+  std::string_view name;
+  Mesh<1> source_mesh{};
+  Mesh<1> target_mesh{};
+  size_t parameter = 0;
+};
+
+bool operator==(const OperatorCacheKey& lhs, const OperatorCacheKey& rhs);
+
+bool operator!=(const OperatorCacheKey& lhs, const OperatorCacheKey& rhs);
+
+/// Usage statistics of the Spectral::cached_operator registry
+struct OperatorCacheStatistics {
+  /// Number of lookups that found the matrix in the registry
+  size_t hits = 0;
+  /// Number of lookups that had to compute the matrix
+  size_t misses = 0;
+  /// Number of matrices held by the registry
+  size_t entries = 0;
+  /// Memory allocated by the matrices held by the registry
+  size_t memory_footprint_in_bytes = 0;
+};
+
+std::ostream& operator<<(std::ostream& os,
+                         const OperatorCacheStatistics& statistics);
+
+namespace operator_cache_detail {
+// Returns `nullptr` if the `key` is not in the registry. Records a hit or miss
+// for the calling thread.
+const Matrix* find(const OperatorCacheKey& key);
+
+// Inserts the `matrix` unless another thread has inserted the `key` already,
+// and returns the matrix held by the registry.
+const Matrix& insert(const OperatorCacheKey& key, Matrix matrix);
+}  // namespace operator_cache_detail
+
+/*!
+ * \brief Retrieve a 1D spectral operator from a process-wide registry,
+ * computing it with the `generator` the first time it is requested.
+ *
+ * The registry holds differentiation-like operators that are too numerous to
+ * compute upfront for every combination of their arguments, such as the
+ * projection matrices between meshes, filter matrices and subcell projection
+ * matrices. With mesh refinement only a small fraction of all possible
+ * combinations is typically used, so the registry computes and stores only
+ * those that are actually requested. Since it is shared by all threads in the
+ * process, each matrix is computed once per process (i.e. once per node in SMP
+ * builds) and not once per element or thread.
+ *
+ * The registry can be accessed from any thread. Each thread keeps its own table
+ * of the matrices it has retrieved, so repeated lookups take no lock and write
+ * no memory shared with other threads. Only the first lookup of a matrix on a
+ * thread locks the registry. On a miss the `generator` is invoked without
+ * holding the lock, so it can retrieve other cached operators. If two threads
+ * miss the same `key` simultaneously, both invoke their `generator` but only
+ * one result is kept. The returned reference remains valid for the lifetime of
+ * the program.
+ *
+ * \see Spectral::operator_cache_statistics
+ */
+template <typename Generator>
+const Matrix& cached_operator(const OperatorCacheKey& key,
+                              Generator&& generator) {
+  if (const Matrix* const cached_matrix = operator_cache_detail::find(key);
+      cached_matrix != nullptr) {
+    return *cached_matrix;
+  }
+  return operator_cache_detail::insert(key, Matrix(generator()));
+}
+
+/// Usage statistics of the Spectral::cached_operator registry. Useful to
+/// monitor the memory held by the registry and how often matrices are reused.
+OperatorCacheStatistics operator_cache_statistics();
+}  // namespace Spectral
+
+namespace std {
+template <>
+struct hash<Spectral::OperatorCacheKey> {
+  size_t operator()(const Spectral::OperatorCacheKey& key) const;
+};
+}  // namespace std
@@ -13,14 +13,13 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/OperatorCache.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
-#include "Utilities/Literals.hpp"
-#include "Utilities/StaticCache.hpp"
 
 namespace Spectral {
 
@@ -52,6 +51,107 @@ bool needs_projection(const Mesh<Dim>& mesh1, const Mesh<Dim>& mesh2,
          });
 }
 
+namespace {
+// The restriction operators from a mortar (the child) to an element (the
+// parent) for each `ChildSize`.
+Matrix restriction_matrix_full(const Mesh<1>& mesh_element,
+                               const Mesh<1>& mesh_mortar) {
+  const size_t extents_element = mesh_element.extents(0);
+  const size_t extents_mortar = mesh_mortar.extents(0);
+  // The projection in spectral space is just a truncation of the modes.
+  const auto& spectral_to_grid_element = modal_to_nodal_matrix(mesh_element);
+  const auto& grid_to_spectral_mortar = nodal_to_modal_matrix(mesh_mortar);
+  Matrix projection(extents_element, extents_mortar, 0.);
+  for (size_t i = 0; i < extents_element; ++i) {
+    for (size_t j = 0; j < extents_mortar; ++j) {
+      for (size_t k = 0; k < extents_element; ++k) {
+        projection(i, j) +=
+            spectral_to_grid_element(i, k) * grid_to_spectral_mortar(k, j);
+      }
+    }
+  }
+  return projection;
+}
+
+Matrix restriction_matrix_upper_half(const Mesh<1>& mesh_element,
+                                     const Mesh<1>& mesh_mortar) {
+  const size_t extents_element = mesh_element.extents(0);
+  const size_t extents_mortar = mesh_mortar.extents(0);
+
+  // The transformation from the small interval to the large interval in
+  // spectral space.  This is a rearranged version of the equation given in
+  // the header.  This form was easier to code.
+  const auto spectral_transformation = [](const size_t large_index,
+                                          const size_t small_index) {
+    ASSERT(large_index >= small_index,
+           "Above-diagonal entries are zero.  Don't use them.");
+    double result = 1.;
+    for (size_t i = (large_index - small_index) / 2; i > 0; --i) {
+      result = 1 - result *
+                       static_cast<double>(
+                           (large_index + small_index + 3 - 2 * i) *
+                           (large_index + small_index + 2 - 2 * i) *
+                           (large_index - small_index + 2 - 2 * i) *
+                           (large_index - small_index + 1 - 2 * i)) /
+                       static_cast<double>(2 * i *
+                                           (2 * large_index + 1 - 2 * i) *
+                                           (large_index + 2 - 2 * i) *
+                                           (large_index + 1 - 2 * i));
+    }
+
+    for (size_t i = 1; i <= large_index - small_index; ++i) {
+      result *= 1. + static_cast<double>(large_index + small_index + 1) / i;
+    }
+    result /= pow(2., static_cast<int>(large_index) + 1);
+    return result;
+  };
+
+  const auto& spectral_to_grid_element = modal_to_nodal_matrix(mesh_element);
+  const auto& grid_to_spectral_mortar = nodal_to_modal_matrix(mesh_mortar);
+
+  Matrix temp(extents_element, extents_element, 0.);
+  for (size_t j = 0; j < extents_element; ++j) {
+    for (size_t k = j; k < extents_element; ++k) {
+      const double transformation_entry = spectral_transformation(k, j);
+      for (size_t i = 0; i < extents_element; ++i) {
+        temp(i, j) += spectral_to_grid_element(i, k) * transformation_entry;
+      }
+    }
+  }
+
+  Matrix projection(extents_element, extents_mortar, 0.);
+  for (size_t i = 0; i < extents_element; ++i) {
+    for (size_t j = 0; j < extents_mortar; ++j) {
+      for (size_t k = 0; k < extents_element; ++k) {
+        projection(i, j) += temp(i, k) * grid_to_spectral_mortar(k, j);
+      }
+    }
+  }
+
+  return projection;
+}
+
+Matrix restriction_matrix_lower_half(const Mesh<1>& mesh_element,
+                                     const Mesh<1>& mesh_mortar) {
+  const size_t extents_element = mesh_element.extents(0);
+  const size_t extents_mortar = mesh_mortar.extents(0);
+  // The lower-half matrices are generated from the upper-half matrices using
+  // symmetry.
+  const auto& projection_upper_half = projection_matrix_child_to_parent(
+      mesh_mortar, mesh_element, ChildSize::UpperHalf);
+
+  Matrix projection_lower_half(extents_element, extents_mortar);
+  for (size_t i = 0; i < extents_element; ++i) {
+    for (size_t j = 0; j < extents_mortar; ++j) {
+      projection_lower_half(i, j) = projection_upper_half(
+          extents_element - i - 1, extents_mortar - j - 1);
+    }
+  }
+
+  return projection_lower_half;
+}
+}  // namespace
+
 const Matrix& projection_matrix_child_to_parent(const Mesh<1>& child_mesh,
                                                 const Mesh<1>& parent_mesh,
                                                 const ChildSize size,
@@ -67,199 +167,37 @@ const Matrix& projection_matrix_child_to_parent(const Mesh<1>& child_mesh,
          "Requested projection matrix from child with fewer points ("
              << child_mesh.extents(0) << ") than the parent ("
              << parent_mesh.extents(0) << ")");
+  ASSERT(size == ChildSize::Full or size == ChildSize::UpperHalf or
+             size == ChildSize::LowerHalf,
+         "Invalid ChildSize: " << size);
 
   if (operand_is_massive) {
     // The restriction operator for massive quantities is just the interpolation
     // transpose
-    const static auto cache = make_static_cache<
-        CacheEnumeration<Quadrature, Quadrature::Gauss,
-                         Quadrature::GaussLobatto>,
-        CacheRange<2_st, max_points + 1>,
-        CacheEnumeration<Quadrature, Quadrature::Gauss,
-                         Quadrature::GaussLobatto>,
-        CacheRange<2_st, max_points + 1>,
-        CacheEnumeration<ChildSize, ChildSize::Full, ChildSize::UpperHalf,
-                         ChildSize::LowerHalf>>(
-        [](const Quadrature child_quadrature, const size_t child_extent,
-           const Quadrature parent_quadrature, const size_t parent_extent,
-           const ChildSize local_child_size) -> Matrix {
-          const auto& prolongation_operator = projection_matrix_parent_to_child(
-              {parent_extent, Spectral::Basis::Legendre, parent_quadrature},
-              {child_extent, Spectral::Basis::Legendre, child_quadrature},
-              local_child_size);
-          return blaze::trans(prolongation_operator);
+    return cached_operator(
+        {"ProjectionChildToParentMassive", child_mesh, parent_mesh,
+         static_cast<size_t>(size)},
+        [&child_mesh, &parent_mesh, &size]() -> Matrix {
+          return blaze::trans(
+              projection_matrix_parent_to_child(parent_mesh, child_mesh, size));
         });
-    return cache(child_mesh.quadrature(0), child_mesh.extents(0),
-                 parent_mesh.quadrature(0), parent_mesh.extents(0), size);
   }
 
-  switch (size) {
-    case ChildSize::Full: {
-      const static auto cache =
-          make_static_cache<CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>,
-                            CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>>(
-              [](const Quadrature quadrature_element,
-                 const size_t extents_element,
-                 const Quadrature quadrature_mortar,
-                 const size_t extents_mortar) {
-                if (extents_element > extents_mortar) {
-                  return Matrix{};
-                }
-                const Mesh<1> mesh_element(extents_element, Basis::Legendre,
-                                           quadrature_element);
-                const Mesh<1> mesh_mortar(extents_mortar, Basis::Legendre,
-                                          quadrature_mortar);
-
-                // The projection in spectral space is just a truncation
-                // of the modes.
-                const auto& spectral_to_grid_element =
-                    modal_to_nodal_matrix(mesh_element);
-                const auto& grid_to_spectral_mortar =
-                    nodal_to_modal_matrix(mesh_mortar);
-                Matrix projection(extents_element, extents_mortar, 0.);
-                for (size_t i = 0; i < extents_element; ++i) {
-                  for (size_t j = 0; j < extents_mortar; ++j) {
-                    for (size_t k = 0; k < extents_element; ++k) {
-                      projection(i, j) += spectral_to_grid_element(i, k) *
-                                          grid_to_spectral_mortar(k, j);
-                    }
-                  }
-                }
-
-                return projection;
-              });
-      return cache(parent_mesh.quadrature(0), parent_mesh.extents(0),
-                   child_mesh.quadrature(0), child_mesh.extents(0));
-    }
-
-    case ChildSize::UpperHalf: {
-      const static auto cache = make_static_cache<
-          CacheEnumeration<Quadrature, Quadrature::Gauss,
-                           Quadrature::GaussLobatto>,
-          CacheRange<2_st, max_points + 1>,
-          CacheEnumeration<Quadrature, Quadrature::Gauss,
-                           Quadrature::GaussLobatto>,
-          CacheRange<2_st,
-                     max_points + 1>>([](const Quadrature quadrature_element,
-                                         const size_t extents_element,
-                                         const Quadrature quadrature_mortar,
-                                         const size_t extents_mortar) {
-        if (extents_element > extents_mortar) {
-          return Matrix{};
+  return cached_operator(
+      {"ProjectionChildToParent", child_mesh, parent_mesh,
+       static_cast<size_t>(size)},
+      [&child_mesh, &parent_mesh, &size]() {
+        switch (size) {
+          case ChildSize::Full:
+            return restriction_matrix_full(parent_mesh, child_mesh);
+          case ChildSize::UpperHalf:
+            return restriction_matrix_upper_half(parent_mesh, child_mesh);
+          case ChildSize::LowerHalf:
+            return restriction_matrix_lower_half(parent_mesh, child_mesh);
+          default:
+            ERROR("Invalid ChildSize");
         }
-        const Mesh<1> mesh_element(extents_element, Basis::Legendre,
-                                   quadrature_element);
-        const Mesh<1> mesh_mortar(extents_mortar, Basis::Legendre,
-                                  quadrature_mortar);
-
-        // The transformation from the small interval to the large
-        // interval in spectral space.  This is a rearranged
-        // version of the equation given in the header.  This form
-        // was easier to code.
-        const auto spectral_transformation = [](const size_t large_index,
-                                                const size_t small_index) {
-          ASSERT(large_index >= small_index,
-                 "Above-diagonal entries are zero.  Don't use them.");
-          double result = 1.;
-          for (size_t i = (large_index - small_index) / 2; i > 0; --i) {
-            result = 1 - result *
-                             static_cast<double>(
-                                 (large_index + small_index + 3 - 2 * i) *
-                                 (large_index + small_index + 2 - 2 * i) *
-                                 (large_index - small_index + 2 - 2 * i) *
-                                 (large_index - small_index + 1 - 2 * i)) /
-                             static_cast<double>(2 * i *
-                                                 (2 * large_index + 1 - 2 * i) *
-                                                 (large_index + 2 - 2 * i) *
-                                                 (large_index + 1 - 2 * i));
-          }
-
-          for (size_t i = 1; i <= large_index - small_index; ++i) {
-            result *=
-                1. + static_cast<double>(large_index + small_index + 1) / i;
-          }
-          result /= pow(2., static_cast<int>(large_index) + 1);
-          return result;
-        };
-
-        const auto& spectral_to_grid_element =
-            modal_to_nodal_matrix(mesh_element);
-        const auto& grid_to_spectral_mortar =
-            nodal_to_modal_matrix(mesh_mortar);
-
-        Matrix temp(extents_element, extents_element, 0.);
-        for (size_t j = 0; j < extents_element; ++j) {
-          for (size_t k = j; k < extents_element; ++k) {
-            const double transformation_entry = spectral_transformation(k, j);
-            for (size_t i = 0; i < extents_element; ++i) {
-              temp(i, j) +=
-                  spectral_to_grid_element(i, k) * transformation_entry;
-            }
-          }
-        }
-
-        Matrix projection(extents_element, extents_mortar, 0.);
-        for (size_t i = 0; i < extents_element; ++i) {
-          for (size_t j = 0; j < extents_mortar; ++j) {
-            for (size_t k = 0; k < extents_element; ++k) {
-              projection(i, j) += temp(i, k) * grid_to_spectral_mortar(k, j);
-            }
-          }
-        }
-
-        return projection;
       });
-      return cache(parent_mesh.quadrature(0), parent_mesh.extents(0),
-                   child_mesh.quadrature(0), child_mesh.extents(0));
-    }
-
-    case ChildSize::LowerHalf: {
-      const static auto cache =
-          make_static_cache<CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>,
-                            CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>>(
-              [](const Quadrature quadrature_element,
-                 const size_t extents_element,
-                 const Quadrature quadrature_mortar,
-                 const size_t extents_mortar) {
-                if (extents_element > extents_mortar) {
-                  return Matrix{};
-                }
-                const Mesh<1> mesh_element(extents_element, Basis::Legendre,
-                                           quadrature_element);
-                const Mesh<1> mesh_mortar(extents_mortar, Basis::Legendre,
-                                          quadrature_mortar);
-
-                // The lower-half matrices are generated from the upper-half
-                // matrices using symmetry.
-                const auto& projection_upper_half =
-                    projection_matrix_child_to_parent(mesh_mortar, mesh_element,
-                                                      ChildSize::UpperHalf);
-
-                Matrix projection_lower_half(extents_element, extents_mortar);
-                for (size_t i = 0; i < extents_element; ++i) {
-                  for (size_t j = 0; j < extents_mortar; ++j) {
-                    projection_lower_half(i, j) = projection_upper_half(
-                        extents_element - i - 1, extents_mortar - j - 1);
-                  }
-                }
-
-                return projection_lower_half;
-              });
-      return cache(parent_mesh.quadrature(0), parent_mesh.extents(0),
-                   child_mesh.quadrature(0), child_mesh.extents(0));
-    }
-
-    default:
-      ERROR("Invalid ChildSize");
-  }
 }
 
 template <size_t Dim>
@@ -306,70 +244,24 @@ const Matrix& projection_matrix_parent_to_child(const Mesh<1>& parent_mesh,
              << parent_mesh.extents(0) << ")");
 
   // Element-to-mortar projections are always interpolations.
-  const auto make_interpolators = [](auto interval_transform) {
-    return [interval_transform = std::move(interval_transform)](
-               const Quadrature quadrature_mortar, const size_t extents_mortar,
-               const Quadrature quadrature_element,
-               const size_t extents_element) {
-      if (extents_mortar < extents_element) {
-        return Matrix{};
-      }
-      const Mesh<1> mesh_element(extents_element, Basis::Legendre,
-                                 quadrature_element);
-      const Mesh<1> mesh_mortar(extents_mortar, Basis::Legendre,
-                                quadrature_mortar);
-      return interpolation_matrix(
-          mesh_element, interval_transform(collocation_points(mesh_mortar)));
-    };
-  };
-
-  switch (size) {
-    case ChildSize::Full: {
-      const static auto cache =
-          make_static_cache<CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>,
-                            CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>>(
-              make_interpolators([](const DataVector& x) { return x; }));
-      return cache(child_mesh.quadrature(0), child_mesh.extents(0),
-                   parent_mesh.quadrature(0), parent_mesh.extents(0));
-    }
-
-    case ChildSize::UpperHalf: {
-      const static auto cache =
-          make_static_cache<CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>,
-                            CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>>(
-              make_interpolators([](const DataVector& x) {
-                return DataVector(0.5 * (x + 1.));
-              }));
-      return cache(child_mesh.quadrature(0), child_mesh.extents(0),
-                   parent_mesh.quadrature(0), parent_mesh.extents(0));
-    }
-
-    case ChildSize::LowerHalf: {
-      const static auto cache =
-          make_static_cache<CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>,
-                            CacheEnumeration<Quadrature, Quadrature::Gauss,
-                                             Quadrature::GaussLobatto>,
-                            CacheRange<2_st, max_points + 1>>(
-              make_interpolators([](const DataVector& x) {
-                return DataVector(0.5 * (x - 1.));
-              }));
-      return cache(child_mesh.quadrature(0), child_mesh.extents(0),
-                   parent_mesh.quadrature(0), parent_mesh.extents(0));
-    }
-
-    default:
-      ERROR("Invalid ChildSize");
-  }
+  return cached_operator(
+      {"ProjectionParentToChild", parent_mesh, child_mesh,
+       static_cast<size_t>(size)},
+      [&parent_mesh, &child_mesh, &size]() {
+        const DataVector& mortar_points = collocation_points(child_mesh);
+        switch (size) {
+          case ChildSize::Full:
+            return interpolation_matrix(parent_mesh, mortar_points);
+          case ChildSize::UpperHalf:
+            return interpolation_matrix(
+                parent_mesh, DataVector(0.5 * (mortar_points + 1.)));
+          case ChildSize::LowerHalf:
+            return interpolation_matrix(
+                parent_mesh, DataVector(0.5 * (mortar_points - 1.)));
+          default:
+            ERROR("Invalid ChildSize");
+        }
+      });
 }
 
 template <size_t Dim>
@@ -9,6 +9,7 @@
 #include <pup.h>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -18,6 +19,7 @@
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/ArrayCollection/DgElementArrayMemberBase.hpp"
 #include "Parallel/ArrayCollection/SetTerminateOnElement.hpp"
+#include "Parallel/AtomicInbox.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
@@ -104,6 +106,18 @@ class DgElementArrayMember<Dim, Metavariables,
       tuples::TaggedTuple<InitializationTags...> initialization_items,
       ElementId<Dim> element_id);
 
+  /// Construct an element that is created by adaptive mesh refinement from
+  /// other elements on the same node, analogous to the constructor of
+  /// `Parallel::DistributedObject` that is used when inserting array elements.
+  /// Only the array index and the global cache proxy are set in the DataBox;
+  /// all other mutable items must be projected from the parent or children
+  /// (see `amr::Actions::AdjustDomainOnNode`).
+  DgElementArrayMember(
+      const Parallel::CProxy_GlobalCache<Metavariables>& global_cache_proxy,
+      Parallel::Phase current_phase,
+      std::unordered_map<Parallel::Phase, size_t> phase_bookmarks,
+      ElementId<Dim> element_id);
+
   /// \cond
   ~DgElementArrayMember() override = default;
 
@@ -124,7 +138,11 @@ class DgElementArrayMember<Dim, Metavariables,
   /// where the previous execution of the same phase left off.
   void start_phase(Parallel::Phase next_phase) override;
 
+  /// @{
+  /// Access the DataBox
   const auto& databox() const { return box_; }
+  auto& databox() { return box_; }
+  /// @}
 
   /// Start evaluating the algorithm until it is stopped by an action.
   void perform_algorithm() override;
@@ -196,6 +214,27 @@ DgElementArrayMember<Dim, Metavariables, tmpl::list<PhaseDepActionListsPack...>,
       std::move(get<InitializationTags>(initialization_items))...);
 }
 
+template <size_t Dim, typename Metavariables,
+          typename... PhaseDepActionListsPack, typename SimpleTagsFromOptions>
+DgElementArrayMember<Dim, Metavariables, tmpl::list<PhaseDepActionListsPack...>,
+                     SimpleTagsFromOptions>::
+    DgElementArrayMember(
+        const Parallel::CProxy_GlobalCache<Metavariables>& global_cache_proxy,
+        const Parallel::Phase current_phase,
+        std::unordered_map<Parallel::Phase, size_t> phase_bookmarks,
+        ElementId<Dim> element_id)
+    : Parallel::DgElementArrayMemberBase<Dim>(
+          std::move(element_id),
+          Parallel::my_node<size_t>(
+              *Parallel::local_branch(global_cache_proxy))),
+      global_cache_proxy_(global_cache_proxy) {
+  this->phase_ = current_phase;
+  this->phase_bookmarks_ = std::move(phase_bookmarks);
+  ::Initialization::mutate_assign<
+      tmpl::list<Tags::ArrayIndex, Tags::GlobalCacheProxy<Metavariables>>>(
+      make_not_null(&box_), this->element_id_, global_cache_proxy_);
+}
+
 template <size_t Dim, typename Metavariables,
           typename... PhaseDepActionListsPack, typename SimpleTagsFromOptions>
 void DgElementArrayMember<
@@ -409,6 +448,9 @@ bool DgElementArrayMember<Dim, Metavariables,
   }
 #endif  // SPECTRE_CHARM_PROJECTIONS
 
+  // Move data that other elements on this node queued without locking into
+  // the inboxes before the action reads them.
+  Parallel::collect_atomic_inboxes(make_not_null(&inboxes_));
   const auto& [requested_execution, next_action_step] = ThisAction::apply(
       box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
       std::as_const(this->element_id_), actions_list{},
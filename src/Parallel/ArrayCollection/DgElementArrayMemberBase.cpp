@@ -31,6 +31,12 @@ Phase DgElementArrayMemberBase<Dim>::phase() const {
   return phase_;
 }
 
+template <size_t Dim>
+const std::unordered_map<Phase, size_t>&
+DgElementArrayMemberBase<Dim>::phase_bookmarks() const {
+  return phase_bookmarks_;
+}
+
 template <size_t Dim>
 void DgElementArrayMemberBase<Dim>::set_terminate(
     const gsl::not_null<size_t*> number_of_elements_terminated,
@@ -55,6 +55,10 @@ class DgElementArrayMemberBase : PUP::able {
   /// Get the current phase
   Parallel::Phase phase() const;
 
+  /// The step in the iterable action list at which each phase that has been
+  /// left will be resumed
+  const std::unordered_map<Parallel::Phase, size_t>& phase_bookmarks() const;
+
   /// Tell the Algorithm it should no longer execute the algorithm. This does
   /// not mean that the execution of the program is terminated, but only that
   /// the algorithm has terminated. An algorithm can be restarted by passing
@@ -88,6 +92,9 @@ class DgElementArrayMemberBase : PUP::able {
   /// \brief The `inbox_lock()` only locks the inbox, nothing else. The inbox is
   /// unsafe to access without this lock.
   ///
+  /// Inboxes of type `evolution::dg::AtomicInboxBoundaryData` or
+  /// `Parallel::AtomicInbox` are inserted into without this lock.
+  ///
   /// Use `element_lock()` to lock the rest of the element.
   ///
   /// This should always be managed by `std::unique_lock` or `std::lock_guard`.
@@ -6,6 +6,8 @@
 #include <cstddef>
 #include <type_traits>
 
+#include "Utilities/TypeTraits/CreateHasTypeAlias.hpp"
+
 /// \cond
 namespace Parallel {
 template <size_t Dim, typename Metavariables, typename PhaseDepActionList>
@@ -14,10 +16,19 @@ class DgElementCollection;
 /// \endcond
 
 namespace Parallel {
+namespace detail {
+CREATE_HAS_TYPE_ALIAS(element_collection_tag)
+}  // namespace detail
+
 /// \brief Is `std::true_type` if `T` is a `Parallel::DgElementCollection`, else
 /// is `std::false_type`.
+///
+/// Any parallel component that holds its elements in the
+/// `element_collection_tag` of its DataBox (e.g. a nodegroup holding
+/// `Parallel::DgElementArrayMember`s) is treated as a `DgElementCollection`,
+/// since that tag is all that the actions on the collection rely on.
 template <typename T>
-struct is_dg_element_collection : std::false_type {};
+struct is_dg_element_collection : detail::has_element_collection_tag<T> {};
 
 /// \cond
 template <size_t Dim, typename Metavariables, typename PhaseDepActionList>
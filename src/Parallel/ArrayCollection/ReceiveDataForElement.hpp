@@ -8,6 +8,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Parallel/AtomicInbox.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
@@ -46,10 +47,14 @@ struct ReceiveDataForElement {
         make_not_null(&box));
     // Note: We'll be able to do a counter-based check here too once that
     // works for LTS in `SendDataToElement`
-    ReceiveTag::insert_into_inbox(
-        make_not_null(&tuples::get<ReceiveTag>(
-            element_collection.at(element_to_execute_on).inboxes())),
-        instance, std::move(receive_data));
+    auto& inbox = tuples::get<ReceiveTag>(
+        element_collection.at(element_to_execute_on).inboxes());
+    if constexpr (Parallel::is_atomic_inbox_v<typename ReceiveTag::type>) {
+      inbox.insert(instance, std::move(receive_data));
+    } else {
+      ReceiveTag::insert_into_inbox(make_not_null(&inbox), instance,
+                                    std::move(receive_data));
+    }
 
     apply_impl<ParallelComponent>(cache, element_to_execute_on,
                                   make_not_null(&element_collection));
@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
+#include "Parallel/AtomicInbox.hpp"
 #include "Parallel/ArrayCollection/ReceiveDataForElement.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -27,7 +28,11 @@ namespace Parallel::Actions {
  * If the inbox tag type is an `evolution::dg::AtomicInboxBoundaryData` then
  * remote insert for elements on the same node is done in a lock-free manner
  * between the sender and receiver elements, and in a wait-free manner between
- * different sender elements to the same receiver element.
+ * different sender elements to the same receiver element. If the inbox tag type
+ * is a `Parallel::AtomicInbox` then the data is queued in a lock-free manner
+ * and moved into the inbox by the receiver element before it runs its actions.
+ * All other inboxes are locked with the receiver's `inbox_lock()` while
+ * inserting.
  *
  * The number of messages needed to take the next time step on the receiver
  * element is kept track of and a message is sent to the parallel runtime
@@ -69,6 +74,10 @@ struct SendDataToElement {
         count = ReceiveTag::insert_into_inbox(
             make_not_null(&tuples::get<ReceiveTag>(element.inboxes())),
             instance, std::forward<ReceiveData>(receive_data));
+      } else if constexpr (Parallel::is_atomic_inbox_v<
+                               typename ReceiveTag::type>) {
+        tuples::get<ReceiveTag>(element.inboxes())
+            .insert(instance, std::forward<ReceiveData>(receive_data));
       } else {
         // Scope so that we minimize how long we lock the inbox.
         std::lock_guard inbox_lock(element.inbox_lock());
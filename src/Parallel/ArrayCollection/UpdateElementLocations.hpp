@@ -0,0 +1,52 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel::Actions {
+/// \brief Update the `Parallel::Tags::ElementLocations` on a node after the
+/// elements with `removed_ids` were removed from and the elements with
+/// `added_ids` were added to the `DgElementCollection` on node `node_of_ids`.
+///
+/// Broadcast this threaded action to all nodes of the `DgElementCollection`,
+/// e.g. after adaptive mesh refinement changed the elements on a node.
+struct UpdateElementLocations {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, size_t Dim,
+            typename DistributedObject>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const DistributedObject* /*distributed_object*/,
+                    const std::vector<ElementId<Dim>>& removed_ids,
+                    const std::vector<ElementId<Dim>>& added_ids,
+                    const size_t node_of_ids) {
+    const std::lock_guard hold_lock(*node_lock);
+    db::mutate<Parallel::Tags::ElementLocations<Dim>>(
+        [&added_ids, &node_of_ids, &removed_ids](
+            const gsl::not_null<std::unordered_map<ElementId<Dim>, size_t>*>
+                element_locations) {
+          for (const auto& element_id : removed_ids) {
+            element_locations->erase(element_id);
+          }
+          for (const auto& element_id : added_ids) {
+            (*element_locations)[element_id] = node_of_ids;
+          }
+        },
+        make_not_null(&box));
+  }
+};
+}  // namespace Parallel::Actions
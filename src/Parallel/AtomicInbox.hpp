@@ -0,0 +1,195 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Parallel/StaticMpscQueue.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/Abort.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Parallel {
+/*!
+ * \brief An inbox that other threads on the same node can insert into without
+ * locking.
+ *
+ * An inbox tag opts into lock-free insertion by setting its `type` to
+ * `AtomicInbox<InboxTag, Storage, Message>`, where `Storage` is the inbox type
+ * the tag would otherwise use (usually a `std::map` keyed by the
+ * `temporal_id`) and `Message` is the data type that is sent to the inbox. The
+ * `AtomicInbox` publicly derives from `Storage`, so actions read from the inbox
+ * exactly as before.
+ *
+ * Senders on the same node call `insert()`, which places the message in a
+ * bounded `StaticMpscQueue`. The infrastructure calls `collect()` on the
+ * receiving element before running its actions, which moves all queued
+ * messages into the `Storage` using the tag's usual `insert_into_inbox`.
+ * Insertions made directly through `InboxTag::insert_into_inbox` (e.g. by
+ * Charm++ array elements, which are only accessed by one thread at a time)
+ * bypass the queue and go straight into the `Storage`.
+ *
+ * The queue and the overflow buffer are only allocated by the first `insert()`,
+ * so inboxes that are only ever filled through `insert_into_inbox` (e.g. on
+ * Charm++ array elements) carry a single null pointer instead of the queue.
+ *
+ * The queue has a fixed capacity of `Capacity` messages that have not been
+ * collected yet. Messages that arrive while the queue is full are stored in an
+ * overflow buffer guarded by a mutex instead, so the capacity should be chosen
+ * larger than the number of messages an element usually receives before it
+ * runs again.
+ *
+ * \warning Only an `AtomicInbox` with an empty queue can be moved or
+ * serialized.
+ */
+template <typename InboxTag, typename Storage, typename Message,
+          size_t Capacity = 32>
+class AtomicInbox : public Storage {
+ public:
+  using temporal_id = typename InboxTag::temporal_id;
+  using message_type = Message;
+  using storage_type = Storage;
+
+  AtomicInbox() = default;
+  AtomicInbox(const AtomicInbox&) = delete;
+  AtomicInbox& operator=(const AtomicInbox&) = delete;
+  AtomicInbox(AtomicInbox&& rhs) noexcept : Storage(std::move(rhs)) {
+    if (rhs.has_uncollected_messages()) {
+      sys::abort("You cannot move an AtomicInbox with uncollected messages.");
+    }
+  }
+  AtomicInbox& operator=(AtomicInbox&& rhs) noexcept {
+    if (has_uncollected_messages() or rhs.has_uncollected_messages()) {
+      sys::abort("You cannot move an AtomicInbox with uncollected messages.");
+    }
+    Storage::operator=(std::move(rhs));
+    return *this;
+  }
+  ~AtomicInbox() {
+    delete queues_.load(std::memory_order_acquire);
+  }
+
+  /// Queue a message for the receiver. Can be called from any number of
+  /// threads simultaneously.
+  template <typename ReceiveData>
+  void insert(const temporal_id& instance, ReceiveData&& data) {
+    Queues& queues = get_or_allocate_queues();
+    entry_type entry{instance, message_type(std::forward<ReceiveData>(data))};
+    // `try_push` only moves from the entry if it succeeds.
+    if (LIKELY(queues.queue.try_push(std::move(entry)))) {
+      return;
+    }
+    const std::lock_guard lock(queues.overflow_mutex);
+    queues.overflow.push_back(std::move(entry));
+    queues.has_overflow.store(true, std::memory_order_release);
+  }
+
+  /// Move all queued messages into the `Storage`. Must only be called by the
+  /// thread that owns the receiving element.
+  void collect() {
+    Queues* const queues = queues_.load(std::memory_order_acquire);
+    if (queues == nullptr) {
+      return;
+    }
+    while (auto* const entry = queues->queue.front()) {
+      InboxTag::insert_into_inbox(make_not_null(static_cast<Storage*>(this)),
+                                  entry->first, std::move(entry->second));
+      queues->queue.pop();
+    }
+    if (UNLIKELY(queues->has_overflow.load(std::memory_order_acquire))) {
+      const std::lock_guard lock(queues->overflow_mutex);
+      for (auto& entry : queues->overflow) {
+        InboxTag::insert_into_inbox(make_not_null(static_cast<Storage*>(this)),
+                                    entry.first, std::move(entry.second));
+      }
+      queues->overflow.clear();
+      queues->has_overflow.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  /// Whether messages have been inserted that were not collected yet. Must
+  /// only be called by the thread that owns the receiving element.
+  bool has_uncollected_messages() const {
+    const Queues* const queues = queues_.load(std::memory_order_acquire);
+    return queues != nullptr and
+           (not queues->queue.empty() or
+            queues->has_overflow.load(std::memory_order_acquire));
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    if (UNLIKELY(has_uncollected_messages())) {
+      ERROR("Can only serialize an AtomicInbox without uncollected messages.");
+    }
+    p | static_cast<Storage&>(*this);
+  }
+
+ private:
+  using entry_type = std::pair<temporal_id, message_type>;
+
+  struct Queues {
+    StaticMpscQueue<entry_type, Capacity> queue{};
+    std::atomic<bool> has_overflow{false};
+    std::mutex overflow_mutex{};
+    std::vector<entry_type> overflow{};
+  };
+
+  Queues& get_or_allocate_queues() {
+    Queues* queues = queues_.load(std::memory_order_acquire);
+    if (LIKELY(queues != nullptr)) {
+      return *queues;
+    }
+    // Several producers may race to allocate the queues. Only one of them
+    // publishes its allocation, the others use the published queues.
+    auto new_queues = std::make_unique<Queues>();
+    if (queues_.compare_exchange_strong(queues, new_queues.get(),
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_acquire)) {
+      return *new_queues.release();
+    }
+    return *queues;
+  }
+
+  // Owned, allocated by the first `insert()`. Moving an `AtomicInbox` leaves
+  // the queues of both sides in place since they must be empty.
+  std::atomic<Queues*> queues_{nullptr};
+};
+
+/// \brief `std::true_type` if `T` is an `AtomicInbox`
+template <typename T>
+struct is_atomic_inbox : std::false_type {};
+
+/// \cond
+template <typename InboxTag, typename Storage, typename Message,
+          size_t Capacity>
+struct is_atomic_inbox<AtomicInbox<InboxTag, Storage, Message, Capacity>>
+    : std::true_type {};
+/// \endcond
+
+/// \brief `true` if `T` is an `AtomicInbox`
+template <typename T>
+constexpr bool is_atomic_inbox_v = is_atomic_inbox<T>::value;
+
+/// Move all queued messages into the storage of every `AtomicInbox` in the
+/// `inboxes`.
+template <typename... InboxTags>
+void collect_atomic_inboxes(
+    const gsl::not_null<tuples::TaggedTuple<InboxTags...>*> inboxes) {
+  tmpl::for_each<tmpl::list<InboxTags...>>([&inboxes](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    if constexpr (is_atomic_inbox_v<typename tag::type>) {
+      tuples::get<tag>(*inboxes).collect();
+    }
+  });
+}
+}  // namespace Parallel
@@ -0,0 +1,49 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/Printf/MessageBuffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Parallel::detail {
+MessageBuffer::MessageBuffer(const size_t max_size,
+                             const Clock::duration max_delay)
+    : max_size_(max_size), max_delay_(max_delay) {}
+
+std::optional<std::vector<char>> MessageBuffer::append(
+    const std::vector<char>& message) {
+  // Drop the null byte and anything after it
+  const auto message_end = std::find(message.begin(), message.end(), '\0');
+  const auto now = Clock::now();
+  const std::lock_guard hold_lock(mutex_);
+  if (buffer_.empty()) {
+    oldest_message_time_ = now;
+  }
+  buffer_.insert(buffer_.end(), message.begin(), message_end);
+  if (buffer_.size() > max_size_ or now - oldest_message_time_ > max_delay_) {
+    return take_buffer();
+  }
+  return std::nullopt;
+}
+
+std::optional<std::vector<char>> MessageBuffer::flush() {
+  const std::lock_guard hold_lock(mutex_);
+  return take_buffer();
+}
+
+std::optional<std::vector<char>> MessageBuffer::take_buffer() {
+  if (buffer_.empty()) {
+    return std::nullopt;
+  }
+  std::vector<char> messages = std::move(buffer_);
+  buffer_.clear();
+  messages.push_back('\0');
+  return messages;
+}
+}  // namespace Parallel::detail
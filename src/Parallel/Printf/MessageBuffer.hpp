@@ -0,0 +1,54 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace Parallel::detail {
+/*!
+ * \brief Collects the messages printed to stdout on a node so they can be sent
+ * to the `Parallel::PrinterChare` in batches
+ *
+ * \details Sending every message on its own costs one entry method invocation
+ * per message, which dominates the runtime when many small messages are
+ * printed, e.g. with debug verbosity. Instead, messages are appended to this
+ * buffer and are only sent once the buffer holds more than `max_size`
+ * characters or its oldest message was buffered more than `max_delay` ago.
+ * Both conditions are checked on the next `append`, there is no timer.
+ * Buffered messages are also sent when `flush` is called, which happens when
+ * the PE goes idle, before errors are printed, and when the process exits
+ * normally.
+ *
+ * All member functions are threadsafe. They return the messages that should be
+ * sent, concatenated and terminated by a null byte, so the caller can send them
+ * without holding the lock.
+ */
+class MessageBuffer {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  MessageBuffer(size_t max_size, Clock::duration max_delay);
+
+  /// Append the null-terminated `message` to the buffer. Returns all buffered
+  /// messages if they should be sent now.
+  std::optional<std::vector<char>> append(const std::vector<char>& message);
+
+  /// Return all buffered messages and clear the buffer, or `std::nullopt` if
+  /// the buffer is empty.
+  std::optional<std::vector<char>> flush();
+
+ private:
+  std::optional<std::vector<char>> take_buffer();
+
+  size_t max_size_;
+  Clock::duration max_delay_;
+  std::mutex mutex_{};
+  std::vector<char> buffer_{};
+  Clock::time_point oldest_message_time_{};
+};
+}  // namespace Parallel::detail
@@ -4,11 +4,16 @@
 #include "Parallel/Printf/Printf.hpp"
 
 #include <cerrno>
+#include <chrono>
+#include <converse.h>
 #include <cstdio>
+#include <cstdlib>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "Parallel/Printf/MessageBuffer.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/ErrorHandling/Strerror.hpp"
 #include "Utilities/System/ParallelInfo.hpp"
@@ -64,9 +69,73 @@ void do_print_to_file(const std::string& file,
 
 namespace Parallel {
 namespace detail {
+namespace {
+// Messages to stdout from nodes other than node 0 are batched so verbose output
+// doesn't flood the runtime system with small messages. The delay is not a
+// timer: it is checked when the next message is appended, and messages that
+// are still buffered afterwards are sent once the PE goes idle.
+constexpr size_t max_buffered_characters = 65536;
+constexpr std::chrono::milliseconds max_buffer_delay{500};
+
+void print_buffered_messages_at_exit();
+
+MessageBuffer& node_message_buffer() {
+  static MessageBuffer buffer{max_buffered_characters, max_buffer_delay};
+  // Registered after the buffer is constructed so it runs before the buffer
+  // is destroyed
+  static const bool print_at_exit_is_registered = []() {
+    std::atexit(&print_buffered_messages_at_exit);
+    return true;
+  }();
+  (void)print_at_exit_is_registered;
+  return buffer;
+}
+
+// The runtime system no longer delivers messages when the process exits
+// normally, e.g. after `sys::exit`, so messages that are still buffered at that
+// point are printed on this node directly instead of being lost. Aborting
+// through the runtime system (`CkAbort`, `MPI_Abort`) doesn't run `atexit`
+// handlers, so messages buffered at that point are lost. Errors reported
+// through `Parallel::printf` send the buffer before the error message.
+void print_buffered_messages_at_exit() {
+  const std::optional<std::vector<char>> messages =
+      node_message_buffer().flush();
+  if (messages.has_value()) {
+    do_print(false, *messages);
+    // NOLINTNEXTLINE(cert-err33-c)
+    std::fflush(stdout);
+  }
+}
+
+void send_buffered_messages(void* /*unused*/) {
+  const std::optional<std::vector<char>> messages =
+      node_message_buffer().flush();
+  if (messages.has_value()) {
+    printer_chare[0].print(false, *messages);
+  }
+}
+}  // namespace
+
 void send_message(const bool error, const std::vector<char>& message) {
   if (printer_chare_is_set and sys::my_node() != 0) {
-    printer_chare[0].print(error, message);
+    if (error) {
+      // Keep the buffered messages in order with the error
+      send_buffered_messages(nullptr);
+      printer_chare[0].print(error, message);
+      return;
+    }
+    // Send the remaining buffered messages when this PE runs out of work
+    thread_local const bool flush_when_idle_is_registered = []() {
+      CcdCallOnConditionKeep(CcdPROCESSOR_BEGIN_IDLE, &send_buffered_messages,
+                             nullptr);
+      return true;
+    }();
+    (void)flush_when_idle_is_registered;
+    const std::optional<std::vector<char>> messages =
+        node_message_buffer().append(message);
+    if (messages.has_value()) {
+      printer_chare[0].print(false, *messages);
+    }
   } else {
     do_print(error, message);
   }
@@ -0,0 +1,179 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>  // std::byte
+#include <new>  // Placement new
+#include <type_traits>
+#include <utility>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Requires.hpp"
+
+namespace Parallel {
+/*!
+ * \brief A static capacity multi-producer single-consumer lockfree queue.
+ *
+ * Any number of threads may push to the queue simultaneously, while only one
+ * thread at a time may read from it. Which thread reads can change throughout
+ * program execution, the important thing is that there is no instance during
+ * the execution where more than one thread tries to read.
+ *
+ * Each slot carries a sequence number that tells producers whether the slot is
+ * free and tells the consumer whether the slot has been filled (the bounded
+ * queue design by D. Vyukov). Producers claim slots with a single
+ * compare-and-swap on the write index and never wait on each other, and the
+ * consumer never writes to the write index. Unlike `StaticSpscQueue` there is
+ * no blocking `emplace`, since a producer waiting on a full queue could
+ * deadlock if the consumer runs on the same thread.
+ *
+ * \note This class is intentionally not serializable since handling
+ * threadsafety around serialization requires careful thought of the individual
+ * circumstances.
+ */
+template <typename T, size_t Capacity>
+class StaticMpscQueue {
+ private:
+  // With a single slot the sequence number of a filled slot equals that of
+  // the free slot on the next lap, so producers could overwrite it.
+  static_assert(Capacity >= 2, "The queue must have a capacity of at least 2.");
+
+#ifdef __cpp_lib_hardware_interference_size
+  static constexpr size_t cache_line_size_ =
+      std::hardware_destructive_interference_size;
+#else
+  static constexpr size_t cache_line_size_ = 64;
+#endif
+
+  struct alignas(cache_line_size_) Slot {
+    std::atomic<size_t> sequence;
+    alignas(T) std::byte storage[sizeof(T)];
+  };
+
+ public:
+  StaticMpscQueue() {
+    for (size_t i = 0; i < Capacity; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ~StaticMpscQueue() {
+    // Destruct objects in the buffer.
+    while (front()) {
+      pop();
+    }
+  }
+
+  StaticMpscQueue(const StaticMpscQueue&) = delete;
+  StaticMpscQueue& operator=(const StaticMpscQueue&) = delete;
+  StaticMpscQueue(StaticMpscQueue&&) = delete;
+  StaticMpscQueue& operator=(StaticMpscQueue&&) = delete;
+
+  /// Construct a new element at the end of the queue in place.
+  ///
+  /// Returns `true` if the emplacement succeeded and `false` if it did
+  /// not. If it failed then the queue is currently full.
+  template <typename... Args>
+  [[nodiscard]] bool try_emplace(Args&&... args) noexcept(
+      std::is_nothrow_constructible_v<T, Args&&...>) {
+    static_assert(std::is_constructible_v<T, Args&&...>,
+                  "T must be constructible with Args&&...");
+    size_t write_index = write_index_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;) {
+      slot = &slot_for(write_index);
+      const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      if (sequence == write_index) {
+        // The slot is free, try to claim it. On failure `write_index` is
+        // updated to the current value.
+        if (write_index_.compare_exchange_weak(write_index, write_index + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (sequence < write_index) {
+        // The slot still holds the element from the previous lap, so the
+        // queue is full.
+        return false;
+      } else {
+        // Another producer claimed the slot.
+        write_index = write_index_.load(std::memory_order_relaxed);
+      }
+    }
+    new (&slot->storage) T(std::forward<Args>(args)...);
+    slot->sequence.store(write_index + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Push a new element to the end of the queue. Returns `false` if the queue
+  /// is at capacity and does not push the new object, otherwise returns `true`.
+  ///
+  /// Uses `try_emplace()` internally.
+  template <typename P, Requires<std::is_constructible_v<T, P&&>> = nullptr>
+  [[nodiscard]] bool try_push(P&& v) noexcept(
+      std::is_nothrow_constructible_v<T, P&&>) {
+    return try_emplace(std::forward<P>(v));
+  }
+
+  /// Returns the first element from the queue. Must only be called by the
+  /// consumer.
+  ///
+  /// \note Returns `nullptr` if the queue is empty.
+  [[nodiscard]] T* front() noexcept {
+    Slot& slot = slot_for(read_index_);
+    if (slot.sequence.load(std::memory_order_acquire) != read_index_ + 1) {
+      return nullptr;
+    }
+    return std::launder(reinterpret_cast<T*>(&slot.storage));
+  }
+
+  /// Removes the first element from the queue. Must only be called by the
+  /// consumer.
+  void pop() {
+    static_assert(std::is_nothrow_destructible_v<T>,
+                  "T must be nothrow destructible");
+    T* const element = front();
+    ASSERT(element != nullptr, "Can't pop an element from an empty queue.");
+    element->~T();
+    slot_for(read_index_)
+        .sequence.store(read_index_ + Capacity, std::memory_order_release);
+    ++read_index_;
+  }
+
+  /// Returns the number of elements in the queue. This is only exact when
+  /// there are no producers pushing concurrently.
+  [[nodiscard]] size_t size() const noexcept {
+    return write_index_.load(std::memory_order_acquire) - read_index_;
+  }
+
+  /// Returns `true` if the queue is empty. Must only be called by the
+  /// consumer.
+  [[nodiscard]] bool empty() const noexcept {
+    return slot_for(read_index_).sequence.load(std::memory_order_acquire) !=
+           read_index_ + 1;
+  }
+
+  /// Returns the capacity of the queue.
+  [[nodiscard]] static constexpr size_t capacity() noexcept {
+    return Capacity;
+  }
+
+ private:
+  Slot& slot_for(const size_t index) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    return slots_[index % Capacity];
+  }
+  const Slot& slot_for(const size_t index) const noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    return slots_[index % Capacity];
+  }
+
+  std::array<Slot, Capacity> slots_{};
+  // Align to avoid false sharing between the producers and the consumer
+  alignas(cache_line_size_) std::atomic<size_t> write_index_{0};
+  alignas(cache_line_size_) size_t read_index_{0};
+};
+}  // namespace Parallel
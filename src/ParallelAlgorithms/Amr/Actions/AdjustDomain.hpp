@@ -77,6 +77,10 @@ namespace amr::Actions {
 /// - Resets amr::Tags::Flag%s to amr::Flag::Undefined
 /// - Resets amr::Tags::NeighborInfo to an empty map
 /// - Mutates all return_tags of Metavariables::amr::projectors
+///
+/// The last five steps are done by `adjust_element`, which can also be used
+/// for elements that are not members of an array (see
+/// amr::Actions::AdjustDomainOnNode).
 struct AdjustDomain {
   template <typename ParallelComponent, typename DbTagList,
             typename Metavariables>
@@ -84,43 +88,12 @@ struct AdjustDomain {
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ElementId<Metavariables::volume_dim>& element_id) {
     constexpr size_t volume_dim = Metavariables::volume_dim;
-    using amr_projectors = typename Metavariables::amr::projectors;
-    static_assert(
-        tmpl::all<
-            amr_projectors,
-            tt::assert_conforms_to<tmpl::_1, amr::protocols::Projector>>::value,
-        "All AMR projectors must conform to 'amr::protocols::Projector'.");
-
-    // To prevent bugs when new mutable items are added to a DataBox, we require
-    // that all mutable_item_creation_tags of box are either:
-    // - mutated by one of the projectors in Metavariables::amr::projectors
-    // - in the list of distributed_object_tags
-    // - or in the list of tags mutated by this action
-    using distributed_object_tags =
-        typename ::Parallel::Tags::distributed_object_tags<
-            Metavariables, ElementId<volume_dim>>;
-    using tags_mutated_by_this_action = tmpl::list<
-        ::domain::Tags::Element<volume_dim>, ::domain::Tags::Mesh<volume_dim>,
-        ::domain::Tags::NeighborMesh<volume_dim>, amr::Tags::Info<volume_dim>,
-        amr::Tags::NeighborInfo<volume_dim>>;
-    using mutated_tags =
-        tmpl::append<distributed_object_tags, tags_mutated_by_this_action,
-                     typename detail::GetMutatedTags<amr_projectors>::type>;
-    using mutable_tags =
-        typename db::DataBox<DbTagList>::mutable_item_creation_tags;
-    using mutable_tags_not_mutated =
-        tmpl::list_difference<mutable_tags, mutated_tags>;
-    static_assert(std::is_same_v<mutable_tags_not_mutated, tmpl::list<>>,
-                  "All mutable tags in the DataBox must be explicitly mutated "
-                  "by an amr::projector.  Default initialized objects can use "
-                  "amr::projector::DefaultInitialize.");
+    assert_all_mutable_tags_are_mutated<Metavariables, DbTagList>();
 
     const auto& my_amr_info = db::get<amr::Tags::Info<volume_dim>>(box);
     const auto& my_amr_flags = my_amr_info.flags;
     auto& element_array =
         Parallel::get_parallel_component<ParallelComponent>(cache);
-    const auto& phase_bookmarks =
-        Parallel::local(element_array[element_id])->phase_bookmarks();
     const auto& verbosity =
         db::get<logging::Tags::Verbosity<amr::OptionTags::AmrGroup>>(box);
 
@@ -152,9 +125,9 @@ struct AdjustDomain {
         Parallel::printf("Splitting element %s into %zu: %s\n", element_id,
                          children_ids.size(), children_ids);
       }
-      Parallel::simple_action<CreateChild>(amr_component, element_array,
-                                           element_id, children_ids, 0_st,
-                                           phase_bookmarks);
+      Parallel::simple_action<CreateChild>(
+          amr_component, element_array, element_id, children_ids, 0_st,
+          Parallel::local(element_array[element_id])->phase_bookmarks());
 
     } else if (alg::any_of(my_amr_flags, [](amr::Flag flag) {
                  return flag == amr::Flag::Join;
@@ -174,95 +147,150 @@ struct AdjustDomain {
         }
         Parallel::simple_action<CreateParent>(
             amr_component, element_array, std::move(parent_id), element_id,
-            std::move(ids_to_join), phase_bookmarks);
+            std::move(ids_to_join),
+            Parallel::local(element_array[element_id])->phase_bookmarks());
       }
 
     } else {
       // Neither h-refinement nor h-coarsening. This element will remain.
-      const auto old_mesh_and_element =
-          std::make_pair(db::get<::domain::Tags::Mesh<volume_dim>>(box),
-                         db::get<::domain::Tags::Element<volume_dim>>(box));
-      const auto& old_mesh = old_mesh_and_element.first;
-
-      // Determine new neighbors and update the Element
-      {  // avoid shadowing when mutating flags below
-        using NeighborMeshType =
-            DirectionalIdMap<volume_dim, ::Mesh<volume_dim>>;
-        const auto& amr_info_of_neighbors =
-            db::get<amr::Tags::NeighborInfo<volume_dim>>(box);
-        db::mutate<::domain::Tags::Element<volume_dim>,
-                   ::domain::Tags::NeighborMesh<volume_dim>>(
-            [&element_id, &amr_info_of_neighbors](
-                const gsl::not_null<Element<volume_dim>*> element,
-                const gsl::not_null<NeighborMeshType*> neighbor_meshes) {
-              auto new_neighbors = element->neighbors();
-              neighbor_meshes->clear();
-              for (auto& [direction, neighbors] : new_neighbors) {
-                const auto new_neighbor_ids_and_meshes = amr::new_neighbor_ids(
-                    element_id, direction, neighbors, amr_info_of_neighbors);
-                std::unordered_set<ElementId<volume_dim>> new_neighbor_ids;
-                for (const auto& [id, mesh] : new_neighbor_ids_and_meshes) {
-                  neighbor_meshes->insert({{direction, id}, mesh});
-                  new_neighbor_ids.insert(id);
-                }
-                neighbors.set_ids_to(new_neighbor_ids);
-              }
-              *element =
-                  Element<volume_dim>(element_id, std::move(new_neighbors));
-            },
-            make_not_null(&box));
-      }
-
-      // Check for p-refinement
-      if (alg::any_of(my_amr_flags, [](amr::Flag flag) {
-            return (flag == amr::Flag::IncreaseResolution or
-                    flag == amr::Flag::DecreaseResolution);
-          })) {
-        db::mutate<::domain::Tags::Mesh<volume_dim>>(
-            [&old_mesh,
-             &my_amr_flags](const gsl::not_null<Mesh<volume_dim>*> mesh) {
-              *mesh = amr::projectors::mesh(old_mesh, my_amr_flags);
-            },
-            make_not_null(&box));
+      adjust_element<Metavariables>(make_not_null(&box), element_id);
+    }
+  }
 
-        if (verbosity >= Verbosity::Debug) {
-          Parallel::printf(
-              "Increasing order of element %s: %s -> %s\n", element_id,
-              old_mesh.extents(),
-              db::get<::domain::Tags::Mesh<volume_dim>>(box).extents());
-        }
-      }
+  /// \brief Adjusts an element that neither splits nor joins
+  ///
+  /// \details Updates the neighbors and (if requested by the AMR flags) the
+  /// mesh of the element, runs all Metavariables::amr::projectors, and resets
+  /// the AMR flags.
+  template <typename Metavariables, typename DbTagList>
+  static void adjust_element(
+      const gsl::not_null<db::DataBox<DbTagList>*> box_ptr,
+      const ElementId<Metavariables::volume_dim>& element_id) {
+    constexpr size_t volume_dim = Metavariables::volume_dim;
+    using amr_projectors = typename Metavariables::amr::projectors;
+    assert_all_mutable_tags_are_mutated<Metavariables, DbTagList>();
+    auto& box = *box_ptr;
+    const auto& my_amr_flags = db::get<amr::Tags::Info<volume_dim>>(box).flags;
+    const auto& verbosity =
+        db::get<logging::Tags::Verbosity<amr::OptionTags::AmrGroup>>(box);
+    const auto old_mesh_and_element =
+        std::make_pair(db::get<::domain::Tags::Mesh<volume_dim>>(box),
+                       db::get<::domain::Tags::Element<volume_dim>>(box));
+    const auto& old_mesh = old_mesh_and_element.first;
 
-      // Run the projectors on all elements, even if they did no h-refinement.
-      // This allows projectors to update mutable items that depend upon the
-      // neighbors of the element.
-      tmpl::for_each<amr_projectors>(
-          [&box, &old_mesh_and_element](auto projector_v) {
-            using projector = typename decltype(projector_v)::type;
-            try {
-              db::mutate_apply<projector>(make_not_null(&box),
-                                          old_mesh_and_element);
-            } catch (std::exception& e) {
-              ERROR("Error in AMR projector '"
-                    << pretty_type::get_name<projector>() << "':\n"
-                    << e.what());
+    // Determine new neighbors and update the Element
+    {  // avoid shadowing when mutating flags below
+      using NeighborMeshType = DirectionalIdMap<volume_dim, ::Mesh<volume_dim>>;
+      const auto& amr_info_of_neighbors =
+          db::get<amr::Tags::NeighborInfo<volume_dim>>(box);
+      db::mutate<::domain::Tags::Element<volume_dim>,
+                 ::domain::Tags::NeighborMesh<volume_dim>>(
+          [&element_id, &amr_info_of_neighbors](
+              const gsl::not_null<Element<volume_dim>*> element,
+              const gsl::not_null<NeighborMeshType*> neighbor_meshes) {
+            auto new_neighbors = element->neighbors();
+            neighbor_meshes->clear();
+            for (auto& [direction, neighbors] : new_neighbors) {
+              const auto new_neighbor_ids_and_meshes = amr::new_neighbor_ids(
+                  element_id, direction, neighbors, amr_info_of_neighbors);
+              std::unordered_set<ElementId<volume_dim>> new_neighbor_ids;
+              for (const auto& [id, mesh] : new_neighbor_ids_and_meshes) {
+                neighbor_meshes->insert({{direction, id}, mesh});
+                new_neighbor_ids.insert(id);
+              }
+              neighbors.set_ids_to(new_neighbor_ids);
             }
-          });
+            *element =
+                Element<volume_dim>(element_id, std::move(new_neighbors));
+          },
+          make_not_null(&box));
+    }
 
-      // Reset the AMR flags
-      db::mutate<amr::Tags::Info<volume_dim>,
-                 amr::Tags::NeighborInfo<volume_dim>>(
-          [](const gsl::not_null<amr::Info<volume_dim>*> amr_info,
-             const gsl::not_null<std::unordered_map<ElementId<volume_dim>,
-                                                    amr::Info<volume_dim>>*>
-                 amr_info_of_neighbors) {
-            amr_info_of_neighbors->clear();
-            for (size_t d = 0; d < volume_dim; ++d) {
-              amr_info->flags[d] = amr::Flag::Undefined;
-            }
+    // Check for p-refinement
+    if (alg::any_of(my_amr_flags, [](amr::Flag flag) {
+          return (flag == amr::Flag::IncreaseResolution or
+                  flag == amr::Flag::DecreaseResolution);
+        })) {
+      db::mutate<::domain::Tags::Mesh<volume_dim>>(
+          [&old_mesh,
+           &my_amr_flags](const gsl::not_null<Mesh<volume_dim>*> mesh) {
+            *mesh = amr::projectors::mesh(old_mesh, my_amr_flags);
           },
           make_not_null(&box));
+
+      if (verbosity >= Verbosity::Debug) {
+        Parallel::printf(
+            "Increasing order of element %s: %s -> %s\n", element_id,
+            old_mesh.extents(),
+            db::get<::domain::Tags::Mesh<volume_dim>>(box).extents());
+      }
     }
+
+    // Run the projectors on all elements, even if they did no h-refinement.
+    // This allows projectors to update mutable items that depend upon the
+    // neighbors of the element.
+    tmpl::for_each<amr_projectors>(
+        [&box, &old_mesh_and_element](auto projector_v) {
+          using projector = typename decltype(projector_v)::type;
+          try {
+            db::mutate_apply<projector>(make_not_null(&box),
+                                        old_mesh_and_element);
+          } catch (std::exception& e) {
+            ERROR("Error in AMR projector '"
+                  << pretty_type::get_name<projector>() << "':\n"
+                  << e.what());
+          }
+        });
+
+    // Reset the AMR flags
+    db::mutate<amr::Tags::Info<volume_dim>,
+               amr::Tags::NeighborInfo<volume_dim>>(
+        [](const gsl::not_null<amr::Info<volume_dim>*> amr_info,
+           const gsl::not_null<std::unordered_map<ElementId<volume_dim>,
+                                                  amr::Info<volume_dim>>*>
+               amr_info_of_neighbors) {
+          amr_info_of_neighbors->clear();
+          for (size_t d = 0; d < volume_dim; ++d) {
+            amr_info->flags[d] = amr::Flag::Undefined;
+          }
+        },
+        make_not_null(&box));
+  }
+
+ private:
+  template <typename Metavariables, typename DbTagList>
+  static constexpr void assert_all_mutable_tags_are_mutated() {
+    constexpr size_t volume_dim = Metavariables::volume_dim;
+    using amr_projectors = typename Metavariables::amr::projectors;
+    static_assert(
+        tmpl::all<
+            amr_projectors,
+            tt::assert_conforms_to<tmpl::_1, amr::protocols::Projector>>::value,
+        "All AMR projectors must conform to 'amr::protocols::Projector'.");
+
+    // To prevent bugs when new mutable items are added to a DataBox, we require
+    // that all mutable_item_creation_tags of box are either:
+    // - mutated by one of the projectors in Metavariables::amr::projectors
+    // - in the list of distributed_object_tags
+    // - or in the list of tags mutated by this action
+    using distributed_object_tags =
+        typename ::Parallel::Tags::distributed_object_tags<
+            Metavariables, ElementId<volume_dim>>;
+    using tags_mutated_by_this_action = tmpl::list<
+        ::domain::Tags::Element<volume_dim>, ::domain::Tags::Mesh<volume_dim>,
+        ::domain::Tags::NeighborMesh<volume_dim>, amr::Tags::Info<volume_dim>,
+        amr::Tags::NeighborInfo<volume_dim>>;
+    using mutated_tags =
+        tmpl::append<distributed_object_tags, tags_mutated_by_this_action,
+                     typename detail::GetMutatedTags<amr_projectors>::type>;
+    using mutable_tags =
+        typename db::DataBox<DbTagList>::mutable_item_creation_tags;
+    using mutable_tags_not_mutated =
+        tmpl::list_difference<mutable_tags, mutated_tags>;
+    static_assert(std::is_same_v<mutable_tags_not_mutated, tmpl::list<>>,
+                  "All mutable tags in the DataBox must be explicitly mutated "
+                  "by an amr::projector.  Default initialized objects can use "
+                  "amr::projector::DefaultInitialize.");
   }
 };
 }  // namespace amr::Actions
@@ -0,0 +1,447 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Helpers.hpp"
+#include "Domain/Amr/Tags/Flags.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
+#include "Parallel/ArrayCollection/UpdateElementLocations.hpp"
+#include "Parallel/ElementRegistration.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/Printf/Printf.hpp"
+#include "ParallelAlgorithms/Amr/Actions/AdjustDomain.hpp"
+#include "ParallelAlgorithms/Amr/Actions/InitializeChild.hpp"
+#include "ParallelAlgorithms/Amr/Actions/InitializeParent.hpp"
+#include "ParallelAlgorithms/Amr/Tags.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace amr::Tags {
+/// \brief The mutable items of joining children that were sent from other
+/// nodes, keyed by the id of the parent they join into.
+///
+/// The items are held by the node of the child that creates the parent until
+/// the items of all children have arrived (see
+/// amr::Actions::AdjustDomainOnNode). This tag must be in the DataBox of a
+/// `Parallel::DgElementCollection` whose elements use AMR.
+template <typename ElementCollectionTag>
+struct JoiningChildrenItems : db::SimpleTag {
+  using element_id_type = typename ElementCollectionTag::type::key_type;
+  using items_type = tuples::tagged_tuple_from_typelist<
+      typename ElementCollectionTag::type::mapped_type::databox_type::
+          mutable_item_creation_tags>;
+  using type = std::unordered_map<
+      element_id_type, std::unordered_map<element_id_type, items_type>>;
+};
+}  // namespace amr::Tags
+
+namespace amr::Actions {
+namespace detail {
+// Moves the items with the `TagsList` out of the `box`, which must not be used
+// afterwards
+template <typename TagsList, typename DbTagList>
+tuples::tagged_tuple_from_typelist<TagsList> move_items(
+    const gsl::not_null<db::DataBox<DbTagList>*> box) {
+  tuples::tagged_tuple_from_typelist<TagsList> items{};
+  tmpl::for_each<TagsList>([&box, &items](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    db::mutate<tag>(
+        [&items](const auto value) {
+          tuples::get<tag>(items) = std::move(*value);
+        },
+        box);
+  });
+  return items;
+}
+
+template <typename ElementCollection>
+using element_items_type = tuples::tagged_tuple_from_typelist<
+    typename ElementCollection::mapped_type::databox_type::
+        mutable_item_creation_tags>;
+
+// Moves the items out of an element that is replaced and removes it
+template <typename ParallelComponent, typename ElementCollection,
+          typename Metavariables>
+element_items_type<ElementCollection> remove_element(
+    const gsl::not_null<ElementCollection*> element_collection,
+    Parallel::GlobalCache<Metavariables>& cache,
+    const typename ElementCollection::key_type& element_id,
+    const gsl::not_null<std::vector<typename ElementCollection::key_type>*>
+        removed_ids) {
+  auto& element_box = element_collection->at(element_id).databox();
+  Parallel::deregister_element<ParallelComponent>(element_box, cache,
+                                                  element_id);
+  auto items = move_items<typename ElementCollection::mapped_type::
+                              databox_type::mutable_item_creation_tags>(
+      make_not_null(&element_box));
+  element_collection->erase(element_id);
+  removed_ids->push_back(element_id);
+  return items;
+}
+
+// Adds an element that is created from the elements it replaces. Only the
+// phase bookmarks and the core are taken from the replaced elements,
+// everything else is projected into the new element by the caller.
+template <typename ElementCollection, typename Metavariables>
+typename ElementCollection::mapped_type& add_element(
+    const gsl::not_null<ElementCollection*> element_collection,
+    Parallel::GlobalCache<Metavariables>& cache,
+    const typename ElementCollection::key_type& element_id,
+    const std::unordered_map<Parallel::Phase, size_t>& phase_bookmarks,
+    const size_t core,
+    const gsl::not_null<std::vector<typename ElementCollection::key_type>*>
+        added_ids) {
+  auto& element =
+      element_collection
+          ->emplace(std::piecewise_construct, std::forward_as_tuple(element_id),
+                    std::forward_as_tuple(cache.get_this_proxy(),
+                                          Parallel::Phase::AdjustDomain,
+                                          phase_bookmarks, element_id))
+          .first->second;
+  element.set_core(core);
+  added_ids->push_back(element_id);
+  return element;
+}
+
+// The parent of a joining child, the ids of all children that join into the
+// parent, and the id of the child that creates the parent
+template <size_t Dim>
+std::tuple<ElementId<Dim>, std::vector<ElementId<Dim>>, ElementId<Dim>>
+ids_for_join(const ElementId<Dim>& child_id,
+             const std::array<amr::Flag, Dim>& flags) {
+  auto parent_id = amr::id_of_parent(child_id, flags);
+  std::array<amr::Flag, Dim> parent_flags{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(parent_flags, d) = gsl::at(flags, d) == amr::Flag::Join
+                                   ? amr::Flag::Split
+                                   : amr::Flag::DoNothing;
+  }
+  auto ids_to_join = amr::ids_of_children(parent_id, parent_flags);
+  auto creator_id = *alg::find_if(ids_to_join, [&flags](const auto& id) {
+    return amr::is_child_that_creates_parent(id, flags);
+  });
+  return {std::move(parent_id), std::move(ids_to_join), std::move(creator_id)};
+}
+
+// Replaces the joining children by their parent once the items of all
+// children that were on other nodes have arrived. The child that creates the
+// parent must be in the `element_collection`.
+template <typename ParallelComponent, typename ElementCollection,
+          typename JoiningChildrenItems, typename Metavariables>
+void join_if_all_children_arrived(
+    const gsl::not_null<ElementCollection*> element_collection,
+    const gsl::not_null<JoiningChildrenItems*> joining_children_items,
+    Parallel::GlobalCache<Metavariables>& cache,
+    const typename ElementCollection::key_type& parent_id,
+    const std::vector<typename ElementCollection::key_type>& ids_to_join,
+    const typename ElementCollection::key_type& creator_id,
+    const gsl::not_null<std::vector<typename ElementCollection::key_type>*>
+        removed_ids,
+    const gsl::not_null<std::vector<typename ElementCollection::key_type>*>
+        added_ids) {
+  ASSERT(element_collection->count(creator_id) == 1,
+         "The child " << creator_id << " that creates the parent " << parent_id
+                      << " must be on this node.");
+  const auto items_from_other_nodes = joining_children_items->find(parent_id);
+  for (const auto& id_to_join : ids_to_join) {
+    if (element_collection->count(id_to_join) == 0 and
+        (items_from_other_nodes == joining_children_items->end() or
+         items_from_other_nodes->second.count(id_to_join) == 0)) {
+      return;
+    }
+  }
+
+  const auto phase_bookmarks =
+      element_collection->at(creator_id).phase_bookmarks();
+  const size_t core = element_collection->at(creator_id).get_core();
+  std::unordered_map<typename ElementCollection::key_type,
+                     element_items_type<ElementCollection>>
+      children_items{};
+  if (items_from_other_nodes != joining_children_items->end()) {
+    children_items = std::move(items_from_other_nodes->second);
+    joining_children_items->erase(items_from_other_nodes);
+  }
+  for (const auto& id_to_join : ids_to_join) {
+    if (children_items.count(id_to_join) == 0) {
+      children_items.emplace(
+          id_to_join, remove_element<ParallelComponent>(
+                          element_collection, cache, id_to_join, removed_ids));
+    }
+  }
+  auto& parent = add_element(element_collection, cache, parent_id,
+                             phase_bookmarks, core, added_ids);
+  InitializeParent::apply<ParallelComponent>(parent.databox(), cache, parent_id,
+                                             std::move(children_items));
+}
+
+// New elements start out terminated, so count the terminated elements again
+template <typename ElementCollectionTag, typename DbTagList>
+void update_number_of_elements_terminated(
+    const gsl::not_null<db::DataBox<DbTagList>*> box) {
+  const auto& element_collection = db::get<ElementCollectionTag>(*box);
+  db::mutate<Parallel::Tags::NumberOfElementsTerminated>(
+      [&element_collection](
+          const gsl::not_null<size_t*> number_of_elements_terminated) {
+        *number_of_elements_terminated = static_cast<size_t>(
+            alg::count_if(element_collection, [](const auto& id_and_element) {
+              return id_and_element.second.get_terminate();
+            }));
+      },
+      box);
+}
+}  // namespace detail
+
+/*!
+ * \brief Receives the items of a joining child from another node and creates
+ * the parent once the items of all its children are on this node
+ *
+ * \details This threaded action is sent by amr::Actions::AdjustDomainOnNode to
+ * the node of the child that creates the parent. The added parent is broadcast
+ * with Parallel::Actions::UpdateElementLocations.
+ */
+struct CollectJoiningChildOnNode {
+  template <typename ParallelComponent, typename DbTagList,
+            typename Metavariables, typename ArrayIndex,
+            typename DistributedObject, size_t Dim, typename... ItemsTags>
+  static void apply(db::DataBox<DbTagList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const DistributedObject* /*distributed_object*/,
+                    const ElementId<Dim>& child_id,
+                    tuples::TaggedTuple<ItemsTags...> child_items) {
+    using element_collection_tag =
+        typename ParallelComponent::element_collection_tag;
+    using joining_children_items_tag =
+        amr::Tags::JoiningChildrenItems<element_collection_tag>;
+
+    std::vector<ElementId<Dim>> removed_ids{};
+    std::vector<ElementId<Dim>> added_ids{};
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      const auto flags = tuples::get<amr::Tags::Info<Dim>>(child_items).flags;
+      const auto [parent_id, ids_to_join, creator_id] =
+          detail::ids_for_join(child_id, flags);
+      auto& joining_children_items =
+          db::get_mutable_reference<joining_children_items_tag>(
+              make_not_null(&box));
+      joining_children_items[parent_id].emplace(child_id,
+                                                std::move(child_items));
+      detail::join_if_all_children_arrived<ParallelComponent>(
+          make_not_null(&db::get_mutable_reference<element_collection_tag>(
+              make_not_null(&box))),
+          make_not_null(&joining_children_items), cache, parent_id,
+          ids_to_join, creator_id, make_not_null(&removed_ids),
+          make_not_null(&added_ids));
+      detail::update_number_of_elements_terminated<element_collection_tag>(
+          make_not_null(&box));
+    }
+
+    if (not added_ids.empty()) {
+      Parallel::threaded_action<Parallel::Actions::UpdateElementLocations>(
+          Parallel::get_parallel_component<ParallelComponent>(cache),
+          std::move(removed_ids), std::move(added_ids),
+          Parallel::my_node<size_t>(cache));
+    }
+  }
+};
+
+/*!
+ * \brief Adjusts the domain of all elements of a
+ * `Parallel::DgElementCollection` on this node given the refinement criteria
+ *
+ * \details This is the counterpart of amr::Actions::AdjustDomain for elements
+ * that live in a nodegroup `Parallel::DgElementCollection` instead of an array.
+ * Since all elements of the node are held by the nodegroup, no new parallel
+ * objects have to be created:
+ * - Elements that neither split nor join (including pure p-refinement) are
+ *   adjusted in place by amr::Actions::AdjustDomain::adjust_element.
+ * - Elements that split are replaced by their children on this node. The items
+ *   of the parent are moved out of its DataBox and projected directly into the
+ *   DataBoxes of the children by amr::Actions::InitializeChild.
+ * - Elements that join are replaced by their parent on the node of the child
+ *   that creates the parent. The items of the children are moved out of their
+ *   DataBoxes and projected into the DataBox of the parent by
+ *   amr::Actions::InitializeParent. Children that are on other nodes (e.g.
+ *   because the elements were distributed across nodes at the start of the
+ *   evolution) are removed from their node and their items are sent to the
+ *   node of the creating child with amr::Actions::CollectJoiningChildOnNode.
+ *   The parent is created as soon as the items of all children are on that
+ *   node, either in this action or in amr::Actions::CollectJoiningChildOnNode.
+ *
+ * Finally, the Parallel::Tags::ElementLocations on all nodes are updated by a
+ * single broadcast of Parallel::Actions::UpdateElementLocations.
+ *
+ * This threaded action is broadcast to the `DgElementCollection` by the
+ * amr::Component at the start of Parallel::Phase::AdjustDomain, during which
+ * the elements run no actions.
+ *
+ * DataBox:
+ * - Uses:
+ *   * `Parallel::Tags::ElementLocations<volume_dim>`
+ * - Modifies:
+ *   * `ParallelComponent::element_collection_tag`
+ *   * `amr::Tags::JoiningChildrenItems<element_collection_tag>`
+ *   * `Parallel::Tags::NumberOfElementsTerminated`
+ */
+struct AdjustDomainOnNode {
+  template <typename ParallelComponent, typename DbTagList,
+            typename Metavariables, typename ArrayIndex,
+            typename DistributedObject>
+  static void apply(db::DataBox<DbTagList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const DistributedObject* /*distributed_object*/) {
+    constexpr size_t volume_dim = Metavariables::volume_dim;
+    using element_collection_tag =
+        typename ParallelComponent::element_collection_tag;
+    using joining_children_items_tag =
+        amr::Tags::JoiningChildrenItems<element_collection_tag>;
+    using items_type = typename joining_children_items_tag::items_type;
+
+    std::vector<ElementId<volume_dim>> removed_ids{};
+    std::vector<ElementId<volume_dim>> added_ids{};
+    // Joining children whose parent is created on another node
+    std::vector<std::tuple<size_t, ElementId<volume_dim>, items_type>>
+        children_to_send{};
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      const auto& element_locations =
+          db::get<Parallel::Tags::ElementLocations<volume_dim>>(box);
+      auto& element_collection =
+          db::get_mutable_reference<element_collection_tag>(
+              make_not_null(&box));
+      auto& joining_children_items =
+          db::get_mutable_reference<joining_children_items_tag>(
+              make_not_null(&box));
+      // Elements are added to and removed from the collection below, so loop
+      // over the elements that exist before the adjustment
+      std::vector<ElementId<volume_dim>> element_ids{};
+      element_ids.reserve(element_collection.size());
+      for (const auto& [element_id, element] : element_collection) {
+        element_ids.push_back(element_id);
+      }
+
+      for (const auto& element_id : element_ids) {
+        const auto element_it = element_collection.find(element_id);
+        if (element_it == element_collection.end()) {
+          // The element was already joined into its parent
+          continue;
+        }
+        auto& element_box = element_it->second.databox();
+        const auto flags =
+            db::get<amr::Tags::Info<volume_dim>>(element_box).flags;
+        const auto verbosity =
+            db::get<logging::Tags::Verbosity<amr::OptionTags::AmrGroup>>(
+                element_box);
+
+        if (alg::all_of(flags, [](const amr::Flag flag) {
+              return flag == amr::Flag::Undefined;
+            })) {
+          continue;
+        } else if (alg::any_of(flags, [](const amr::Flag flag) {
+                     return flag == amr::Flag::Split;
+                   })) {
+          // h-refinement
+          const auto children_ids = amr::ids_of_children(element_id, flags);
+          if (verbosity >= Verbosity::Debug) {
+            Parallel::printf("Splitting element %s into %zu: %s\n", element_id,
+                             children_ids.size(), children_ids);
+          }
+          const auto phase_bookmarks = element_it->second.phase_bookmarks();
+          const size_t core = element_it->second.get_core();
+          const items_type parent_items = detail::remove_element<
+              ParallelComponent>(make_not_null(&element_collection), cache,
+                                 element_id, make_not_null(&removed_ids));
+          for (const auto& child_id : children_ids) {
+            auto& child =
+                detail::add_element(make_not_null(&element_collection), cache,
+                                    child_id, phase_bookmarks, core,
+                                    make_not_null(&added_ids));
+            InitializeChild::apply<ParallelComponent>(child.databox(), cache,
+                                                      child_id, parent_items);
+          }
+        } else if (alg::any_of(flags, [](const amr::Flag flag) {
+                     return flag == amr::Flag::Join;
+                   })) {
+          // h-coarsening
+          const auto [parent_id, ids_to_join, creator_id] =
+              detail::ids_for_join(element_id, flags);
+          if (element_id != creator_id) {
+            if (element_collection.count(creator_id) == 1) {
+              // The child that creates the parent is on this node and joins
+              // this element
+              continue;
+            }
+            const size_t node_of_creator = element_locations.at(creator_id);
+            if (verbosity >= Verbosity::Debug) {
+              Parallel::printf(
+                  "Sending element %s to node %zu to join into element %s\n",
+                  element_id, node_of_creator, parent_id);
+            }
+            children_to_send.emplace_back(
+                node_of_creator, element_id,
+                detail::remove_element<ParallelComponent>(
+                    make_not_null(&element_collection), cache, element_id,
+                    make_not_null(&removed_ids)));
+            continue;
+          }
+          if (verbosity >= Verbosity::Debug) {
+            Parallel::printf("Joining %zu elements: %s -> %s\n",
+                             ids_to_join.size(), ids_to_join, parent_id);
+          }
+          detail::join_if_all_children_arrived<ParallelComponent>(
+              make_not_null(&element_collection),
+              make_not_null(&joining_children_items), cache, parent_id,
+              ids_to_join, creator_id, make_not_null(&removed_ids),
+              make_not_null(&added_ids));
+        } else {
+          // Neither h-refinement nor h-coarsening. This element will remain.
+          AdjustDomain::adjust_element<Metavariables>(
+              make_not_null(&element_box), element_id);
+        }
+      }
+
+      detail::update_number_of_elements_terminated<element_collection_tag>(
+          make_not_null(&box));
+    }
+
+    auto& collection_proxy =
+        Parallel::get_parallel_component<ParallelComponent>(cache);
+    for (auto& [node_of_creator, child_id, child_items] : children_to_send) {
+      Parallel::threaded_action<CollectJoiningChildOnNode>(
+          collection_proxy[node_of_creator], std::move(child_id),
+          std::move(child_items));
+    }
+    if (not removed_ids.empty() or not added_ids.empty()) {
+      Parallel::threaded_action<Parallel::Actions::UpdateElementLocations>(
+          collection_proxy, std::move(removed_ids), std::move(added_ids),
+          Parallel::my_node<size_t>(cache));
+    }
+  }
+};
+}  // namespace amr::Actions
@@ -4,11 +4,13 @@
 #pragma once
 
 #include "Parallel/Algorithms/AlgorithmSingleton.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "ParallelAlgorithms/Amr/Actions/AdjustDomain.hpp"
+#include "ParallelAlgorithms/Amr/Actions/AdjustDomainOnNode.hpp"
 #include "ParallelAlgorithms/Amr/Actions/EvaluateRefinementCriteria.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Tags/Criteria.hpp"
 #include "ParallelAlgorithms/Amr/Policies/Tags.hpp"
@@ -52,9 +54,14 @@ struct Component {
               typename metavariables::amr::element_array>(local_cache));
     }
     if (Parallel::Phase::AdjustDomain == next_phase) {
-      Parallel::simple_action<::amr::Actions::AdjustDomain>(
-          Parallel::get_parallel_component<
-              typename metavariables::amr::element_array>(local_cache));
+      using element_array = typename metavariables::amr::element_array;
+      if constexpr (Parallel::is_dg_element_collection_v<element_array>) {
+        Parallel::threaded_action<::amr::Actions::AdjustDomainOnNode>(
+            Parallel::get_parallel_component<element_array>(local_cache));
+      } else {
+        Parallel::simple_action<::amr::Actions::AdjustDomain>(
+            Parallel::get_parallel_component<element_array>(local_cache));
+      }
     }
   }
 };
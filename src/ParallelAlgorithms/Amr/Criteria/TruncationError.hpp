@@ -14,9 +14,11 @@
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/ValidateSelection.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/ModalCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Context.hpp"
 #include "Options/ParseError.hpp"
@@ -41,6 +43,9 @@ namespace TruncationError_detail {
  * the "max" of the current and new flags, where the "highest" flag is
  * `Flag::IncreaseResolution`, followed by `Flag::DoNothing`, and then
  * `Flag::DecreaseResolution`.
+ *
+ * The overload taking the `modal_coefficients` of the tensor component avoids
+ * transforming the component to modal space again.
  */
 template <size_t Dim>
 void max_over_components(
@@ -49,6 +54,14 @@ void max_over_components(
     const DataVector& tensor_component, const Mesh<Dim>& mesh,
     std::optional<double> target_abs_truncation_error,
     std::optional<double> target_rel_truncation_error);
+
+template <size_t Dim>
+void max_over_components(
+    gsl::not_null<std::array<Flag, Dim>*> result,
+    const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
+    const DataVector& tensor_component, const ModalVector& modal_coefficients,
+    const Mesh<Dim>& mesh, std::optional<double> target_abs_truncation_error,
+    std::optional<double> target_rel_truncation_error);
 }  // namespace TruncationError_detail
 
 /*!
@@ -174,11 +187,25 @@ std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
           return;
         }
         const auto& tensor = db::get<tag>(box);
-        for (const DataVector& tensor_component : tensor) {
-          TruncationError_detail::max_over_components(
-              make_not_null(&result), make_not_null(&power_monitors_buffer),
-              tensor_component, mesh, target_abs_truncation_error_,
-              target_rel_truncation_error_);
+        // Reuse the modal coefficients if they are already computed for other
+        // purposes
+        if constexpr (db::tag_is_retrievable_v<::Tags::ModalCoefficients<tag>,
+                                               db::DataBox<DbTagsList>>) {
+          const auto& modal_coefficients =
+              db::get<::Tags::ModalCoefficients<tag>>(box);
+          for (size_t i = 0; i < tensor.size(); ++i) {
+            TruncationError_detail::max_over_components(
+                make_not_null(&result), make_not_null(&power_monitors_buffer),
+                tensor[i], modal_coefficients[i], mesh,
+                target_abs_truncation_error_, target_rel_truncation_error_);
+          }
+        } else {
+          for (const DataVector& tensor_component : tensor) {
+            TruncationError_detail::max_over_components(
+                make_not_null(&result), make_not_null(&power_monitors_buffer),
+                tensor_component, mesh, target_abs_truncation_error_,
+                target_rel_truncation_error_);
+          }
         }
       });
   return result;
@@ -0,0 +1,165 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TypeTraits/IsA.hpp"
+
+namespace amr::projectors {
+
+/*!
+ * \brief Project several fields with the same matrices in a single pass
+ *
+ * \details Projecting each field of a projector separately applies the
+ * projection matrices once per field (or even once per tensor component),
+ * which for the small meshes typical of DG elements is dominated by the
+ * per-call overhead rather than by the arithmetic. This class gathers the
+ * components of all fields that were added into one contiguous buffer,
+ * projects the buffer with a single call to `apply_matrices`, and scatters the
+ * result back into the fields.
+ *
+ * Supported fields are `Variables` holding `double`s, `Tensor<DataVector>`,
+ * and `DataVector`. Add all fields with `add` and then call `apply` once. The
+ * sources must stay alive and unchanged until `apply` is called. A field may
+ * be projected in place by passing only the field to `add`.
+ */
+class BatchedProjection {
+ public:
+  /// Project the `source` into the `result`, which is resized to the number of
+  /// points of the projected mesh
+  template <typename FieldType>
+  void add(const gsl::not_null<FieldType*> result, const FieldType& source) {
+    static_assert(
+        std::is_same_v<FieldType, DataVector> or
+            (tt::is_a_v<Tensor, FieldType> and
+             std::is_same_v<typename FieldType::type, DataVector>) or
+            (tt::is_a_v<Variables, FieldType> and
+             std::is_same_v<typename FieldType::value_type, double>),
+        "BatchedProjection supports only real-valued Variables, "
+        "Tensor<DataVector>, and DataVector");
+    const size_t number_of_components = [&source]() -> size_t {
+      if constexpr (std::is_same_v<FieldType, DataVector>) {
+        (void)source;
+        return 1;
+      } else if constexpr (tt::is_a_v<Tensor, FieldType>) {
+        return source.size();
+      } else {
+        return FieldType::number_of_independent_components;
+      }
+    }();
+    fields_.push_back(
+        {number_of_components,
+         [&source](double* const buffer, const size_t number_of_points) {
+           copy_to_buffer(buffer, source, number_of_points);
+         },
+         [result](const double* const buffer, const size_t number_of_points) {
+           copy_from_buffer(result, buffer, number_of_points);
+         }});
+    number_of_components_ += number_of_components;
+  }
+
+  /// Project the `field` in place
+  template <typename FieldType>
+  void add(const gsl::not_null<FieldType*> field) {
+    add(field, *field);
+  }
+
+  /// Project all fields that were added with the `matrices` from a mesh with
+  /// the `source_extents`
+  template <typename MatrixType, size_t Dim>
+  void apply(const std::array<MatrixType, Dim>& matrices,
+             const Index<Dim>& source_extents) {
+    if (fields_.empty()) {
+      return;
+    }
+    const size_t source_number_of_points = source_extents.product();
+    const size_t result_number_of_points =
+        apply_matrices_detail::result_size(matrices, source_extents);
+    DataVector source_buffer(number_of_components_ * source_number_of_points);
+    size_t offset = 0;
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (const auto& field : fields_) {
+      field.gather(source_buffer.data() + offset, source_number_of_points);
+      offset += field.number_of_components * source_number_of_points;
+    }
+    DataVector result_buffer(number_of_components_ * result_number_of_points);
+    apply_matrices(make_not_null(&result_buffer), matrices, source_buffer,
+                   source_extents);
+    // All sources are read before any result is written, so fields can be
+    // projected in place
+    offset = 0;
+    for (const auto& field : fields_) {
+      field.scatter(result_buffer.data() + offset, result_number_of_points);
+      offset += field.number_of_components * result_number_of_points;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    fields_.clear();
+    number_of_components_ = 0;
+  }
+
+ private:
+  struct Field {
+    size_t number_of_components;
+    std::function<void(double*, size_t)> gather;
+    std::function<void(const double*, size_t)> scatter;
+  };
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  template <typename FieldType>
+  static void copy_to_buffer(double* buffer, const FieldType& field,
+                             const size_t number_of_points) {
+    if constexpr (tt::is_a_v<Tensor, FieldType>) {
+      for (const auto& component : field) {
+        ASSERT(component.size() == number_of_points,
+               "Expected " << number_of_points << " points but got "
+                           << component.size());
+        std::copy(component.begin(), component.end(), buffer);
+        buffer += number_of_points;
+      }
+    } else {
+      // Variables are stored contiguously, component by component
+      ASSERT(field.size() % number_of_points == 0,
+             "Expected a multiple of " << number_of_points
+                                       << " points but got " << field.size());
+      std::copy(field.data(), field.data() + field.size(), buffer);
+    }
+  }
+
+  template <typename FieldType>
+  static void copy_from_buffer(const gsl::not_null<FieldType*> field,
+                               const double* buffer,
+                               const size_t number_of_points) {
+    if constexpr (tt::is_a_v<Tensor, FieldType>) {
+      for (auto& component : *field) {
+        component.destructive_resize(number_of_points);
+        std::copy(buffer, buffer + number_of_points, component.data());
+        buffer += number_of_points;
+      }
+    } else if constexpr (std::is_same_v<FieldType, DataVector>) {
+      field->destructive_resize(number_of_points);
+      std::copy(buffer, buffer + number_of_points, field->data());
+    } else {
+      field->initialize(number_of_points);
+      std::copy(buffer, buffer + field->size(), field->data());
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  std::vector<Field> fields_{};
+  size_t number_of_components_ = 0;
+};
+}  // namespace amr::projectors
@@ -7,13 +7,13 @@
 #include <unordered_map>
 #include <utility>
 
-#include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "ParallelAlgorithms/Amr/Projectors/BatchedProjection.hpp"
 #include "ParallelAlgorithms/Amr/Protocols/Projector.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -29,7 +29,9 @@ namespace amr::projectors {
 /// `tmpl::list` is available.
 ///
 /// \details For each item corresponding to each tag in TensorTags, project
-/// the data for each tensor from the old mesh to the new mesh
+/// the data for each tensor from the old mesh to the new mesh. All components
+/// of all tensors are projected together in a single pass, see
+/// BatchedProjection.
 ///
 /// \see ProjectVariables
 template <size_t Dim, typename... TensorTags>
@@ -47,14 +49,9 @@ struct ProjectTensors : tt::ConformsTo<amr::protocols::Projector> {
     }
     const auto projection_matrices =
         Spectral::p_projection_matrices(old_mesh, new_mesh);
-    const auto& old_extents = old_mesh.extents();
-    const auto project_tensor = [&projection_matrices,
-                                 old_extents](auto& tensor) {
-      for (size_t i = 0; i < tensor.size(); ++i) {
-        tensor[i] = apply_matrices(projection_matrices, tensor[i], old_extents);
-      }
-    };
-    EXPAND_PACK_LEFT_TO_RIGHT(project_tensor(*tensors));
+    BatchedProjection projection{};
+    EXPAND_PACK_LEFT_TO_RIGHT(projection.add(tensors));
+    projection.apply(projection_matrices, old_mesh.extents());
   }
 
   template <typename... Tags>
@@ -14,6 +14,7 @@
 #include "Domain/Tags.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "ParallelAlgorithms/Amr/Projectors/BatchedProjection.hpp"
 #include "ParallelAlgorithms/Amr/Protocols/Projector.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -29,7 +30,9 @@ namespace amr::projectors {
 /// `tmpl::list` is available.
 ///
 /// \details For each item corresponding to each tag in VariablesTags, project
-/// the data for each variable from the old mesh to the new mesh
+/// the data for each variable from the old mesh to the new mesh. A single
+/// item is projected directly. Several items are projected together in a
+/// single pass, see BatchedProjection.
 ///
 /// \see ProjectTensors
 template <size_t Dim, typename... VariablesTags>
@@ -50,8 +53,16 @@ struct ProjectVariables : tt::ConformsTo<amr::protocols::Projector> {
     const auto projection_matrices =
         Spectral::p_projection_matrices(old_mesh, new_mesh);
     const auto& old_extents = old_mesh.extents();
-    expand_pack(
-        (*vars = apply_matrices(projection_matrices, *vars, old_extents))...);
+    if constexpr (sizeof...(VariablesTags) == 1) {
+      // A single Variables is already contiguous, so batching would only add
+      // copies
+      expand_pack(
+          (*vars = apply_matrices(projection_matrices, *vars, old_extents))...);
+    } else {
+      BatchedProjection projection{};
+      EXPAND_PACK_LEFT_TO_RIGHT(projection.add(vars));
+      projection.apply(projection_matrices, old_extents);
+    }
   }
 
   // h-refinement
@@ -80,9 +91,16 @@ struct ProjectVariables : tt::ConformsTo<amr::protocols::Projector> {
     const auto prolongation_matrices =
         Spectral::projection_matrix_parent_to_child(parent_mesh, child_mesh,
                                                     child_sizes);
-    expand_pack((*vars = apply_matrices(prolongation_matrices,
-                                        get<VariablesTags>(parent_items),
-                                        parent_mesh.extents()))...);
+    if constexpr (sizeof...(VariablesTags) == 1) {
+      expand_pack((*vars = apply_matrices(prolongation_matrices,
+                                          get<VariablesTags>(parent_items),
+                                          parent_mesh.extents()))...);
+    } else {
+      BatchedProjection projection{};
+      EXPAND_PACK_LEFT_TO_RIGHT(
+          projection.add(vars, get<VariablesTags>(parent_items)));
+      projection.apply(prolongation_matrices, parent_mesh.extents());
+    }
   }
 
   // h-coarsening
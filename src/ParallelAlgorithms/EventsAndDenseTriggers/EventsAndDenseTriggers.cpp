@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <pup.h>
 #include <utility>
+#include <vector>
 
 #include "Utilities/ErrorHandling/FloatingPointExceptions.hpp"
 
@@ -38,6 +39,25 @@ void EventsAndDenseTriggers::add_trigger_and_events(
       std::move(trigger), std::move(events)});
 }
 
+std::vector<double>
+EventsAndDenseTriggers::scheduled_checks_needing_evolved_variables() const {
+  std::vector<double> result{};
+  if (not initialized()) {
+    return result;
+  }
+  for (const auto& trigger_entry : events_and_triggers_) {
+    if (std::any_of(trigger_entry.events.begin(), trigger_entry.events.end(),
+                    [](const auto& event) {
+                      return event->needs_evolved_variables();
+                    })) {
+      result.push_back(trigger_entry.next_check);
+    }
+  }
+  std::sort(result.begin(), result.end(), before_);
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
 void EventsAndDenseTriggers::pup(PUP::er& p) {
   p | events_and_triggers_;
   p | next_check_;
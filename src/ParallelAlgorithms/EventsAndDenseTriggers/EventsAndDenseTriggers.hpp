@@ -139,6 +139,13 @@ class EventsAndDenseTriggers {
                   const ArrayIndex& array_index,
                   const ComponentPointer component);
 
+  /// The times of the scheduled checks of all triggers with events
+  /// that need the evolved variables, in evolution order and without
+  /// duplicates.  The triggers need not fire at these times, and
+  /// rescheduling can add earlier checks, so this is only useful for
+  /// precomputing dense output.
+  std::vector<double> scheduled_checks_needing_evolved_variables() const;
+
   /// Add a new trigger and set of events.  This can only be called
   /// during initialization.
   void add_trigger_and_events(std::unique_ptr<DenseTrigger> trigger,
@@ -59,6 +59,7 @@
 #include "Utilities/Gsl.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -178,6 +179,18 @@ struct SubdomainDataBufferTag : db::SimpleTag {
   using type = SubdomainDataType;
 };
 
+// The solution of the subdomain problem with only the data on the element,
+// which is computed while the overlap data is still in flight if
+// `Tags::EagerSubdomainSolves` is enabled, together with the number of
+// subdomain solver iterations it took
+template <typename SubdomainDataType, typename OptionsGroup>
+struct EagerSubdomainSolutionTag : db::SimpleTag {
+  static std::string name() {
+    return "EagerSubdomainSolution(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+  using type = std::optional<std::pair<SubdomainDataType, size_t>>;
+};
+
 // Allow factory-creating any of these serial linear solvers for use as
 // subdomain solver
 template <typename FieldsTag, typename SubdomainOperator,
@@ -215,7 +228,8 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
       tmpl::list<Tags::IntrudingExtents<Dim, OptionsGroup>,
                  Tags::Weight<OptionsGroup>,
                  domain::Tags::Faces<Dim, Tags::Weight<OptionsGroup>>,
-                 SubdomainDataBufferTag<SubdomainData, OptionsGroup>>;
+                 SubdomainDataBufferTag<SubdomainData, OptionsGroup>,
+                 EagerSubdomainSolutionTag<SubdomainData, OptionsGroup>>;
   using compute_tags = tmpl::list<>;
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
             typename ActionList, typename ParallelComponent>
@@ -243,6 +257,8 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
       const gsl::not_null<DirectionMap<Dim, Scalar<DataVector>>*>
           intruding_overlap_weights,
       const gsl::not_null<SubdomainData*> subdomain_data,
+      const gsl::not_null<std::optional<std::pair<SubdomainData, size_t>>*>
+          eager_subdomain_solution,
       [[maybe_unused]] const gsl::not_null<std::unique_ptr<SubdomainSolver>*>
           subdomain_solver,
       const Element<Dim>& element, const Mesh<Dim>& mesh,
@@ -294,6 +310,7 @@ struct InitializeElement : tt::ConformsTo<amr::protocols::Projector> {
 
     // Subdomain data buffer
     *subdomain_data = SubdomainData{num_points};
+    *eager_subdomain_solution = std::nullopt;
 
     // Subdomain solver
     // The subdomain solver initially gets created from options on each element.
@@ -353,6 +370,7 @@ struct SolveSubdomain {
   using const_global_cache_tags =
       tmpl::list<Tags::MaxOverlap<OptionsGroup>,
                  logging::Tags::Verbosity<OptionsGroup>,
+                 Tags::EagerSubdomainSolves<OptionsGroup>,
                  Tags::ObservePerCoreReductions<OptionsGroup>>;
   using inbox_tags = tmpl::list<overlap_residuals_inbox_tag>;
 
@@ -368,29 +386,131 @@ struct SolveSubdomain {
     const auto& element = db::get<domain::Tags::Element<Dim>>(box);
     const size_t max_overlap = db::get<Tags::MaxOverlap<OptionsGroup>>(box);
 
+    const auto& subdomain_solver =
+        get<Tags::SubdomainSolverBase<OptionsGroup>>(box);
+    const SubdomainOperator subdomain_operator{};
+    // Solve the subdomain problem with the data in the buffer
+    const auto solve_subdomain = [&box, &subdomain_solver, &subdomain_operator,
+                                  &element_id, &iteration_id]() {
+      const auto& subdomain_residual =
+          db::get<SubdomainDataBufferTag<SubdomainData, OptionsGroup>>(box);
+      auto subdomain_solve_initial_guess_in_solution_out =
+          make_with_value<SubdomainData>(subdomain_residual, 0.);
+      const auto subdomain_solve_has_converged = subdomain_solver.solve(
+          make_not_null(&subdomain_solve_initial_guess_in_solution_out),
+          subdomain_operator, subdomain_residual, std::forward_as_tuple(box));
+      // Do some logging
+      if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                   ::Verbosity::Quiet)) {
+        if (not subdomain_solve_has_converged or
+            subdomain_solve_has_converged.reason() ==
+                Convergence::Reason::MaxIterations) {
+          Parallel::printf(
+              "%s %s(%zu): WARNING: Subdomain solver did not converge in %zu "
+              "iterations: %e -> %e\n",
+              element_id, pretty_type::name<OptionsGroup>(), iteration_id,
+              subdomain_solve_has_converged.num_iterations(),
+              subdomain_solve_has_converged.initial_residual_magnitude(),
+              subdomain_solve_has_converged.residual_magnitude());
+        } else if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                            ::Verbosity::Debug)) {
+          Parallel::printf(
+              "%s %s(%zu): Subdomain solver converged in %zu iterations (%s): "
+              "%e -> %e\n",
+              element_id, pretty_type::name<OptionsGroup>(), iteration_id,
+              subdomain_solve_has_converged.num_iterations(),
+              subdomain_solve_has_converged.reason(),
+              subdomain_solve_has_converged.initial_residual_magnitude(),
+              subdomain_solve_has_converged.residual_magnitude());
+        }
+      }
+      return std::make_pair(
+          std::move(subdomain_solve_initial_guess_in_solution_out),
+          subdomain_solve_has_converged.num_iterations());
+    };
+
     // Wait for communicated overlap data
     const bool has_overlap_data =
         max_overlap > 0 and element.number_of_neighbors() > 0;
-    if (LIKELY(has_overlap_data) and
-        not dg::has_received_from_all_mortars<overlap_residuals_inbox_tag>(
-            iteration_id, element, inboxes)) {
-      return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+    const auto has_received_overlap_data = [&iteration_id, &element,
+                                            &inboxes]() {
+      return dg::has_received_from_all_mortars<overlap_residuals_inbox_tag>(
+          iteration_id, element, inboxes);
+    };
+    if (LIKELY(has_overlap_data) and not has_received_overlap_data()) {
+      // Solve the subdomain problem with only the data on the element while
+      // the overlap data is in flight. This needs the structure of the overlap
+      // data, which we take from the previous iteration. Before the first
+      // iteration (and after AMR) we don't know it yet, so we just wait.
+      if (db::get<Tags::EagerSubdomainSolves<OptionsGroup>>(box) and
+          not db::get<EagerSubdomainSolutionTag<SubdomainData, OptionsGroup>>(
+                  box)
+                  .has_value() and
+          not db::get<SubdomainDataBufferTag<SubdomainData, OptionsGroup>>(box)
+                  .overlap_data.empty()) {
+        if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
+                     ::Verbosity::Debug)) {
+          Parallel::printf("%s %s(%zu): Solve subdomain on element\n",
+                           element_id, pretty_type::name<OptionsGroup>(),
+                           iteration_id);
+        }
+        db::mutate<SubdomainDataBufferTag<SubdomainData, OptionsGroup>>(
+            [](const gsl::not_null<SubdomainData*> subdomain_data,
+               const auto& residual) {
+              subdomain_data->element_data = residual;
+              for (auto& [overlap_id, overlap_data] :
+                   subdomain_data->overlap_data) {
+                (void)overlap_id;
+                overlap_data.initialize(overlap_data.number_of_grid_points(),
+                                        0.);
+              }
+            },
+            make_not_null(&box), db::get<residual_tag>(box));
+        auto eager_subdomain_solution = solve_subdomain();
+        db::mutate<EagerSubdomainSolutionTag<SubdomainData, OptionsGroup>>(
+            [&eager_subdomain_solution](const auto eager_solution) {
+              *eager_solution = std::move(eager_subdomain_solution);
+            },
+            make_not_null(&box));
+      }
+      // The overlap data may have arrived during the solve
+      if (not has_received_overlap_data()) {
+        return {Parallel::AlgorithmExecution::Retry, std::nullopt};
+      }
     }
 
+    // If we have solved the subdomain problem with the element data already,
+    // we only need to solve for the overlap contribution now
+    std::optional<std::pair<SubdomainData, size_t>> eager_subdomain_solution{};
+    db::mutate<EagerSubdomainSolutionTag<SubdomainData, OptionsGroup>>(
+        [&eager_subdomain_solution](const auto eager_solution) {
+          eager_subdomain_solution = std::move(*eager_solution);
+          *eager_solution = std::nullopt;
+        },
+        make_not_null(&box));
+
     // Do some logging
     if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
                  ::Verbosity::Debug)) {
-      Parallel::printf("%s %s(%zu): Solve subdomain\n", element_id,
-                       pretty_type::name<OptionsGroup>(), iteration_id);
+      Parallel::printf("%s %s(%zu): Solve subdomain%s\n", element_id,
+                       pretty_type::name<OptionsGroup>(), iteration_id,
+                       eager_subdomain_solution.has_value() ? " on overlaps"
+                                                            : "");
     }
 
     // Assemble the subdomain data from the data on the element and the
     // communicated overlap data
     db::mutate<SubdomainDataBufferTag<SubdomainData, OptionsGroup>>(
-        [&inboxes, &iteration_id, &has_overlap_data](
+        [&inboxes, &iteration_id, &has_overlap_data,
+         &eager_subdomain_solution](
             const gsl::not_null<SubdomainData*> subdomain_data,
             const auto& residual) {
-          subdomain_data->element_data = residual;
+          if (eager_subdomain_solution.has_value()) {
+            subdomain_data->element_data.initialize(
+                residual.number_of_grid_points(), 0.);
+          } else {
+            subdomain_data->element_data = residual;
+          }
           // Nothing was communicated if the overlaps are empty
           if (LIKELY(has_overlap_data)) {
             subdomain_data->overlap_data =
@@ -400,55 +520,26 @@ struct SolveSubdomain {
           }
         },
         make_not_null(&box), db::get<residual_tag>(box));
-    const auto& subdomain_residual =
-        db::get<SubdomainDataBufferTag<SubdomainData, OptionsGroup>>(box);
-
-    // Allocate workspace memory for repeatedly applying the subdomain operator
-    const SubdomainOperator subdomain_operator{};
 
     // Solve the subdomain problem
-    const auto& subdomain_solver =
-        get<Tags::SubdomainSolverBase<OptionsGroup>>(box);
-    auto subdomain_solve_initial_guess_in_solution_out =
-        make_with_value<SubdomainData>(subdomain_residual, 0.);
-    const auto subdomain_solve_has_converged = subdomain_solver.solve(
-        make_not_null(&subdomain_solve_initial_guess_in_solution_out),
-        subdomain_operator, subdomain_residual, std::forward_as_tuple(box));
-    // Re-naming the solution buffer for the code below
-    auto& subdomain_solution = subdomain_solve_initial_guess_in_solution_out;
-
-    // Do some logging and observing
-    if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
-                 ::Verbosity::Quiet)) {
-      if (not subdomain_solve_has_converged or
-          subdomain_solve_has_converged.reason() ==
-              Convergence::Reason::MaxIterations) {
-        Parallel::printf(
-            "%s %s(%zu): WARNING: Subdomain solver did not converge in %zu "
-            "iterations: %e -> %e\n",
-            element_id, pretty_type::name<OptionsGroup>(), iteration_id,
-            subdomain_solve_has_converged.num_iterations(),
-            subdomain_solve_has_converged.initial_residual_magnitude(),
-            subdomain_solve_has_converged.residual_magnitude());
-      } else if (UNLIKELY(get<logging::Tags::Verbosity<OptionsGroup>>(box) >=
-                          ::Verbosity::Debug)) {
-        Parallel::printf(
-            "%s %s(%zu): Subdomain solver converged in %zu iterations (%s): %e "
-            "-> %e\n",
-            element_id, pretty_type::name<OptionsGroup>(), iteration_id,
-            subdomain_solve_has_converged.num_iterations(),
-            subdomain_solve_has_converged.reason(),
-            subdomain_solve_has_converged.initial_residual_magnitude(),
-            subdomain_solve_has_converged.residual_magnitude());
-      }
+    auto subdomain_solve_result = solve_subdomain();
+    auto& subdomain_solution = subdomain_solve_result.first;
+    size_t& subdomain_solve_num_iterations = subdomain_solve_result.second;
+    // The subdomain problem is linear, so the solutions add up (exactly for
+    // direct subdomain solvers, within the tolerance for iterative ones)
+    if (eager_subdomain_solution.has_value()) {
+      subdomain_solution += eager_subdomain_solution->first;
+      subdomain_solve_num_iterations += eager_subdomain_solution->second;
     }
+
+    // Do some observing
     const std::optional<std::string> section_observation_key =
         observers::get_section_observation_key<ArraySectionIdTag>(box);
     if (section_observation_key.has_value()) {
       contribute_to_subdomain_stats_observation<OptionsGroup,
                                                 ParallelComponent>(
-          iteration_id + 1, subdomain_solve_has_converged.num_iterations(),
-          cache, element_id, *section_observation_key,
+          iteration_id + 1, subdomain_solve_num_iterations, cache, element_id,
+          *section_observation_key,
           db::get<Tags::ObservePerCoreReductions<OptionsGroup>>(box));
     }
 
@@ -125,6 +125,21 @@ namespace LinearSolver::Schwarz {
  * convergence or parallelization properties (assuming the subdomain solutions
  * it produces are sufficiently precise).
  *
+ * \par Eager subdomain solves:
+ * Waiting for the overlap data from neighbors before solving the subdomain
+ * problem exposes the communication latency. With the
+ * `LinearSolver::Schwarz::Tags::EagerSubdomainSolves` option enabled, an
+ * element instead starts solving the subdomain problem with only its own data
+ * while the overlap data is in flight. Once the overlap data arrives it solves
+ * the subdomain problem with only the overlap data and adds the two solutions.
+ * Since the subdomain problem is linear this reproduces the unsplit solution
+ * exactly only if the subdomain solver is a direct solver. An iterative
+ * subdomain solver with a relative tolerance applies the tolerance to each of
+ * the two right-hand sides separately, not to their sum, so the combined
+ * subdomain solution differs from the unsplit one within the subdomain solver
+ * tolerance. This doubles the number of subdomain solves, so it helps only when
+ * they are cheap compared to the communication.
+ *
  * \par Weighting:
  * Once the subdomain solutions \f$\delta x_s\f$ have been found they must be
  * combined where they have multiple values, i.e. on overlap regions of the
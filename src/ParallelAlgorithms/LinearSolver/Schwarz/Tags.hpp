@@ -54,6 +54,22 @@ struct SkipSubdomainSolverResets {
       "overall is highly problem-dependent.";
 };
 
+template <typename OptionsGroup>
+struct EagerSubdomainSolves {
+  using type = bool;
+  using group = OptionsGroup;
+  static constexpr Options::String help =
+      "Start the subdomain solve with the data on the element before the data "
+      "on overlaps has arrived from neighbors, and solve for the overlap "
+      "contribution once it arrives. This hides the communication latency "
+      "behind the first solve at the cost of a second subdomain solve per "
+      "iteration, so it helps mostly when subdomain solves are cheap compared "
+      "to inter-node communication. The split solve reproduces the unsplit "
+      "subdomain solution exactly only with a direct subdomain solver. An "
+      "iterative subdomain solver applies its relative tolerance to each part "
+      "separately, so the result differs within that tolerance.";
+};
+
 template <typename OptionsGroup>
 struct ObservePerCoreReductions {
   using type = bool;
@@ -113,6 +129,24 @@ struct SkipSubdomainSolverResets : db::SimpleTag {
   static bool create_from_options(const bool value) { return value; }
 };
 
+/// Start subdomain solves before the overlap data has arrived and add the
+/// overlap contribution as a correction.
+///
+/// Subdomain solves are linear, so the solution with the full subdomain data
+/// is the sum of the solution with only the element data and the solution
+/// with only the overlap data.
+template <typename OptionsGroup>
+struct EagerSubdomainSolves : db::SimpleTag {
+  static std::string name() {
+    return "EagerSubdomainSolves(" + pretty_type::name<OptionsGroup>() + ")";
+  }
+  using type = bool;
+  static constexpr bool pass_metavariables = false;
+  using option_tags =
+      tmpl::list<OptionTags::EagerSubdomainSolves<OptionsGroup>>;
+  static bool create_from_options(const bool value) { return value; }
+};
+
 /// Enable per-core reduction observations
 template <typename OptionsGroup>
 struct ObservePerCoreReductions : db::SimpleTag {
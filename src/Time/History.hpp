@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/container/static_vector.hpp>
 #include <cstddef>
 #include <optional>
@@ -145,9 +146,9 @@ class ConstUntypedHistory
 /// Mutable access to the history data used by a TimeStepper in
 /// type-erased form.  Obtain an instance with `History::untyped()`.
 ///
-/// Data cannot be inserted or modified through the type-erased
-/// interface.  The only mutability exposed is the ability to delete
-/// data.
+/// Data cannot be inserted through the type-erased interface.  The
+/// only mutability exposed is the ability to delete data and to
+/// accumulate one derivative into another.
 ///
 /// The methods mirror similar ones in `History`.  See that class for
 /// details.
@@ -168,6 +169,12 @@ class MutableUntypedHistory : public ConstUntypedHistory<T> {
  public:
   virtual void discard_value(const TimeStepId& id_to_discard) const = 0;
 
+  virtual void discard_derivative(const TimeStepId& id_to_discard) const = 0;
+
+  virtual void add_to_derivative(const TimeStepId& id_to_update,
+                                 double coefficient,
+                                 const TimeStepId& id_to_add) const = 0;
+
   virtual void pop_front() const = 0;
 
   virtual void clear_substeps() const = 0;
@@ -410,6 +417,18 @@ class History
       this->reinitialize(*history_);
     }
 
+    void discard_derivative(const TimeStepId& id_to_discard) const override {
+      history_->discard_derivative(id_to_discard);
+      this->reinitialize(*history_);
+    }
+
+    void add_to_derivative(const TimeStepId& id_to_update,
+                           const double coefficient,
+                           const TimeStepId& id_to_add) const override {
+      history_->add_to_derivative(id_to_update, coefficient, id_to_add);
+      this->reinitialize(*history_);
+    }
+
     void pop_front() const override {
       history_->pop_front();
       this->reinitialize(*history_);
@@ -648,6 +667,28 @@ class History
   /// allocations will be cached for future reuse.
   void discard_value(const TimeStepId& id_to_discard);
 
+  /// Clear the `derivative` in the indicated substep record.  It is
+  /// an error if there is no substep with the passed TimeStepId.  Any
+  /// memory allocations will be cached for future reuse.  This allows
+  /// time steppers that only need a few of the substep derivatives,
+  /// such as low-storage Runge-Kutta methods, to avoid holding
+  /// storage for every stage.  A discarded derivative must not be
+  /// read, and is skipped by `map_entries`.
+  void discard_derivative(const TimeStepId& id_to_discard);
+
+  /// Check whether the `derivative` in the indicated record has been
+  /// cleared by `discard_derivative`.
+  bool derivative_is_discarded(const TimeStepId& id) const;
+
+  /// Add \p coefficient times the `derivative` in the record \p
+  /// id_to_add to the `derivative` in the record \p id_to_update.
+  /// This allows time steppers to accumulate a register, such as the
+  /// increment of a low-storage Runge-Kutta method, in the storage
+  /// of a derivative that has already been consumed.  Neither
+  /// derivative may have been discarded.
+  void add_to_derivative(const TimeStepId& id_to_update, double coefficient,
+                         const TimeStepId& id_to_add);
+
   /// Drop the oldest step (not substep) entry in the history.  Any
   /// memory allocations will be cached for future reuse.
   void pop_front();
@@ -667,8 +708,9 @@ class History
   /// Release any cached memory allocations.
   void shrink_to_fit();
 
-  /// Apply \p func to `make_not_null(&e)` for `e` every `derivative`
-  /// and valid `*value` in records held by the history.
+  /// Apply \p func to `make_not_null(&e)` for `e` every
+  /// non-discarded `derivative` and valid `*value` in records held by
+  /// the history.
   template <typename F>
   void map_entries(F&& func);
 
@@ -701,6 +743,10 @@ class History
   // onto the last value if it gets discarded.
   std::optional<Vars> latest_value_if_discarded_{};
 
+  // Which entries of substep_values_ have had their derivatives
+  // discarded.
+  std::array<bool, history_max_substeps> substep_derivatives_discarded_{};
+
   // Memory allocations available for reuse.
   boost::container::static_vector<Vars, max_size() + history_max_substeps>
       vars_allocation_cache_{};
@@ -714,7 +760,8 @@ History<Vars>::History(const History& other)
     : integration_order_(other.integration_order_),
       step_values_(other.step_values_),
       substep_values_(other.substep_values_),
-      latest_value_if_discarded_(other.latest_value_if_discarded_) {}
+      latest_value_if_discarded_(other.latest_value_if_discarded_),
+      substep_derivatives_discarded_(other.substep_derivatives_discarded_) {}
 
 // Don't copy the allocation caches.
 template <typename Vars>
@@ -723,6 +770,7 @@ History<Vars>& History<Vars>::operator=(const History& other) {
   step_values_ = other.step_values_;
   substep_values_ = other.substep_values_;
   latest_value_if_discarded_ = other.latest_value_if_discarded_;
+  substep_derivatives_discarded_ = other.substep_derivatives_discarded_;
   return *this;
 }
 
@@ -823,6 +871,48 @@ void History<Vars>::discard_value(const TimeStepId& id_to_discard) {
   }
 }
 
+template <typename Vars>
+void History<Vars>::discard_derivative(const TimeStepId& id_to_discard) {
+  const size_t substep = id_to_discard.substep();
+  ASSERT(substep > 0 and substep <= substeps().size() and
+             substeps()[substep - 1].time_step_id == id_to_discard,
+         "Derivatives can only be discarded from substeps, and "
+             << id_to_discard << " is not a substep in the history.");
+  if (substep_derivatives_discarded_[substep - 1]) {
+    return;
+  }
+  auto& derivative = substep_values_[substep - 1].derivative;
+  // If caching doesn't save anything, don't allocate memory for the cache.
+  if (contains_allocations(derivative)) {
+    deriv_vars_allocation_cache_.emplace_back(std::move(derivative));
+    derivative = DerivVars{};
+  }
+  substep_derivatives_discarded_[substep - 1] = true;
+}
+
+template <typename Vars>
+bool History<Vars>::derivative_is_discarded(const TimeStepId& id) const {
+  const size_t substep = id.substep();
+  return substep > 0 and substep <= substeps().size() and
+         substeps()[substep - 1].time_step_id == id and
+         substep_derivatives_discarded_[substep - 1];
+}
+
+template <typename Vars>
+void History<Vars>::add_to_derivative(const TimeStepId& id_to_update,
+                                      const double coefficient,
+                                      const TimeStepId& id_to_add) {
+  ASSERT(not derivative_is_discarded(id_to_update) and
+             not derivative_is_discarded(id_to_add),
+         "Cannot combine discarded derivatives: " << id_to_update << " and "
+                                                  << id_to_add);
+  auto& derivative =
+      History_detail::find_record(*this, id_to_update).derivative;
+  const auto& addend = History_detail::find_record(*this, id_to_add).derivative;
+  *make_math_wrapper(make_not_null(&derivative)) +=
+      coefficient * *make_math_wrapper(addend);
+}
+
 template <typename Vars>
 void History<Vars>::pop_front() {
   ASSERT(not this->empty(), "History is empty");
@@ -840,6 +930,7 @@ void History<Vars>::undo_latest() {
     step_values_.pop_back();
   } else {
     cache_allocations(&substep_values_.back());
+    substep_derivatives_discarded_[substep_values_.size() - 1] = false;
     substep_values_.pop_back();
   }
   discard_value(&latest_value_if_discarded_);
@@ -851,6 +942,7 @@ void History<Vars>::clear_substeps() {
     cache_allocations(&record);
   }
   substep_values_.clear();
+  substep_derivatives_discarded_.fill(false);
 }
 
 template <typename Vars>
@@ -879,8 +971,11 @@ void History<Vars>::map_entries(F&& func) {
       func(make_not_null(&*record.value));
     }
   }
-  for (auto& record : this->substeps()) {
-    func(make_not_null(&record.derivative));
+  for (size_t i = 0; i < substep_values_.size(); ++i) {
+    auto& record = substep_values_[i];
+    if (not substep_derivatives_discarded_[i]) {
+      func(make_not_null(&record.derivative));
+    }
     if (record.value.has_value()) {
       func(make_not_null(&*record.value));
     }
@@ -893,6 +988,7 @@ void History<Vars>::pup(PUP::er& p) {
   p | step_values_;
   p | substep_values_;
   p | latest_value_if_discarded_;
+  p | substep_derivatives_discarded_;
 
   // Don't serialize the allocation cache.
 }
@@ -980,6 +1076,7 @@ void History<Vars>::insert_impl(const TimeStepId& time_step_id,
            << substeps().size());
     ASSERT(substep_values_.size() < substep_values_.max_size(),
            "Cannot insert new substep because the History is full.");
+    substep_derivatives_discarded_[substep_values_.size()] = false;
     substep_values_.push_back(std::move(record));
   }
 }
@@ -1060,40 +1157,55 @@ void transform(const gsl::not_null<History<DestVars>*> dest,
   }
 
   const auto transform_record =
-      [&derivative_transformer, &dest, &value_transformer](
+      [&derivative_transformer, &dest, &source, &value_transformer](
           const typename History<SourceVars>::value_type& record) {
+        // Discarded derivatives hold no data, so they are discarded
+        // in the destination instead of being transformed.
+        const bool derivative_discarded =
+            source.derivative_is_discarded(record.time_step_id);
         if constexpr (std::is_invocable_v<ValueTransformer,
                                           gsl::not_null<DestVars*>,
                                           const SourceVars&>) {
+          const auto transform_derivative = [&](const auto result) {
+            if (not derivative_discarded) {
+              derivative_transformer(result, record.derivative);
+            }
+          };
           if (record.value.has_value()) {
             dest->insert_in_place(
                 record.time_step_id,
                 [&](const auto result) {
                   value_transformer(result, *record.value);
                 },
-                [&](const auto result) {
-                  derivative_transformer(result, record.derivative);
-                });
+                transform_derivative);
           } else {
-            dest->insert_in_place(
-                record.time_step_id, History<DestVars>::no_value,
-                [&](const auto result) {
-                  derivative_transformer(result, record.derivative);
-                });
+            dest->insert_in_place(record.time_step_id,
+                                  History<DestVars>::no_value,
+                                  transform_derivative);
           }
         } else {
           static_assert(
               std::is_invocable_v<ValueTransformer, const SourceVars&>,
               "Transform function must either be callable to mutate entries "
               "or return the transformed state by value.");
+          using DestDerivVars = typename History<DestVars>::DerivVars;
+          const auto transform_derivative = [&]() -> DestDerivVars {
+            if (derivative_discarded) {
+              return DestDerivVars{};
+            }
+            return derivative_transformer(record.derivative);
+          };
           if (record.value.has_value()) {
             dest->insert(record.time_step_id, value_transformer(*record.value),
-                         derivative_transformer(record.derivative));
+                         transform_derivative());
           } else {
             dest->insert(record.time_step_id, History<DestVars>::no_value,
-                         derivative_transformer(record.derivative));
+                         transform_derivative());
           }
         }
+        if (derivative_discarded) {
+          dest->discard_derivative(record.time_step_id);
+        }
       };
 
   auto copying_step = source.begin();
@@ -6,9 +6,11 @@
 #include <cstddef>
 #include <limits>
 #include <pup.h>
+#include <type_traits>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/Tensor/IndexType.hpp"
 #include "Domain/MinimumGridSpacing.hpp"
 #include "Options/String.hpp"
 #include "Time/StepChoosers/StepChooser.hpp"  // IWYU pragma: keep
@@ -59,9 +61,15 @@ class Cfl : public StepChooser<StepChooserUse> {
                  ::Tags::TimeStepper<TimeStepper>,
                  typename System::compute_largest_characteristic_speed>;
 
-  using compute_tags = tmpl::list<
-      domain::Tags::MinimumGridSpacingCompute<System::volume_dim, Frame>,
-      typename System::compute_largest_characteristic_speed>;
+  // The inertial-frame spacing is added to the DataBox by
+  // evolution::dg::Initialization::Domain, which rescales the grid-frame
+  // spacing where possible
+  using compute_tags = tmpl::conditional_t<
+      std::is_same_v<Frame, ::Frame::Inertial>,
+      tmpl::list<typename System::compute_largest_characteristic_speed>,
+      tmpl::list<
+          domain::Tags::MinimumGridSpacingCompute<System::volume_dim, Frame>,
+          typename System::compute_largest_characteristic_speed>>;
 
   std::pair<double, bool> operator()(
       const double minimum_grid_spacing,
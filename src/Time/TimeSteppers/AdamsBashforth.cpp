@@ -19,6 +19,7 @@
 #include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/AdamsCoefficients.hpp"
 #include "Time/TimeSteppers/AdamsLts.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -123,8 +124,8 @@ void AdamsBashforth::update_u_impl(const gsl::not_null<T*> u,
          "Incorrect data to take an order-" << history.integration_order()
          << " step.  Have " << history.size() << " times, need "
          << history.integration_order());
-  *u = *history.back().value;
-  update_u_common(u, history, time_step, history.integration_order());
+  update_u_common(u, *history.back().value, history, time_step,
+                  history.integration_order());
 }
 
 template <typename T>
@@ -136,12 +137,12 @@ bool AdamsBashforth::update_u_impl(const gsl::not_null<T*> u,
          "Incorrect data to take an order-" << history.integration_order()
          << " step.  Have " << history.size() << " times, need "
          << history.integration_order());
-  *u = *history.back().value;
-  update_u_common(u, history, time_step, history.integration_order());
+  update_u_common(u, *history.back().value, history, time_step,
+                  history.integration_order());
   // the error estimate is only useful once the history has enough elements to
   // do more than one order of step
-  *u_error = *history.back().value;
-  update_u_common(u_error, history, time_step, history.integration_order() - 1);
+  update_u_common(u_error, *history.back().value, history, time_step,
+                  history.integration_order() - 1);
   *u_error = *u - *u_error;
   return true;
 }
@@ -158,20 +159,31 @@ void AdamsBashforth::clean_history_impl(
 }
 
 template <typename T>
-bool AdamsBashforth::dense_update_u_impl(const gsl::not_null<T*> u,
-                                         const ConstUntypedHistory<T>& history,
-                                         const double time) const {
+bool AdamsBashforth::dense_output_terms_impl(
+    const gsl::not_null<FusedUpdateTerms<T>*> terms,
+    const ConstUntypedHistory<T>& history, const double time) const {
   const ApproximateTimeDelta time_step{
       time - history.back().time_step_id.step_time().value()};
-  update_u_common(u, history, time_step, history.integration_order());
+  update_terms_common(terms, history, time_step, history.integration_order());
   return true;
 }
 
 template <typename T, typename Delta>
 void AdamsBashforth::update_u_common(const gsl::not_null<T*> u,
+                                     const T& initial,
                                      const ConstUntypedHistory<T>& history,
                                      const Delta& time_step,
                                      const size_t order) const {
+  FusedUpdateTerms<T> terms{};
+  update_terms_common(make_not_null(&terms), history, time_step, order);
+  fused_update(u, initial, terms);
+}
+
+template <typename T, typename Delta>
+void AdamsBashforth::update_terms_common(
+    const gsl::not_null<FusedUpdateTerms<T>*> terms,
+    const ConstUntypedHistory<T>& history, const Delta& time_step,
+    const size_t order) const {
   ASSERT(
       history.size() > 0,
       "Cannot meaningfully update the evolved variables with an empty history");
@@ -191,7 +203,7 @@ void AdamsBashforth::update_u_common(const gsl::not_null<T*> u,
   for (auto history_entry = history_start;
        history_entry != history.end();
        ++history_entry, ++coefficient) {
-    *u += *coefficient * history_entry->derivative;
+    terms->emplace_back(*coefficient, &history_entry->derivative);
   }
 }
 
@@ -8,6 +8,7 @@
 
 #include "Options/String.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
 #include "Time/TimeSteppers/LtsTimeStepper.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
@@ -270,15 +271,20 @@ class AdamsBashforth : public LtsTimeStepper {
   void clean_history_impl(const MutableUntypedHistory<T>& history) const;
 
   template <typename T>
-  bool dense_update_u_impl(gsl::not_null<T*> u,
-                           const ConstUntypedHistory<T>& history,
-                           double time) const;
+  bool dense_output_terms_impl(gsl::not_null<FusedUpdateTerms<T>*> terms,
+                               const ConstUntypedHistory<T>& history,
+                               double time) const;
 
   template <typename T, typename Delta>
-  void update_u_common(gsl::not_null<T*> u,
+  void update_u_common(gsl::not_null<T*> u, const T& initial,
                        const ConstUntypedHistory<T>& history,
                        const Delta& time_step, size_t order) const;
 
+  template <typename T, typename Delta>
+  void update_terms_common(gsl::not_null<FusedUpdateTerms<T>*> terms,
+                           const ConstUntypedHistory<T>& history,
+                           const Delta& time_step, size_t order) const;
+
   template <typename T>
   bool can_change_step_size_impl(const TimeStepId& time_id,
                                  const ConstUntypedHistory<T>& history) const;
@@ -14,6 +14,7 @@
 #include "Time/SelfStart.hpp"
 #include "Time/TimeSteppers/AdamsCoefficients.hpp"
 #include "Time/TimeSteppers/AdamsLts.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -29,10 +30,10 @@ static_assert(adams_coefficients::maximum_order ==
 
 namespace {
 template <typename T, typename TimeType>
-void update_u_common(const gsl::not_null<T*> u,
-                     const ConstUntypedHistory<T>& history,
-                     const TimeType& step_end, const size_t method_order,
-                     const bool corrector) {
+void update_terms_common(const gsl::not_null<FusedUpdateTerms<T>*> terms,
+                         const ConstUntypedHistory<T>& history,
+                         const TimeType& step_end, const size_t method_order,
+                         const bool corrector) {
   ASSERT(history.size() >= method_order - 1, "Insufficient history");
   // Pass in whether to run the predictor or corrector even though we
   // can compute it as a sanity check.
@@ -61,12 +62,24 @@ void update_u_common(const gsl::not_null<T*> u,
   for (auto history_entry = used_history_begin;
        history_entry != history.end();
        ++history_entry, ++coefficient) {
-    *u += *coefficient * history_entry->derivative;
+    terms->emplace_back(*coefficient, &history_entry->derivative);
   }
   if (corrector) {
-    *u += coefficients.back() * history.substeps().front().derivative;
+    terms->emplace_back(coefficients.back(),
+                        &history.substeps().front().derivative);
   }
 }
+
+template <typename T, typename TimeType>
+void update_u_common(const gsl::not_null<T*> u, const T& initial,
+                     const ConstUntypedHistory<T>& history,
+                     const TimeType& step_end, const size_t method_order,
+                     const bool corrector) {
+  FusedUpdateTerms<T> terms{};
+  update_terms_common(make_not_null(&terms), history, step_end, method_order,
+                      corrector);
+  fused_update(u, initial, terms);
+}
 }  // namespace
 
 template <bool Monotonic>
@@ -202,9 +215,8 @@ void AdamsMoultonPc<Monotonic>::update_u_impl(
     const gsl::not_null<T*> u, const ConstUntypedHistory<T>& history,
     const TimeDelta& time_step) const {
   const Time next_time = history.back().time_step_id.step_time() + time_step;
-  *u = *history.back().value;
-  update_u_common(u, history, next_time, history.integration_order(),
-                  not history.at_step_start());
+  update_u_common(u, *history.back().value, history, next_time,
+                  history.integration_order(), not history.at_step_start());
 }
 
 template <bool Monotonic>
@@ -214,15 +226,13 @@ bool AdamsMoultonPc<Monotonic>::update_u_impl(
     const ConstUntypedHistory<T>& history, const TimeDelta& time_step) const {
   const bool predictor = history.at_step_start();
   const Time next_time = history.back().time_step_id.step_time() + time_step;
-  *u = *history.back().value;
-  update_u_common(u, history, next_time, history.integration_order(),
-                  not predictor);
+  update_u_common(u, *history.back().value, history, next_time,
+                  history.integration_order(), not predictor);
   if (predictor) {
     return false;
   }
-  *u_error = *history.back().value;
-  update_u_common(u_error, history, next_time, history.integration_order() - 1,
-                  true);
+  update_u_common(u_error, *history.back().value, history, next_time,
+                  history.integration_order() - 1, true);
   *u_error = *u - *u_error;
   return true;
 }
@@ -250,22 +260,22 @@ void AdamsMoultonPc<Monotonic>::clean_history_impl(
 
 template <bool Monotonic>
 template <typename T>
-bool AdamsMoultonPc<Monotonic>::dense_update_u_impl(
-    const gsl::not_null<T*> u, const ConstUntypedHistory<T>& history,
-    const double time) const {
+bool AdamsMoultonPc<Monotonic>::dense_output_terms_impl(
+    const gsl::not_null<FusedUpdateTerms<T>*> terms,
+    const ConstUntypedHistory<T>& history, const double time) const {
   if constexpr (Monotonic) {
     if (not history.at_step_start()) {
       return false;
     }
-    update_u_common(u, history, ApproximateTime{time},
-                    history.integration_order(), false);
+    update_terms_common(terms, history, ApproximateTime{time},
+                        history.integration_order(), false);
     return true;
   } else {
     if (history.at_step_start()) {
       return false;
     }
-    update_u_common(u, history, ApproximateTime{time},
-                    history.integration_order(), true);
+    update_terms_common(terms, history, ApproximateTime{time},
+                        history.integration_order(), true);
     return true;
   }
 }
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "Options/String.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
 #include "Time/TimeSteppers/LtsTimeStepper.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
@@ -166,9 +167,9 @@ class AdamsMoultonPc : public LtsTimeStepper {
   void clean_history_impl(const MutableUntypedHistory<T>& history) const;
 
   template <typename T>
-  bool dense_update_u_impl(gsl::not_null<T*> u,
-                           const ConstUntypedHistory<T>& history,
-                           double time) const;
+  bool dense_output_terms_impl(gsl::not_null<FusedUpdateTerms<T>*> terms,
+                               const ConstUntypedHistory<T>& history,
+                               double time) const;
 
   template <typename T>
   bool can_change_step_size_impl(const TimeStepId& time_id,
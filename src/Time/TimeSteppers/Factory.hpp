@@ -12,6 +12,8 @@
 #include "Time/TimeSteppers/Rk3Kennedy.hpp"
 #include "Time/TimeSteppers/Rk3Owren.hpp"
 #include "Time/TimeSteppers/Rk3Pareschi.hpp"
+#include "Time/TimeSteppers/Rk3Williamson.hpp"
+#include "Time/TimeSteppers/Rk4CarpenterKennedy.hpp"
 #include "Time/TimeSteppers/Rk4Kennedy.hpp"
 #include "Time/TimeSteppers/Rk4Owren.hpp"
 #include "Time/TimeSteppers/Rk5Owren.hpp"
@@ -23,8 +25,9 @@ namespace TimeSteppers {
 using time_steppers =
     tmpl::list<AdamsBashforth, AdamsMoultonPc<false>, AdamsMoultonPc<true>,
                ClassicalRungeKutta4, DormandPrince5, Heun2, Rk3HesthavenSsp,
-               Rk3Kennedy, Rk3Owren, Rk3Pareschi, Rk4Kennedy, Rk4Owren,
-               Rk5Owren, Rk5Tsitouras>;
+               Rk3Kennedy, Rk3Owren, Rk3Pareschi, Rk3Williamson,
+               Rk4CarpenterKennedy, Rk4Kennedy, Rk4Owren, Rk5Owren,
+               Rk5Tsitouras>;
 
 /// Typelist of available LtsTimeSteppers
 using lts_time_steppers =
@@ -36,7 +39,8 @@ using imex_time_steppers =
 
 /// Typelist of TimeSteppers whose substep times are strictly increasing
 using increasing_substep_time_steppers =
-    tmpl::list<AdamsBashforth, Rk3Owren, Rk4Owren>;
+    tmpl::list<AdamsBashforth, Rk3Owren, Rk3Williamson, Rk4CarpenterKennedy,
+               Rk4Owren>;
 
 /// Typelist of LtsTimeSteppers with monotonic() true, i.e., those
 /// that work with control systems.
@@ -0,0 +1,143 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/FusedUpdate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/MathWrapper.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace TimeSteppers {
+namespace {
+// Number of points accumulated at once.  The buffer for a block of
+// complex values is 4 kB, which comfortably fits in L1 cache.
+constexpr size_t block_size = 256;
+}  // namespace
+
+template <typename T>
+void fused_update(const gsl::not_null<T*> u, const T& initial,
+                  const FusedUpdateTerms<T>& terms) {
+  if constexpr (std::is_same_v<T, double> or
+                std::is_same_v<T, std::complex<double>>) {
+    T result = initial;
+    for (const auto& [coefficient, value] : terms) {
+      result += coefficient * *value;
+    }
+    *u = result;
+  } else {
+    using ValueType = typename T::value_type;
+    const size_t size = initial.size();
+    ASSERT(u->size() == size, "Size mismatch: " << u->size() << " vs " << size);
+#ifdef SPECTRE_DEBUG
+    for (const auto& term : terms) {
+      ASSERT(term.second->size() == size,
+             "Size mismatch: " << term.second->size() << " vs " << size);
+      ASSERT(term.second->data() != u->data(),
+             "The terms may not alias the result.");
+    }
+#endif  // SPECTRE_DEBUG
+
+    std::array<ValueType, block_size> buffer{};
+    for (size_t block_start = 0; block_start < size;
+         block_start += block_size) {
+      const size_t points_in_block = std::min(block_size, size - block_start);
+      const ValueType* const initial_block = initial.data() + block_start;
+      for (size_t i = 0; i < points_in_block; ++i) {
+        gsl::at(buffer, i) = initial_block[i];
+      }
+      for (const auto& [coefficient, value] : terms) {
+        const ValueType* const value_block = value->data() + block_start;
+        for (size_t i = 0; i < points_in_block; ++i) {
+          gsl::at(buffer, i) += coefficient * value_block[i];
+        }
+      }
+      ValueType* const u_block = u->data() + block_start;
+      for (size_t i = 0; i < points_in_block; ++i) {
+        u_block[i] = gsl::at(buffer, i);
+      }
+    }
+  }
+}
+
+template <typename T>
+void fused_update(const gsl::span<T* const> u, const T& initial,
+                  const gsl::span<const FusedUpdateTerms<T>> terms) {
+  ASSERT(u.size() == terms.size(), "Got " << u.size() << " results but "
+                                          << terms.size() << " sets of terms.");
+  if constexpr (std::is_same_v<T, double> or
+                std::is_same_v<T, std::complex<double>>) {
+    for (size_t j = 0; j < u.size(); ++j) {
+      fused_update(make_not_null(u[j]), initial, terms[j]);
+    }
+  } else {
+    using ValueType = typename T::value_type;
+    const size_t size = initial.size();
+#ifdef SPECTRE_DEBUG
+    for (size_t j = 0; j < u.size(); ++j) {
+      ASSERT(u[j]->size() == size,
+             "Size mismatch: " << u[j]->size() << " vs " << size);
+      ASSERT(u[j]->data() != initial.data(),
+             "The initial value may not alias any of the results.");
+      for (const auto& term : terms[j]) {
+        ASSERT(term.second->size() == size,
+               "Size mismatch: " << term.second->size() << " vs " << size);
+        for (size_t k = 0; k < u.size(); ++k) {
+          ASSERT(term.second->data() != u[k]->data(),
+                 "The terms may not alias any of the results.");
+        }
+      }
+    }
+#endif  // SPECTRE_DEBUG
+
+    // The blocks of `initial` and of the values shared between the
+    // results stay in cache while all results are accumulated.
+    std::array<ValueType, block_size> buffer{};
+    for (size_t block_start = 0; block_start < size;
+         block_start += block_size) {
+      const size_t points_in_block = std::min(block_size, size - block_start);
+      const ValueType* const initial_block = initial.data() + block_start;
+      for (size_t j = 0; j < u.size(); ++j) {
+        for (size_t i = 0; i < points_in_block; ++i) {
+          gsl::at(buffer, i) = initial_block[i];
+        }
+        for (const auto& [coefficient, value] : terms[j]) {
+          const ValueType* const value_block = value->data() + block_start;
+          for (size_t i = 0; i < points_in_block; ++i) {
+            gsl::at(buffer, i) += coefficient * value_block[i];
+          }
+        }
+        ValueType* const u_block = u[j]->data() + block_start;
+        for (size_t i = 0; i < points_in_block; ++i) {
+          u_block[i] = gsl::at(buffer, i);
+        }
+      }
+    }
+  }
+}
+
+#define MATH_WRAPPER_TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                     \
+  template void fused_update(                                    \
+      gsl::not_null<MATH_WRAPPER_TYPE(data)*> u,                 \
+      const MATH_WRAPPER_TYPE(data) & initial,                   \
+      const FusedUpdateTerms<MATH_WRAPPER_TYPE(data)>& terms);    \
+  template void fused_update(                                    \
+      gsl::span<MATH_WRAPPER_TYPE(data)* const> u,               \
+      const MATH_WRAPPER_TYPE(data) & initial,                   \
+      gsl::span<const FusedUpdateTerms<MATH_WRAPPER_TYPE(data)>> \
+          terms);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (MATH_WRAPPER_TYPES))
+#undef INSTANTIATE
+#undef MATH_WRAPPER_TYPE
+}  // namespace TimeSteppers
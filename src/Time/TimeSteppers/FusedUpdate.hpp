@@ -0,0 +1,55 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <boost/container/static_vector.hpp>
+#include <cstddef>
+#include <utility>
+
+#include "Utilities/Gsl.hpp"
+
+namespace TimeSteppers {
+/// The maximum number of terms that can be passed to `fused_update`.
+constexpr size_t maximum_fused_update_terms = 16;
+
+/// Pairs of coefficients and values for `fused_update`.
+template <typename T>
+using FusedUpdateTerms =
+    boost::container::static_vector<std::pair<double, const T*>,
+                                    maximum_fused_update_terms>;
+
+/// \ingroup TimeSteppersGroup
+/// \brief Set `*u` to `initial` plus the sum of `coefficient * *value`
+/// over the `terms`.
+///
+/// Adding the terms one at a time streams `*u` through memory once per
+/// term. Instead, this function accumulates all terms over blocks of
+/// points small enough to stay in cache, so that each value is read
+/// once and `*u` is written once.
+///
+/// `initial` may be `*u`, but the values in `terms` must not alias
+/// `*u`.
+///
+/// \tparam T One of the types in \ref MATH_WRAPPER_TYPES
+template <typename T>
+void fused_update(gsl::not_null<T*> u, const T& initial,
+                  const FusedUpdateTerms<T>& terms);
+
+/// \ingroup TimeSteppersGroup
+/// \brief Set each `*u[j]` to `initial` plus the sum of `coefficient *
+/// *value` over `terms[j]`.
+///
+/// All results are computed block by block in a single pass, so
+/// `initial` and any value appearing in several of the `terms` are
+/// only read from memory once.  This is used to produce dense output
+/// at several times together.
+///
+/// Neither `initial` nor the values in `terms` may alias any of the
+/// `*u`.
+///
+/// \tparam T One of the types in \ref MATH_WRAPPER_TYPES
+template <typename T>
+void fused_update(gsl::span<T* const> u, const T& initial,
+                  gsl::span<const FusedUpdateTerms<T>> terms);
+}  // namespace TimeSteppers
@@ -5,6 +5,7 @@
 
 #include "Time/History.hpp"
 #include "Time/Time.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 
 namespace TimeSteppers {
@@ -17,15 +18,18 @@ void apply_explicit_coefficients(const gsl::not_null<T*> u,
                                  const size_t number_of_coefficients_to_apply,
                                  const double time_step) {
   if (number_of_coefficients_to_apply > 0) {
+    FusedUpdateTerms<T> terms{};
     if (coefficients[0] != 0.0) {
-      *u += coefficients[0] * time_step * implicit_history.back().derivative;
+      terms.emplace_back(coefficients[0] * time_step,
+                         &implicit_history.back().derivative);
     }
     for (size_t i = 1; i < number_of_coefficients_to_apply; ++i) {
       if (coefficients[i] != 0.0) {
-        *u += coefficients[i] * time_step *
-              implicit_history.substeps()[i - 1].derivative;
+        terms.emplace_back(coefficients[i] * time_step,
+                           &implicit_history.substeps()[i - 1].derivative);
       }
     }
+    fused_update(u, *u, terms);
   }
 }
 }  // namespace
@@ -0,0 +1,223 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/LowStorageRungeKutta.hpp"
+
+#include "Time/EvolutionOrdering.hpp"
+#include "Time/History.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace TimeSteppers {
+
+uint64_t LowStorageRungeKutta::number_of_substeps() const {
+  return low_storage_tableau().update_coefficients.size();
+}
+
+uint64_t LowStorageRungeKutta::number_of_substeps_for_error() const {
+  return number_of_substeps();
+}
+
+size_t LowStorageRungeKutta::number_of_past_steps() const { return 0; }
+
+bool LowStorageRungeKutta::monotonic() const { return false; }
+
+TimeStepId LowStorageRungeKutta::next_time_id(
+    const TimeStepId& current_id, const TimeDelta& time_step) const {
+  const auto& substep_times = low_storage_tableau().substep_times;
+  const uint64_t substep = current_id.substep();
+  const uint64_t number_of_substeps = this->number_of_substeps();
+  ASSERT(substep_times.size() + 1 == number_of_substeps,
+         "Wrong number of substep times");
+
+  if (substep >= number_of_substeps) {
+    ERROR("In substep should be less than the number of steps, not "
+          << substep << "/" << number_of_substeps);
+  } else if (substep == number_of_substeps - 1) {
+    return current_id.next_step(time_step);
+  } else {
+    return current_id.next_substep(time_step, substep_times[substep]);
+  }
+}
+
+TimeStepId LowStorageRungeKutta::next_time_id_for_error(
+    const TimeStepId& current_id, const TimeDelta& time_step) const {
+  return next_time_id(current_id, time_step);
+}
+
+namespace {
+// The increment register r^(j) = du^(j) / dt used in the update of
+// substep j > 0.  The first register is the derivative at the start
+// of the step.  Later ones are accumulated by clean_history in the
+// derivative of the previous substep.
+template <typename T>
+const T& increment_register(const ConstUntypedHistory<T>& history,
+                            const size_t substep) {
+  ASSERT(substep > 0, "There is no increment register for substep 0.");
+  return substep == 1 ? history.back().derivative
+                      : history.substeps()[substep - 2].derivative;
+}
+}  // namespace
+
+template <typename T>
+void LowStorageRungeKutta::update_u_impl(const gsl::not_null<T*> u,
+                                         const ConstUntypedHistory<T>& history,
+                                         const TimeDelta& time_step) const {
+  ASSERT(history.integration_order() == order(),
+         "Fixed-order stepper cannot run at order "
+             << history.integration_order());
+  const auto& tableau = low_storage_tableau();
+  const double dt = time_step.value();
+
+  const size_t substep =
+      history.at_step_start() ? 0 : history.substeps().size();
+  if (substep >= number_of_substeps()) {
+    ERROR("Substep should be less than " << number_of_substeps() << ", not "
+                                         << substep);
+  }
+  const auto& latest_record =
+      substep == 0 ? history.back() : history.substeps().back();
+  ASSERT(latest_record.value.has_value(),
+         "Value for substep " << substep << " has been discarded.");
+
+  FusedUpdateTerms<T> terms{};
+  // u^(j+1) = u^(j) + B_{j+1} dt (A_{j+1} r^(j) + L(u^(j)))
+  const double update_coefficient = tableau.update_coefficients[substep] * dt;
+  if (substep > 0 and tableau.increment_coefficients[substep] != 0.0) {
+    terms.emplace_back(
+        update_coefficient * tableau.increment_coefficients[substep],
+        &increment_register(history, substep));
+  }
+  terms.emplace_back(update_coefficient, &latest_record.derivative);
+  fused_update(u, *latest_record.value, terms);
+}
+
+template <typename T>
+bool LowStorageRungeKutta::update_u_impl(const gsl::not_null<T*> u,
+                                         const gsl::not_null<T*> u_error,
+                                         const ConstUntypedHistory<T>& history,
+                                         const TimeDelta& time_step) const {
+  update_u_impl(u, history, time_step);
+
+  const size_t number_of_substeps = this->number_of_substeps();
+  const size_t substep =
+      history.at_step_start() ? 0 : history.substeps().size();
+  if (substep < number_of_substeps - 1) {
+    return false;
+  }
+
+  const auto& tableau = low_storage_tableau();
+  const double dt = time_step.value();
+  const double value_coefficient = tableau.error_value_coefficient;
+  const auto& start_record = history.back();
+  const auto& final_record = history.substeps().back();
+
+  // u_error = u - u_hat
+  FusedUpdateTerms<T> terms{};
+  terms.emplace_back(-(1.0 - value_coefficient), &*start_record.value);
+  terms.emplace_back(-value_coefficient, &*final_record.value);
+  if (tableau.error_initial_derivative_coefficient != 0.0) {
+    terms.emplace_back(-tableau.error_initial_derivative_coefficient * dt,
+                       &start_record.derivative);
+  }
+  if (tableau.error_final_derivative_coefficient != 0.0) {
+    terms.emplace_back(-tableau.error_final_derivative_coefficient * dt,
+                       &final_record.derivative);
+  }
+  fused_update(u_error, *u, terms);
+
+  return true;
+}
+
+template <typename T>
+void LowStorageRungeKutta::clean_history_impl(
+    const MutableUntypedHistory<T>& history) const {
+  if (history.at_step_start()) {
+    history.clear_substeps();
+    if (history.size() > 1) {
+      history.pop_front();
+    }
+    ASSERT(history.size() == 1, "Have more than one step after cleanup.");
+    return;
+  }
+
+  if (not history.substeps().back().value.has_value()) {
+    // This substep has already been cleaned.
+    return;
+  }
+  const size_t substep = history.substeps().size();
+  const TimeStepId latest_id = history.substeps().back().time_step_id;
+
+  // The step record is kept for the error estimate and for dense
+  // output.  The derivative just consumed is replaced by the next
+  // increment register, r^(j+1) = A_{j+1} r^(j) + L(u^(j)), and the
+  // previous register and the substep value are released.  This
+  // happens after any rollback of the substep, so a redone update
+  // still finds r^(j).
+  if (substep + 1 < number_of_substeps()) {
+    const double increment_coefficient =
+        low_storage_tableau().increment_coefficients[substep];
+    if (increment_coefficient != 0.0) {
+      const TimeStepId register_id =
+          substep == 1 ? history.back().time_step_id
+                       : history.substeps()[substep - 2].time_step_id;
+      history.add_to_derivative(latest_id, increment_coefficient, register_id);
+    }
+  } else {
+    history.discard_derivative(latest_id);
+  }
+  if (substep >= 2) {
+    history.discard_derivative(history.substeps()[substep - 2].time_step_id);
+  }
+  history.discard_value(latest_id);
+}
+
+template <typename T>
+bool LowStorageRungeKutta::dense_output_terms_impl(
+    const gsl::not_null<FusedUpdateTerms<T>*> terms,
+    const ConstUntypedHistory<T>& history, const double time) const {
+  if (not history.at_step_start()) {
+    return false;
+  }
+  const double step_start = history.front().time_step_id.step_time().value();
+  const double step_end = history.back().time_step_id.step_time().value();
+  const evolution_less<double> before{step_end > step_start};
+  if (history.size() == 1 or before(step_end, time)) {
+    return false;
+  }
+  const double step_size = step_end - step_start;
+  const double output_fraction = (time - step_start) / step_size;
+  ASSERT(output_fraction >= 0.0, "Attempting dense output at time "
+                                     << time << ", but already progressed past "
+                                     << step_start);
+
+  // Cubic Hermite interpolation, written as an increment from the
+  // value at the start of the step.
+  const double x = output_fraction;
+  const double end_value_coef = x * x * (3.0 - 2.0 * x);
+  const double start_derivative_coef = x * (1.0 - x) * (1.0 - x);
+  const double end_derivative_coef = x * x * (x - 1.0);
+  ASSERT(history.front().value.has_value() and
+             history.back().value.has_value(),
+         "Dense output requires the values at the ends of the step.");
+
+  terms->emplace_back(end_value_coef, &*history.back().value);
+  terms->emplace_back(-end_value_coef, &*history.front().value);
+  terms->emplace_back(start_derivative_coef * step_size,
+                      &history.front().derivative);
+  terms->emplace_back(end_derivative_coef * step_size,
+                      &history.back().derivative);
+  return true;
+}
+
+template <typename T>
+bool LowStorageRungeKutta::can_change_step_size_impl(
+    const TimeStepId& /*time_id*/,
+    const ConstUntypedHistory<T>& /*history*/) const {
+  return true;
+}
+
+TIME_STEPPER_DEFINE_OVERLOADS(LowStorageRungeKutta)
+}  // namespace TimeSteppers
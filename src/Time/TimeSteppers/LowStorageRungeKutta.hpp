@@ -0,0 +1,151 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class TimeDelta;
+namespace TimeSteppers {
+template <typename T>
+class ConstUntypedHistory;
+template <typename T>
+class MutableUntypedHistory;
+}  // namespace TimeSteppers
+/// \endcond
+
+namespace TimeSteppers {
+/*!
+ * \ingroup TimeSteppersGroup
+ * Intermediate base class implementing a generic low-storage
+ * Runge-Kutta scheme in Williamson (2N) form.
+ *
+ * A Williamson scheme with \f$s\f$ stages evolves the solution and a
+ * single increment register \f$\delta u\f$:
+ *
+ * \f{align}{
+ *   \delta u^{(j)} &= A_j \delta u^{(j-1)} + \Delta t\,
+ *     \mathcal{L}(t + c_{j-1} \Delta t, u^{(j-1)}), \\
+ *   u^{(j)} &= u^{(j-1)} + B_j \delta u^{(j)},
+ * \f}
+ *
+ * for \f$1 \le j \le s\f$, with \f$A_1 = 0\f$, \f$u^{(0)} = u^n\f$,
+ * and \f$u^{n+1} = u^{(s)}\f$.  The increment register is kept in the
+ * history: once the derivative \f$\mathcal{L}(u^{(j-1)})\f$ has
+ * been used in an update, `clean_history` replaces it with
+ * \f$\delta u^{(j)} / \Delta t\f$ and discards the previous
+ * register and the substep value.  Apart from the value and
+ * derivative at the start of the step, which are needed for the
+ * error estimate and dense output, the history therefore holds a
+ * single register between substeps, independent of the number of
+ * stages.  The previous register is still present until the history
+ * is cleaned, so an update can be repeated after a rollback of the
+ * latest substep.
+ *
+ * The error estimate is formed from data that is available at the
+ * final substep:
+ *
+ * \f{equation}{
+ *   \hat{u}^{n+1} = (1 - w) u^{(0)} + w u^{(s-1)}
+ *     + \Delta t \left(e_0 \mathcal{L}(u^{(0)})
+ *       + e_1 \mathcal{L}(u^{(s-1)})\right),
+ * \f}
+ *
+ * with coefficients chosen so that \f$\hat{u}^{n+1}\f$ is an
+ * embedded solution of lower order.  Including the register does
+ * not help: in general the only third-order combination of the
+ * retained data is \f$u^{n+1}\f$ itself, so the estimate is at most
+ * second order.  Dense output uses cubic Hermite interpolation
+ * between the start and end of the step, and so is only accurate to
+ * fourth order.
+ *
+ * From the TimeStepper interface, derived classes need only
+ * implement `order`, `error_estimate_order`, and `stable_step`, and
+ * should not include the `TIME_STEPPER_*` macros.  All other methods
+ * are implemented in terms of the coefficients returned by the
+ * `low_storage_tableau` function.
+ */
+class LowStorageRungeKutta : public virtual TimeStepper {
+ public:
+  struct LowStorageTableau {
+    /*!
+     * The coefficients \f$A_j\f$ scaling the previous increment
+     * register.  The first entry must be zero.
+     */
+    std::vector<double> increment_coefficients;
+    /*!
+     * The coefficients \f$B_j\f$ scaling the increment register in
+     * the update of the solution.
+     */
+    std::vector<double> update_coefficients;
+    /*!
+     * The times of the substeps, excluding the initial time step.
+     * Often called \f$c\f$ in the literature.
+     */
+    std::vector<double> substep_times;
+    /*!
+     * The coefficient \f$w\f$ of the final substep value
+     * \f$u^{(s-1)}\f$ in the error estimate.
+     */
+    double error_value_coefficient;
+    /*!
+     * The coefficient \f$e_0\f$ of the derivative at the start of
+     * the step in the error estimate.
+     */
+    double error_initial_derivative_coefficient;
+    /*!
+     * The coefficient \f$e_1\f$ of the derivative at the final
+     * substep in the error estimate.
+     */
+    double error_final_derivative_coefficient;
+  };
+
+  uint64_t number_of_substeps() const override;
+
+  uint64_t number_of_substeps_for_error() const override;
+
+  size_t number_of_past_steps() const override;
+
+  bool monotonic() const override;
+
+  TimeStepId next_time_id(const TimeStepId& current_id,
+                          const TimeDelta& time_step) const override;
+
+  TimeStepId next_time_id_for_error(const TimeStepId& current_id,
+                                    const TimeDelta& time_step) const override;
+
+  virtual const LowStorageTableau& low_storage_tableau() const = 0;
+
+ private:
+  template <typename T>
+  void update_u_impl(gsl::not_null<T*> u, const ConstUntypedHistory<T>& history,
+                     const TimeDelta& time_step) const;
+
+  template <typename T>
+  bool update_u_impl(gsl::not_null<T*> u, gsl::not_null<T*> u_error,
+                     const ConstUntypedHistory<T>& history,
+                     const TimeDelta& time_step) const;
+
+  template <typename T>
+  void clean_history_impl(const MutableUntypedHistory<T>& history) const;
+
+  template <typename T>
+  bool dense_output_terms_impl(gsl::not_null<FusedUpdateTerms<T>*> terms,
+                               const ConstUntypedHistory<T>& history,
+                               double time) const;
+
+  template <typename T>
+  bool can_change_step_size_impl(const TimeStepId& time_id,
+                                 const ConstUntypedHistory<T>& history) const;
+
+  TIME_STEPPER_DECLARE_OVERLOADS
+};
+}  // namespace TimeSteppers
@@ -8,6 +8,7 @@
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/History.hpp"
 #include "Time/Time.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -112,9 +113,9 @@ void Rk3HesthavenSsp::clean_history_impl(
 }
 
 template <typename T>
-bool Rk3HesthavenSsp::dense_update_u_impl(const gsl::not_null<T*> u,
-                                          const ConstUntypedHistory<T>& history,
-                                          const double time) const {
+bool Rk3HesthavenSsp::dense_output_terms_impl(
+    const gsl::not_null<FusedUpdateTerms<T>*> terms,
+    const ConstUntypedHistory<T>& history, const double time) const {
   if (not history.at_step_start()) {
     return false;
   }
@@ -130,13 +131,13 @@ bool Rk3HesthavenSsp::dense_update_u_impl(const gsl::not_null<T*> u,
                                      << time << ", but already progressed past "
                                      << step_start);
 
-  *u += -(2.0 / 3.0) * square(output_fraction) * *history.front().value +
-        output_fraction * (1.0 - output_fraction) * step_size *
-            history.front().derivative +
-        (2.0 / 3.0) * square(output_fraction) *
-            (*history.substeps()[1].value +
-             step_size * history.substeps()[1].derivative);
-
+  const double second_substep_coef = (2.0 / 3.0) * square(output_fraction);
+  terms->emplace_back(-second_substep_coef, &*history.front().value);
+  terms->emplace_back(output_fraction * (1.0 - output_fraction) * step_size,
+                      &history.front().derivative);
+  terms->emplace_back(second_substep_coef, &*history.substeps()[1].value);
+  terms->emplace_back(second_substep_coef * step_size,
+                      &history.substeps()[1].derivative);
   return true;
 }
 
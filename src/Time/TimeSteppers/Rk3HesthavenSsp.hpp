@@ -8,6 +8,7 @@
 
 #include "Options/String.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
@@ -87,9 +88,9 @@ class Rk3HesthavenSsp : public TimeStepper {
   void clean_history_impl(const MutableUntypedHistory<T>& history) const;
 
   template <typename T>
-  bool dense_update_u_impl(gsl::not_null<T*> u,
-                           const ConstUntypedHistory<T>& history,
-                           double time) const;
+  bool dense_output_terms_impl(gsl::not_null<FusedUpdateTerms<T>*> terms,
+                               const ConstUntypedHistory<T>& history,
+                               double time) const;
 
   template <typename T>
   bool can_change_step_size_impl(const TimeStepId& time_id,
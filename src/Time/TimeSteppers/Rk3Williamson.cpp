@@ -0,0 +1,34 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/Rk3Williamson.hpp"
+
+namespace TimeSteppers {
+
+size_t Rk3Williamson::order() const { return 3; }
+
+size_t Rk3Williamson::error_estimate_order() const { return 2; }
+
+// All three-stage, third-order methods share the stability polynomial
+// 1 + z + z^2/2 + z^3/6.
+double Rk3Williamson::stable_step() const { return 1.2563726633091645; }
+
+const LowStorageRungeKutta::LowStorageTableau&
+Rk3Williamson::low_storage_tableau() const {
+  static const LowStorageTableau tableau{
+      // Increment coefficients
+      {0.0, -5.0 / 9.0, -153.0 / 128.0},
+      // Update coefficients
+      {1.0 / 3.0, 15.0 / 16.0, 8.0 / 15.0},
+      // Substep times
+      {1.0 / 3.0, 3.0 / 4.0},
+      // Error estimate value coefficient
+      8.0 / 5.0,
+      // Error estimate derivative coefficients
+      -1.0 / 5.0,
+      0.0};
+  return tableau;
+}
+}  // namespace TimeSteppers
+
+PUP::able::PUP_ID TimeSteppers::Rk3Williamson::my_PUP_ID = 0;  // NOLINT
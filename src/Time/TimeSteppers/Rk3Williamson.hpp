@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Options/String.hpp"
+#include "Time/TimeSteppers/LowStorageRungeKutta.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace TimeSteppers {
+/*!
+ * \ingroup TimeSteppersGroup
+ * \brief The three-stage, third-order low-storage Runge-Kutta method
+ * of \cite Williamson1980.
+ *
+ * The coefficients are \f$A = (0, -5/9, -153/128)\f$ and \f$B = (1/3,
+ * 15/16, 8/15)\f$ in the notation of `LowStorageRungeKutta`.  The
+ * error estimate is the second-order solution
+ *
+ * \f{equation}{
+ *   \hat{u}^{n+1} = -\frac{3}{5} u^{(0)} + \frac{8}{5} u^{(2)}
+ *     - \frac{1}{5} \Delta t \mathcal{L}(u^{(0)}).
+ * \f}
+ *
+ * The CFL factor/stable step size is 1.2563726633091645.
+ */
+class Rk3Williamson : public LowStorageRungeKutta {
+ public:
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "A 3rd-order 2N-storage Runge-Kutta method."};
+
+  Rk3Williamson() = default;
+  Rk3Williamson(const Rk3Williamson&) = default;
+  Rk3Williamson& operator=(const Rk3Williamson&) = default;
+  Rk3Williamson(Rk3Williamson&&) = default;
+  Rk3Williamson& operator=(Rk3Williamson&&) = default;
+  ~Rk3Williamson() override = default;
+
+  size_t order() const override;
+
+  size_t error_estimate_order() const override;
+
+  double stable_step() const override;
+
+  WRAPPED_PUPable_decl_template(Rk3Williamson);  // NOLINT
+
+  explicit Rk3Williamson(CkMigrateMessage* /*unused*/) {}
+
+  const LowStorageTableau& low_storage_tableau() const override;
+};
+
+inline bool constexpr operator==(const Rk3Williamson& /*lhs*/,
+                                 const Rk3Williamson& /*rhs*/) {
+  return true;
+}
+
+inline bool constexpr operator!=(const Rk3Williamson& /*lhs*/,
+                                 const Rk3Williamson& /*rhs*/) {
+  return false;
+}
+}  // namespace TimeSteppers
@@ -0,0 +1,47 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/Rk4CarpenterKennedy.hpp"
+
+namespace TimeSteppers {
+
+size_t Rk4CarpenterKennedy::order() const { return 4; }
+
+size_t Rk4CarpenterKennedy::error_estimate_order() const { return 2; }
+
+// The stability polynomial is
+//
+//   p(z) = 1 + z + z^2/2 + z^3/6 + z^4/24 + z^5/200.
+//
+// The limiting direction is at a phase of 2.3727602224992640 from
+// the positive real axis.
+double Rk4CarpenterKennedy::stable_step() const { return 2.2213119445697123; }
+
+const LowStorageRungeKutta::LowStorageTableau&
+Rk4CarpenterKennedy::low_storage_tableau() const {
+  // The coefficients are given as ratios in the reference.
+  static const LowStorageTableau tableau{
+      // Increment coefficients
+      {0.0, -567301805773.0 / 1357537059087.0,
+       -2404267990393.0 / 2016746695238.0, -3550918686646.0 / 2091501179385.0,
+       -1275806237668.0 / 842570457699.0},
+      // Update coefficients
+      {1432997174477.0 / 9575080441755.0, 5161836677717.0 / 13612068292357.0,
+       1720146321549.0 / 2090206949498.0, 3134564353537.0 / 4481467310338.0,
+       2277821191437.0 / 14882151754819.0},
+      // Substep times
+      {1432997174477.0 / 9575080441755.0, 2526269341429.0 / 6820363962896.0,
+       2006345519317.0 / 3224310063776.0, 2802321613138.0 / 2924317926251.0},
+      // Error estimate value coefficient.  This and the derivative
+      // coefficients below are the unique combination of u^(0),
+      // L(u^(0)), u^(4), and L(u^(4)) that integrates quadratic
+      // functions of time exactly.
+      0.8817899834349926,
+      // Error estimate derivative coefficients
+      0.021543665951456663,
+      0.13345274991485875};
+  return tableau;
+}
+}  // namespace TimeSteppers
+
+PUP::able::PUP_ID TimeSteppers::Rk4CarpenterKennedy::my_PUP_ID = 0;  // NOLINT
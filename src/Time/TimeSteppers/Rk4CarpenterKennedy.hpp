@@ -0,0 +1,71 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Options/String.hpp"
+#include "Time/TimeSteppers/LowStorageRungeKutta.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace TimeSteppers {
+/*!
+ * \ingroup TimeSteppersGroup
+ * \brief The five-stage, fourth-order low-storage Runge-Kutta method
+ * of \cite Carpenter1994.
+ *
+ * This is solution 3 of \cite Carpenter1994, which is widely used for
+ * DG evolutions.  The error estimate is the second-order solution
+ *
+ * \f{equation}{
+ *   \hat{u}^{n+1} \approx 0.11821 u^{(0)} + 0.88179 u^{(4)}
+ *     + \Delta t \left(0.021544 \mathcal{L}(u^{(0)})
+ *       + 0.13345 \mathcal{L}(u^{(4)})\right),
+ * \f}
+ *
+ * which uses only data retained by `LowStorageRungeKutta`.  It also
+ * satisfies the third-order quadrature condition \f$\sum_i \hat{b}_i
+ * c_i^2 = 1/3\f$, so only one third-order condition is violated.
+ *
+ * The CFL factor/stable step size is 2.2213119445697123.  Unlike for
+ * the classical methods, the stability region is narrowest away from
+ * the negative real axis.
+ */
+class Rk4CarpenterKennedy : public LowStorageRungeKutta {
+ public:
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "A 4th-order 2N-storage Runge-Kutta method."};
+
+  Rk4CarpenterKennedy() = default;
+  Rk4CarpenterKennedy(const Rk4CarpenterKennedy&) = default;
+  Rk4CarpenterKennedy& operator=(const Rk4CarpenterKennedy&) = default;
+  Rk4CarpenterKennedy(Rk4CarpenterKennedy&&) = default;
+  Rk4CarpenterKennedy& operator=(Rk4CarpenterKennedy&&) = default;
+  ~Rk4CarpenterKennedy() override = default;
+
+  size_t order() const override;
+
+  size_t error_estimate_order() const override;
+
+  double stable_step() const override;
+
+  WRAPPED_PUPable_decl_template(Rk4CarpenterKennedy);  // NOLINT
+
+  explicit Rk4CarpenterKennedy(CkMigrateMessage* /*unused*/) {}
+
+  const LowStorageTableau& low_storage_tableau() const override;
+};
+
+inline bool constexpr operator==(const Rk4CarpenterKennedy& /*lhs*/,
+                                 const Rk4CarpenterKennedy& /*rhs*/) {
+  return true;
+}
+
+inline bool constexpr operator!=(const Rk4CarpenterKennedy& /*lhs*/,
+                                 const Rk4CarpenterKennedy& /*rhs*/) {
+  return false;
+}
+}  // namespace TimeSteppers
@@ -8,6 +8,7 @@
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/History.hpp"
 #include "Time/Time.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Math.hpp"
@@ -66,15 +67,18 @@ template <typename T>
 void compute_substep(const gsl::not_null<T*> u,
                      const ConstUntypedHistory<T>& history, const double dt,
                      const std::vector<double>& substep_coefficients) {
-  *u = *history.back().value;
+  FusedUpdateTerms<T> terms{};
   if (substep_coefficients[0] != 0.0) {
-    *u += substep_coefficients[0] * dt * history.back().derivative;
+    terms.emplace_back(substep_coefficients[0] * dt,
+                       &history.back().derivative);
   }
   for (size_t i = 1; i < substep_coefficients.size(); ++i) {
     if (substep_coefficients[i] != 0.0) {
-      *u += substep_coefficients[i] * dt * history.substeps()[i - 1].derivative;
+      terms.emplace_back(substep_coefficients[i] * dt,
+                         &history.substeps()[i - 1].derivative);
     }
   }
+  fused_update(u, *history.back().value, terms);
 }
 
 template <typename T>
@@ -151,9 +155,9 @@ void RungeKutta::clean_history_impl(
 }
 
 template <typename T>
-bool RungeKutta::dense_update_u_impl(const gsl::not_null<T*> u,
-                                     const ConstUntypedHistory<T>& history,
-                                     const double time) const {
+bool RungeKutta::dense_output_terms_impl(
+    const gsl::not_null<FusedUpdateTerms<T>*> terms,
+    const ConstUntypedHistory<T>& history, const double time) const {
   if (not history.at_step_start()) {
     return false;
   }
@@ -178,8 +182,9 @@ bool RungeKutta::dense_update_u_impl(const gsl::not_null<T*> u,
     const double coef =
         evaluate_polynomial(tableau.dense_coefficients[i], output_fraction);
     if (coef != 0.0) {
-      *u += coef * step_size *
-            (i == 0 ? history.front() : history.substeps()[i - 1]).derivative;
+      terms->emplace_back(
+          coef * step_size,
+          &(i == 0 ? history.front() : history.substeps()[i - 1]).derivative);
     }
   }
 
@@ -188,10 +193,9 @@ bool RungeKutta::dense_update_u_impl(const gsl::not_null<T*> u,
     const double coef =
         evaluate_polynomial(tableau.dense_coefficients.back(), output_fraction);
     if (coef != 0.0) {
-      *u += coef * step_size * history.back().derivative;
+      terms->emplace_back(coef * step_size, &history.back().derivative);
     }
   }
-
   return true;
 }
 
@@ -7,9 +7,13 @@
 #include <cstdint>
 #include <pup.h>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/MathWrapper.hpp"
 #include "Time/History.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
@@ -24,6 +28,37 @@ class TimeStepId;
 /// Holds classes that take time steps.
 namespace TimeSteppers {}
 
+namespace TimeSteppers::detail {
+// Dense output from the terms produced by `terms_function(terms,
+// time)`, which returns false if dense output is not possible.
+template <typename T, typename TermsFunction>
+bool dense_update_from_terms(const gsl::not_null<T*> u, const double time,
+                             const TermsFunction& terms_function) {
+  FusedUpdateTerms<T> terms{};
+  if (not terms_function(make_not_null(&terms), time)) {
+    return false;
+  }
+  fused_update(u, *u, terms);
+  return true;
+}
+
+template <typename T, typename TermsFunction>
+bool dense_update_from_terms(const gsl::span<T* const> u, const T& initial,
+                             const gsl::span<const double> times,
+                             const TermsFunction& terms_function) {
+  ASSERT(u.size() == times.size(), "Got " << u.size() << " results for "
+                                          << times.size() << " times.");
+  std::vector<FusedUpdateTerms<T>> terms(times.size());
+  for (size_t i = 0; i < times.size(); ++i) {
+    if (not terms_function(make_not_null(&terms[i]), times[i])) {
+      return false;
+    }
+  }
+  fused_update(u, initial, gsl::span<const FusedUpdateTerms<T>>(terms));
+  return true;
+}
+}  // namespace TimeSteppers::detail
+
 /// \cond
 #define TIME_STEPPER_WRAPPED_TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define TIME_STEPPER_DERIVED_CLASS(data) BOOST_PP_TUPLE_ELEM(1, data)
@@ -70,6 +105,12 @@ class TimeStepper : public PUP::able {
       const TimeSteppers::ConstUntypedHistory<TIME_STEPPER_WRAPPED_TYPE(   \
           data)>& history,                                                 \
       double time) const = 0;                                              \
+  virtual bool dense_update_u_forward(                                     \
+      gsl::span<TIME_STEPPER_WRAPPED_TYPE(data)* const> u,                 \
+      const TIME_STEPPER_WRAPPED_TYPE(data) & initial,                     \
+      const TimeSteppers::ConstUntypedHistory<TIME_STEPPER_WRAPPED_TYPE(   \
+          data)>& history,                                                 \
+      gsl::span<const double> times) const = 0;                            \
   virtual bool can_change_step_size_forward(                               \
       const TimeStepId& time_id,                                           \
       const TimeSteppers::ConstUntypedHistory<TIME_STEPPER_WRAPPED_TYPE(   \
@@ -160,10 +201,12 @@ class TimeStepper : public PUP::able {
   ///
   /// ```
   /// template <typename T>
-  /// bool dense_update_u_impl(
-  ///     gsl::not_null<T*> u, const ConstUntypedHistory<T>& history,
-  ///     double time) const;
+  /// bool dense_output_terms_impl(
+  ///     gsl::not_null<FusedUpdateTerms<T>*> terms,
+  ///     const ConstUntypedHistory<T>& history, double time) const;
   /// ```
+  ///
+  /// setting \p terms to the change from the start of the step.
   template <typename Vars>
   bool dense_update_u(const gsl::not_null<Vars*> u,
                       const TimeSteppers::History<Vars>& history,
@@ -172,6 +215,42 @@ class TimeStepper : public PUP::able {
                                   time);
   }
 
+  /// Compute the dense output at several times in the current step
+  /// together.
+  ///
+  /// Sets `(*u)[i]` to the value at `times[i]`, with \p initial
+  /// playing the role of the initial value of \p u in the
+  /// single-time overload.  The results are produced in a single pass
+  /// over the history, so this is cheaper than computing them
+  /// separately.  The function returns true if the dense output at
+  /// all of the times was successful, and otherwise the contents of
+  /// \p u are unspecified.  The vector \p u must already be sized to
+  /// match \p times, with each entry sized like \p initial.
+  template <typename Vars>
+  bool dense_update_u(const gsl::not_null<std::vector<Vars>*> u,
+                      const Vars& initial,
+                      const TimeSteppers::History<Vars>& history,
+                      const std::vector<double>& times) const {
+    ASSERT(u->size() == times.size(), "Got " << u->size() << " results for "
+                                             << times.size() << " times.");
+    using Wrapper =
+        decltype(make_math_wrapper(std::declval<gsl::not_null<Vars*>>()));
+    // The wrappers must stay alive, and not move, while the pointers
+    // into them are used.
+    std::vector<Wrapper> wrappers{};
+    wrappers.reserve(u->size());
+    std::vector<typename Wrapper::value_type*> results{};
+    results.reserve(u->size());
+    for (auto& result : *u) {
+      wrappers.push_back(make_math_wrapper(make_not_null(&result)));
+      results.push_back(&*wrappers.back());
+    }
+    return dense_update_u_forward(
+        gsl::span<typename Wrapper::value_type* const>(results),
+        *make_math_wrapper(initial), history.untyped(),
+        gsl::span<const double>(times));
+  }
+
   /// The convergence order of the stepper
   virtual size_t order() const = 0;
 
@@ -261,6 +340,12 @@ class TimeStepper : public PUP::able {
       const TimeSteppers::ConstUntypedHistory<TIME_STEPPER_WRAPPED_TYPE(   \
           data)>& history,                                                 \
       double time) const override;                                         \
+  bool dense_update_u_forward(                                             \
+      gsl::span<TIME_STEPPER_WRAPPED_TYPE(data)* const> u,                 \
+      const TIME_STEPPER_WRAPPED_TYPE(data) & initial,                     \
+      const TimeSteppers::ConstUntypedHistory<TIME_STEPPER_WRAPPED_TYPE(   \
+          data)>& history,                                                 \
+      gsl::span<const double> times) const override;                       \
   bool can_change_step_size_forward(                                       \
       const TimeStepId& time_id,                                           \
       const TimeSteppers::ConstUntypedHistory<TIME_STEPPER_WRAPPED_TYPE(   \
@@ -296,7 +381,23 @@ class TimeStepper : public PUP::able {
       const TimeSteppers::ConstUntypedHistory<TIME_STEPPER_WRAPPED_TYPE(   \
           data)>& history,                                                 \
       const double time) const {                                           \
-    return dense_update_u_impl(u, history, time);                          \
+    return TimeSteppers::detail::dense_update_from_terms(                  \
+        u, time, [this, &history](const auto terms, const double t) {      \
+          return this->dense_output_terms_impl(terms, history, t);         \
+        });                                                                \
+  }                                                                        \
+  TIME_STEPPER_DERIVED_CLASS_TEMPLATE(data)                                \
+  bool TIME_STEPPER_DERIVED_CLASS(data)::dense_update_u_forward(           \
+      const gsl::span<TIME_STEPPER_WRAPPED_TYPE(data)* const> u,           \
+      const TIME_STEPPER_WRAPPED_TYPE(data) & initial,                     \
+      const TimeSteppers::ConstUntypedHistory<TIME_STEPPER_WRAPPED_TYPE(   \
+          data)>& history,                                                 \
+      const gsl::span<const double> times) const {                         \
+    return TimeSteppers::detail::dense_update_from_terms(                  \
+        u, initial, times,                                                 \
+        [this, &history](const auto terms, const double t) {               \
+          return this->dense_output_terms_impl(terms, history, t);         \
+        });                                                                \
   }                                                                        \
   TIME_STEPPER_DERIVED_CLASS_TEMPLATE(data)                                \
   bool TIME_STEPPER_DERIVED_CLASS(data)::can_change_step_size_forward(     \
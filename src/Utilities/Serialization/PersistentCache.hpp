@@ -0,0 +1,129 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions to persist expensive artifacts between runs.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Store expensive artifacts on disk so later runs can reuse them.
+ *
+ * An artifact is identified by a `name` that describes what kind of data it is
+ * (e.g. "ExplicitInverse") and a `key` that is a hash of all inputs it was
+ * computed from. Each artifact is written to its own file
+ * `<cache_directory>/<name>_<key>.bin` with a header that records the format
+ * version, the key, and the size of the data, followed by the PUP-serialized
+ * artifact. An artifact is only reused if the header matches, so files written
+ * with a different format version or for different inputs are ignored and
+ * overwritten.
+ *
+ * Files are written to a temporary file first and then renamed, so concurrent
+ * writers (e.g. elements on different nodes that compute identical artifacts)
+ * never produce a corrupted file. The `key` must capture _all_ inputs of the
+ * artifact, since the cache has no other way to detect stale data.
+ */
+namespace persistent_cache {
+/// Increment when the file layout changes, so old caches are ignored
+constexpr uint32_t format_version = 1;
+
+namespace detail {
+// Identifies cache files, spells "SPCACHE" in ASCII
+constexpr uint64_t magic_number = 0x53504341434845;
+
+inline std::string artifact_path(const std::string& cache_directory,
+                                 const std::string& name, const size_t key) {
+  std::stringstream ss{};
+  ss << cache_directory << "/" << name << "_" << std::hex << key << ".bin";
+  return ss.str();
+}
+}  // namespace detail
+
+/// Read the artifact with the `name` and `key` from the `cache_directory`.
+/// Returns `std::nullopt` if no matching artifact was found.
+template <typename T>
+std::optional<T> read(const std::string& cache_directory,
+                      const std::string& name, const size_t key) {
+  const std::string path = detail::artifact_path(cache_directory, name, key);
+  std::ifstream file(path, std::ios::binary);
+  if (not file) {
+    return std::nullopt;
+  }
+  uint64_t magic_number = 0;
+  uint32_t version = 0;
+  size_t stored_key = 0;
+  size_t size = 0;
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+  file.read(reinterpret_cast<char*>(&magic_number), sizeof(magic_number));
+  file.read(reinterpret_cast<char*>(&version), sizeof(version));
+  file.read(reinterpret_cast<char*>(&stored_key), sizeof(stored_key));
+  file.read(reinterpret_cast<char*>(&size), sizeof(size));
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+  if (not file or magic_number != detail::magic_number or
+      version != format_version or stored_key != key or
+      size > file_system::file_size(path)) {
+    return std::nullopt;
+  }
+  std::vector<char> data(size);
+  file.read(data.data(), static_cast<std::streamsize>(size));
+  if (not file) {
+    return std::nullopt;
+  }
+  return deserialize<T>(data.data());
+}
+
+/// Write the `artifact` with the `name` and `key` to the `cache_directory`,
+/// creating the directory if needed. Failures to write are ignored, since the
+/// artifact can always be recomputed.
+template <typename T>
+void write(const std::string& cache_directory, const std::string& name,
+           const size_t key, const T& artifact) {
+  std::error_code error{};
+  std::filesystem::create_directories(cache_directory, error);
+  if (error) {
+    return;
+  }
+  const std::string path = detail::artifact_path(cache_directory, name, key);
+  const std::string temporary_path =
+      path + ".tmp" + std::to_string(std::random_device{}());
+  const std::vector<char> data = serialize<T>(artifact);
+  {
+    std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+    const uint64_t magic_number = detail::magic_number;
+    const uint32_t version = format_version;
+    const size_t size = data.size();
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    file.write(reinterpret_cast<const char*>(&magic_number),
+               sizeof(magic_number));
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    file.write(data.data(), static_cast<std::streamsize>(size));
+    if (not file) {
+      std::filesystem::remove(temporary_path, error);
+      return;
+    }
+  }
+  std::filesystem::rename(temporary_path, path, error);
+  if (error) {
+    std::filesystem::remove(temporary_path, error);
+  }
+}
+}  // namespace persistent_cache
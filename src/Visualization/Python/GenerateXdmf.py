@@ -9,11 +9,13 @@ The XDMF file format is documented here:
 https://xdmf.org/index.php/XDMF_Model_and_Format
 """
 
+import functools
 import logging
 import os
 import sys
 import xml.etree.ElementTree as ET
-from typing import Optional
+from multiprocessing import Pool
+from typing import Dict, List, Optional, Tuple
 
 import click
 import h5py
@@ -51,14 +53,25 @@ def _xmf_dtype(dtype: type):
 
 
 def _xmf_topology(
-    observation, topology_type: str, connectivity_name: str, grid_path: str
+    observation,
+    topology_type: str,
+    connectivity_name: str,
+    grid_path: str,
+    shared_topologies: Optional[dict] = None,
 ) -> ET.Element:
     num_vertices = {
         "Hexahedron": 8,
         "Quadrilateral": 4,
         "Triangle": 3,
     }[topology_type]
-    num_cells = len(observation[connectivity_name]) // num_vertices
+    connectivity = observation[connectivity_name]
+    num_cells = len(connectivity) // num_vertices
+    # Observations with the same element layout can share their connectivity
+    # dataset through a hard link in the H5 file (see
+    # `h5::VolumeData::extend_connectivity_data`). Point all of them to the
+    # first path so readers load the topology only once.
+    if shared_topologies is not None:
+        grid_path = shared_topologies.setdefault(connectivity.id, grid_path)
     xmf_topology = ET.Element(
         "Topology",
         TopologyType=topology_type,
@@ -161,6 +174,7 @@ def _xmf_grid(
     temporal_id: str,
     coordinates: str,
     filling_poles: bool = False,
+    shared_topologies: Optional[dict] = None,
 ) -> ET.Element:
     # Make sure the coordinates are found in the file. We assume there should
     # always be an x-coordinate.
@@ -207,6 +221,7 @@ def _xmf_grid(
                 topology_type="Triangle",
                 connectivity_name="pole_connectivity",
                 grid_path=grid_path,
+                shared_topologies=shared_topologies,
             )
         else:
             # Cover 2D surface
@@ -215,6 +230,7 @@ def _xmf_grid(
                 topology_type="Quadrilateral",
                 connectivity_name="connectivity",
                 grid_path=grid_path,
+                shared_topologies=shared_topologies,
             )
     else:
         # Cover volume
@@ -223,6 +239,7 @@ def _xmf_grid(
             topology_type={3: "Hexahedron", 2: "Quadrilateral"}[topo_dim],
             connectivity_name="connectivity",
             grid_path=grid_path,
+            shared_topologies=shared_topologies,
         )
     xmf_grid.append(xmf_topology)
 
@@ -269,79 +286,32 @@ def _xmf_grid(
     return xmf_grid
 
 
-def generate_xdmf(
-    h5files,
-    output: str,
-    subfile_name: str,
-    relative_paths: bool = True,
-    start_time: Optional[float] = None,
-    stop_time: Optional[float] = None,
-    stride: int = 1,
-    coordinates: str = "InertialCoordinates",
-):
-    """Generate an XDMF file for ParaView and VisIt
+def _xmf_to_string(xmf_element: ET.Element, level: int) -> str:
+    # Pretty-print XML
+    try:
+        # Added in Py 3.9
+        ET.indent(xmf_element, level=level)
+    except AttributeError:
+        pass
+    return "  " * level + ET.tostring(xmf_element, encoding="unicode")
 
-    Read volume data from the 'H5FILES' and generate an XDMF file. The XDMF file
-    points into the 'H5FILES' files so ParaView and VisIt can load the volume
-    data. To process multiple files suffixed with the node number and from
-    multiple segments specify a glob like 'Segment*/VolumeData*.h5'.
 
-    To load the XDMF file in ParaView you must choose the 'Xdmf Reader', NOT
-    'Xdmf3 Reader'.
+def _xmf_grids_in_file(
+    filename: str,
+    output: Optional[str],
+    subfile_name: str,
+    relative_paths: bool,
+    start_time: Optional[float],
+    stop_time: Optional[float],
+    stride: int,
+    coordinates: str,
+) -> List[Tuple[str, float, List[str]]]:
+    """Serialized XDMF grids of all selected observations in an H5 file
 
-    \f
-    Arguments:
-      h5files: List of H5 volume data files.
-      output: Output filename. A '.xmf' extension is added if not present.
-      subfile_name: Volume data subfile in the H5 files.
-      relative_paths: If True, use relative paths in the XDMF file (default). If
-        False, use absolute paths.
-      start_time: Optional. The earliest time at which to start visualizing. The
-        start-time value is included.
-      stop_time: Optional. The time at which to stop visualizing. The stop-time
-        value is not included.
-      stride: Optional. View only every stride'th time step.
-      coordinates: Optional. Name of coordinates dataset. Default:
-        "InertialCoordinates".
+    Returns a list of (temporal ID, time, grids) tuples, sorted by time. Each
+    file is processed independently, so files can be processed in parallel.
     """
-    h5files = [(h5py.File(filename, "r"), filename) for filename in h5files]
-
-    if not subfile_name:
-        subfiles = available_subfiles(
-            (h5file for h5file, _ in h5files), extension=".vol"
-        )
-        if len(subfiles) == 1:
-            subfile_name = subfiles[0]
-            logger.info(
-                f"Selected subfile {subfile_name} (the only available one)."
-            )
-        else:
-            raise RequiredChoiceError(
-                (
-                    "Specify '--subfile-name' / '-d' to select a"
-                    " subfile containing volume data."
-                ),
-                choices=subfiles,
-            )
-
-    if not subfile_name.endswith(".vol"):
-        subfile_name += ".vol"
-
-    # Prepare XDMF document by building up an XML tree
-    xmf_root = ET.Element("Xdmf", Version="2.0")
-    xmf_domain = ET.SubElement(xmf_root, "Domain")
-    xmf_timesteps = ET.SubElement(
-        xmf_domain,
-        "Grid",
-        Name="Evolution",
-        GridType="Collection",
-        CollectionType="Temporal",
-    )
-    # Collect timesteps in a hash map before inserting into XML so we can insert
-    # grids while stepping through H5 files
-    timesteps = dict()
-
-    for h5file, filename in h5files:
+    with h5py.File(filename, "r") as h5file:
         # Open subfile
         try:
             vol_subfile = h5file[subfile_name]
@@ -371,6 +341,9 @@ def generate_xdmf(
             key=lambda key_and_time: key_and_time[1],
         )
 
+        # Connectivity datasets that are shared between observations
+        shared_topologies = dict()
+        grids_in_file = []
         # Stride through timesteps
         for temporal_id, time in temporal_ids_and_values[::stride]:
             # Filter by start and end time
@@ -379,21 +352,9 @@ def generate_xdmf(
             if stop_time is not None and time > stop_time:
                 break
 
-            # A timestep is represented by a collection of grids. We store the
-            # grid collection in a hash map so each H5 file can insert grids.
-            if temporal_id in timesteps:
-                xmf_timestep_grid = timesteps[temporal_id]
-            else:
-                xmf_timestep_grid = ET.SubElement(
-                    xmf_timesteps, "Grid", Name="Grids", GridType="Collection"
-                )
-                # The time is stored as a `Time` tag in the grid collection
-                ET.SubElement(xmf_timestep_grid, "Time", Value=f"{time:.14e}")
-                timesteps[temporal_id] = xmf_timestep_grid
-
             # Construct the grid for this observation
             observation = vol_subfile[temporal_id]
-            xmf_timestep_grid.append(
+            xmf_grids = [
                 _xmf_grid(
                     observation,
                     topo_dim=topo_dim,
@@ -401,11 +362,12 @@ def generate_xdmf(
                     subfile_name=subfile_name,
                     temporal_id=temporal_id,
                     coordinates=coordinates,
+                    shared_topologies=shared_topologies,
                 )
-            )
+            ]
             # Connect poles if the data is a 2D surface in 3D
             if "pole_connectivity" in observation:
-                xmf_timestep_grid.append(
+                xmf_grids.append(
                     _xmf_grid(
                         observation,
                         topo_dim=topo_dim,
@@ -414,33 +376,131 @@ def generate_xdmf(
                         temporal_id=temporal_id,
                         coordinates=coordinates,
                         filling_poles=True,
+                        shared_topologies=shared_topologies,
                     )
                 )
+            grids_in_file.append(
+                (
+                    temporal_id,
+                    time,
+                    [_xmf_to_string(xmf_grid, 4) for xmf_grid in xmf_grids],
+                )
+            )
+    return grids_in_file
 
-    for h5file in h5files:
-        h5file[0].close()
 
-    # Pretty-print XML
-    try:
-        # Added in Py 3.9
-        ET.indent(xmf_root)
-    except AttributeError:
-        pass
+def generate_xdmf(
+    h5files,
+    output: str,
+    subfile_name: str,
+    relative_paths: bool = True,
+    start_time: Optional[float] = None,
+    stop_time: Optional[float] = None,
+    stride: int = 1,
+    coordinates: str = "InertialCoordinates",
+    num_jobs: Optional[int] = 1,
+):
+    """Generate an XDMF file for ParaView and VisIt
+
+    Read volume data from the 'H5FILES' and generate an XDMF file. The XDMF file
+    points into the 'H5FILES' files so ParaView and VisIt can load the volume
+    data. To process multiple files suffixed with the node number and from
+    multiple segments specify a glob like 'Segment*/VolumeData*.h5'.
+
+    To load the XDMF file in ParaView you must choose the 'Xdmf Reader', NOT
+    'Xdmf3 Reader'.
+
+    The H5 files are processed in parallel. The grids of all files are
+    collected in memory and then written to the XDMF file. Observations that share their connectivity dataset (see the
+    'extend-connectivity' command) share their topology in the XDMF file.
+
+    \f
+    Arguments:
+      h5files: List of H5 volume data files.
+      output: Output filename. A '.xmf' extension is added if not present.
+      subfile_name: Volume data subfile in the H5 files.
+      relative_paths: If True, use relative paths in the XDMF file (default). If
+        False, use absolute paths.
+      start_time: Optional. The earliest time at which to start visualizing. The
+        start-time value is included.
+      stop_time: Optional. The time at which to stop visualizing. The stop-time
+        value is not included.
+      stride: Optional. View only every stride'th time step.
+      coordinates: Optional. Name of coordinates dataset. Default:
+        "InertialCoordinates".
+      num_jobs: Optional. Maximum number of processes that read H5 files in
+        parallel. Default: 1. Set to None to use all available cores.
+    """
+    if not subfile_name:
+        subfiles = available_subfiles(h5files, extension=".vol")
+        if len(subfiles) == 1:
+            subfile_name = subfiles[0]
+            logger.info(
+                f"Selected subfile {subfile_name} (the only available one)."
+            )
+        else:
+            raise RequiredChoiceError(
+                (
+                    "Specify '--subfile-name' / '-d' to select a"
+                    " subfile containing volume data."
+                ),
+                choices=subfiles,
+            )
 
-    # Output XML
-    xmf_document = """\
+    if not subfile_name.endswith(".vol"):
+        subfile_name += ".vol"
+    if output and not output.endswith(".xmf"):
+        output += ".xmf"
+
+    # Collect the grids of all files, keeping the order of the files
+    process_file = functools.partial(
+        _xmf_grids_in_file,
+        output=output,
+        subfile_name=subfile_name,
+        relative_paths=relative_paths,
+        start_time=start_time,
+        stop_time=stop_time,
+        stride=stride,
+        coordinates=coordinates,
+    )
+    if num_jobs == 1 or len(h5files) == 1:
+        grids_per_file = list(map(process_file, h5files))
+    else:
+        with Pool(num_jobs) as pool:
+            grids_per_file = pool.map(process_file, h5files)
+
+    # A timestep is represented by a collection of grids, one (or two for
+    # surfaces with poles) per H5 file
+    timesteps: Dict[str, Tuple[float, List[str]]] = dict()
+    for grids_in_file in grids_per_file:
+        for temporal_id, time, xmf_grids in grids_in_file:
+            timesteps.setdefault(temporal_id, (time, []))[1].extend(xmf_grids)
+
+    # Write the XML document to the output
+    output_file = open(output, "w") if output else sys.stdout
+    try:
+        output_file.write(
+            """\
 <?xml version="1.0" ?>
 <!DOCTYPE Xdmf SYSTEM "Xdmf.dtd">
+<Xdmf Version="2.0">
+  <Domain>
+    <Grid Name="Evolution" GridType="Collection" CollectionType="Temporal">
 """
-    xmf_document += ET.tostring(xmf_root, encoding="unicode")
-    xmf_document += "\n"
-    if output:
-        if not output.endswith(".xmf"):
-            output += ".xmf"
-        with open(output, "w") as open_output_file:
-            open_output_file.write(xmf_document)
-    else:
-        sys.stdout.write(xmf_document)
+        )
+        for time, xmf_grids in timesteps.values():
+            output_file.write(
+                '      <Grid Name="Grids" GridType="Collection">\n'
+                # The time is stored as a `Time` tag in the grid collection
+                f'        <Time Value="{time:.14e}" />\n'
+            )
+            for xmf_grid in xmf_grids:
+                output_file.write(xmf_grid + "\n")
+            output_file.write("      </Grid>\n")
+        output_file.write("    </Grid>\n  </Domain>\n</Xdmf>\n")
+    finally:
+        if output:
+            output_file.close()
 
 
 @click.command(name="generate-xdmf", help=generate_xdmf.__doc__)
@@ -500,6 +560,14 @@ def generate_xdmf(
     show_default=True,
     help="The coordinates to use for visualization",
 )
+@click.option(
+    "-j",
+    "--num-jobs",
+    type=int,
+    default=1,
+    show_default=True,
+    help="The maximum number of processes that read H5 files in parallel.",
+)
 def generate_xdmf_command(**kwargs):
     _rich_traceback_guard = True  # Hide traceback until here
     generate_xdmf(**kwargs)
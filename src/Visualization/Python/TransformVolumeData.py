@@ -630,6 +630,34 @@ def parse_input_names(ctx, param, all_values):
     return input_names
 
 
+def parse_native_kernel(native_kernel: str):
+    """Parse a compiled kernel specified on the command line
+
+    The kernel is specified as '[OutputName=]KernelName[(Input1,Input2,...)]',
+    e.g. 'PointwiseL2Norm(GaugeConstraint_x,GaugeConstraint_y)' or
+    'GaugeConstraintNorm=PointwiseL2Norm(GaugeConstraint_x)'.
+    """
+    from spectre.IO.Exporter import TransformKernel
+
+    match = re.fullmatch(
+        r"\s*(?:(\w+)\s*=)?\s*(\w+)\s*(?:\((.*)\))?\s*", native_kernel
+    )
+    if not match:
+        raise click.BadParameter(
+            f"Invalid native kernel '{native_kernel}'. Specify as "
+            "'[OutputName=]KernelName[(Input1,Input2,...)]'."
+        )
+    output_name, name, input_components = match.groups()
+    input_components = (
+        [component.strip() for component in input_components.split(",")]
+        if input_components
+        else []
+    )
+    return TransformKernel(
+        name=name, input_components=input_components, output_name=output_name
+    )
+
+
 def parse_kernels(kernels, exec_files, map_input_names):
     # Load kernels from 'exec_files'
     for exec_file in exec_files:
@@ -674,6 +702,28 @@ def parse_kernels(kernels, exec_files, map_input_names):
         "files. Can be specified multiple times."
     ),
 )
+@click.option(
+    "--native-kernel",
+    "-n",
+    "native_kernels",
+    multiple=True,
+    help=(
+        "Compiled C++ kernel to apply to the volume data. Native kernels are "
+        "applied to the elements in parallel and are much faster than Python "
+        "kernels. Specify as '[OutputName=]KernelName[(Input1,Input2,...)]', "
+        "where the inputs are tensor components in the volume data, e.g. "
+        "'PointwiseL2Norm(GaugeConstraint_x,GaugeConstraint_y)'. Available "
+        "kernels: PartialDerivatives, PointwiseL2Norm, InertialCoordinates, "
+        "DetJacobian. Can be specified multiple times."
+    ),
+)
+@click.option(
+    "--num-threads",
+    "-j",
+    type=int,
+    show_default="all available cores",
+    help="Number of threads to apply native kernels with.",
+)
 @click.option(
     "--exec",
     "-e",
@@ -734,6 +784,8 @@ def transform_volume_data_command(
     h5files,
     subfile_name,
     kernels,
+    native_kernels,
+    num_threads,
     exec_files,
     map_input_names,
     integrate,
@@ -781,6 +833,10 @@ def transform_volume_data_command(
     You can override the input names with the '--input-name' / '-i' option.
     The output would be written to a dataset named 'ShiftMagnitude', which is
     the function name transformed to CamelCase.
+
+    For large datasets, prefer the compiled kernels that you can select with
+    the '--native-kernel' / '-n' option. They read and write each dataset once
+    per observation and process the elements in parallel.
     """
     open_h5_files = [
         spectre_h5.H5File(filename, "r" if integrate else "a")
@@ -804,11 +860,38 @@ def transform_volume_data_command(
                 choices=available_subfile_names,
             )
 
+    # Apply native kernels. The files are closed while the native kernels
+    # write to them.
+    if not kernels and not native_kernels:
+        raise click.UsageError(
+            "No '--kernel' / '-k' or '--native-kernel' / '-n' specified."
+        )
+    if native_kernels:
+        if integrate:
+            raise click.UsageError(
+                "Native kernels don't support the '--integrate' flag yet."
+            )
+        import spectre.IO.Exporter as spectre_exporter
+
+        for h5file in open_h5_files:
+            h5file.close()
+        output_names = spectre_exporter.transform_volume_data(
+            list(h5files),
+            subfile_name,
+            kernels=[parse_native_kernel(kernel) for kernel in native_kernels],
+            overwrite_existing=force,
+            num_threads=num_threads,
+        )
+        logger.info(f"Output datasets of native kernels: {set(output_names)}")
+        if not kernels:
+            return
+        open_h5_files = [
+            spectre_h5.H5File(filename, "a") for filename in h5files
+        ]
+
     volfiles = [h5file.get_vol(subfile_name) for h5file in open_h5_files]
 
     # Load kernels
-    if not kernels:
-        raise click.UsageError("No '--kernel' / '-k' specified.")
     kernels = list(parse_kernels(kernels, exec_files, map_input_names))
 
     # Apply!
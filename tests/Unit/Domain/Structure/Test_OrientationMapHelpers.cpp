@@ -9,6 +9,7 @@
 #include <memory>
 #include <pup.h>
 #include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -283,6 +284,25 @@ void test_3d_orient_variables_simple_case_by_hand() {
   CHECK(oriented_vars_dv == expected_vars_dv);
 }
 
+// Check that gathering each component with the cached indices reproduces the
+// oriented data, and that the indices are only computed once.
+template <typename TagsList>
+void check_gather_indices(const Variables<TagsList>& vars,
+                          const Variables<TagsList>& oriented_vars,
+                          const std::vector<size_t>& gather_indices,
+                          const std::vector<size_t>& gather_indices_again) {
+  CHECK(&gather_indices == &gather_indices_again);
+  const size_t num_pts = vars.number_of_grid_points();
+  REQUIRE(gather_indices.size() == num_pts);
+  for (size_t component = 0; component < vars.number_of_independent_components;
+       ++component) {
+    for (size_t s = 0; s < num_pts; ++s) {
+      CHECK(oriented_vars.data()[component * num_pts + s] ==
+            vars.data()[component * num_pts + gather_indices[s]]);
+    }
+  }
+}
+
 // Test orient_variables using a general orientation.
 // The challenge for the general test is to easily create the expected oriented
 // tensor, ideally without using the same algorithm that is used in
@@ -321,6 +341,10 @@ void test_3d_with_orientation(const OrientationMap<3>& orientation_map) {
   get<1>(get<Coords<3>>(expected_vars)) = oriented_mapped_coords[1];
   get<2>(get<Coords<3>>(expected_vars)) = oriented_mapped_coords[2];
   CHECK(oriented_vars == expected_vars);
+  check_gather_indices(
+      vars, oriented_vars,
+      orientation_gather_indices(extents, orientation_map),
+      orientation_gather_indices(extents, orientation_map));
 
 #ifdef SPECTRE_DEBUG
   {
@@ -566,6 +590,12 @@ void test_2d_slice_with_orientation(const OrientationMap<3>& orientation_map) {
 
     check_vector(vars, oriented_vars, slice_extents, sliced_dim,
                  orientation_map);
+    check_gather_indices(
+        vars, oriented_vars,
+        orientation_gather_indices_on_slice(slice_extents, sliced_dim,
+                                            orientation_map),
+        orientation_gather_indices_on_slice(slice_extents, sliced_dim,
+                                            orientation_map));
 
 #ifdef SPECTRE_DEBUG
     {
@@ -60,6 +60,11 @@ void test_block_time_independent() {
     const tnsr::I<double, Dim, Frame::Inertial> x(1.0);
     CHECK(map(xi) == x);
     CHECK(map.inverse(x).value() == xi);
+
+    // Test the maps shared by the elements in the block:
+    CHECK((*block.template element_block_map<Frame::Inertial>())(xi) == x);
+    CHECK(get<0>((*block.template element_block_map<Frame::Grid>())(xi)) ==
+          get<0>(x));
   };
 
   check_block(original_block);
@@ -148,6 +153,12 @@ void test_block_time_dependent() {
               .inverse(grid_to_inertial_map.inverse(x, time, functions_of_time)
                            .value())
               .value() == xi);
+
+    // Test the maps shared by the elements in the block:
+    CHECK((*block.template element_block_map<Frame::Inertial>())(
+              xi, time, functions_of_time) == x);
+    CHECK((*block.template element_block_map<Frame::Grid>())(xi) ==
+          logical_to_grid_map(xi));
   };
 
   check_block(original_block);
@@ -222,6 +222,21 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementMap", "[Unit][Domain]") {
                 block_map)};
         CHECK(element_map(xi) == expected_element_map(xi));
       }
+      {
+        INFO("Elements share the block map");
+        const ElementId<1> other_element_id{0, {{{2, 1}}}};
+        const ElementMap<1, Frame::Inertial> element_map{element_id, block};
+        const ElementMap<1, Frame::Inertial> other_element_map{
+            other_element_id, block};
+        CHECK(&element_map.block_map() == &other_element_map.block_map());
+        CHECK(&element_map.block_map() ==
+              block.element_block_map<Frame::Inertial>().get());
+        const auto deserialized_element_map =
+            serialize_and_deserialize(element_map);
+        CHECK(&deserialized_element_map.block_map() !=
+              &element_map.block_map());
+        CHECK(deserialized_element_map(xi) == element_map(xi));
+      }
     }
     {
       INFO("Time-dependent");
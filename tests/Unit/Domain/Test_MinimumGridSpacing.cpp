@@ -5,14 +5,21 @@
 
 #include <cmath>
 #include <cstddef>
+#include <tuple>
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/Index.hpp"
 #include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/MinimumGridSpacing.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
 
 // IWYU pragma: no_include "Utilities/Array.hpp"
 
@@ -93,6 +100,72 @@ void check_frame() {
   check<3, Frame>(
       Matrix{{1.0, 1.0, -1.0}, {1.0, -1.0, 1.0}, {-1.0, 1.0, 1.0}}, sqrt(3.));
 }
+
+// Maps distorted grid coordinates with x_inertial = transform * x_grid + 1.5
+// and checks that the minimum spacing from the grid frame agrees with the one
+// computed directly from the inertial coordinates. The grid spacing should be
+// rescaled only if the `transform` is a multiple of an orthogonal matrix.
+template <size_t Dim>
+void check_from_grid(const Matrix& transform, const bool is_rigid,
+                     const bool inv_jacobian_is_uniform = true) {
+  CAPTURE(transform);
+  CAPTURE(is_rigid);
+  CAPTURE(inv_jacobian_is_uniform);
+  Index<Dim> extents{};
+  for (size_t d = 0; d < Dim; ++d) {
+    extents[d] = 3 + d;
+  }
+  tnsr::I<DataVector, Dim, Frame::Grid> grid_coords(extents.product());
+  for (IndexIterator<Dim> point(extents); point; ++point) {
+    for (size_t d = 0; d < Dim; ++d) {
+      grid_coords.get(d)[point.collapsed_index()] =
+          square(static_cast<double>((*point)[d])) +
+          0.1 * static_cast<double>((*point)[Dim - 1]);
+    }
+  }
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords(extents.product(),
+                                                             1.5);
+  for (size_t d = 0; d < Dim; ++d) {
+    for (size_t d2 = 0; d2 < Dim; ++d2) {
+      inertial_coords.get(d) += transform(d, d2) * grid_coords.get(d2);
+    }
+  }
+  const Matrix inv_transform = blaze::inv(transform);
+  InverseJacobian<DataVector, Dim, Frame::Grid, Frame::Inertial> inv_jacobian(
+      extents.product());
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t j = 0; j < Dim; ++j) {
+      inv_jacobian.get(i, j) = inv_transform(i, j);
+    }
+  }
+  if (not inv_jacobian_is_uniform) {
+    // Not used for the spacing, but must prevent rescaling
+    inv_jacobian.get(0, 0)[extents.product() - 1] *= 1.1;
+  }
+
+  const double grid_spacing = minimum_grid_spacing(extents, grid_coords);
+  const double expected_spacing =
+      minimum_grid_spacing(extents, inertial_coords);
+  CHECK(minimum_grid_spacing(extents, inertial_coords, grid_spacing,
+                             inv_jacobian) == approx(expected_spacing));
+  // Detect whether the grid spacing was rescaled by passing a wrong one
+  const bool was_rescaled =
+      minimum_grid_spacing(extents, inertial_coords, 2.0 * grid_spacing,
+                           inv_jacobian) != approx(expected_spacing);
+  CHECK(was_rescaled == (is_rigid and inv_jacobian_is_uniform));
+
+  double tag_spacing = 0.0;
+  domain::Tags::MinimumGridSpacingFromGridCompute<Dim>::function(
+      make_not_null(&tag_spacing),
+      Mesh<Dim>{extents.indices(), Spectral::Basis::Legendre,
+                Spectral::Quadrature::GaussLobatto},
+      grid_spacing, inertial_coords,
+      std::make_tuple(
+          inertial_coords, inv_jacobian,
+          Jacobian<DataVector, Dim, Frame::Grid, Frame::Inertial>{},
+          tnsr::I<DataVector, Dim, Frame::Inertial>{}));
+  CHECK(tag_spacing == approx(expected_spacing));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.MinimumGridSpacing", "[Domain][Unit]") {
@@ -102,6 +175,33 @@ SPECTRE_TEST_CASE("Unit.Domain.MinimumGridSpacing", "[Domain][Unit]") {
   TestHelpers::db::test_compute_tag<
       domain::Tags::MinimumGridSpacingCompute<3, Frame::Inertial>>(
       "MinimumGridSpacing");
+  TestHelpers::db::test_compute_tag<
+      domain::Tags::MinimumGridSpacingFromGridCompute<3>>(
+      "MinimumGridSpacing");
   check_frame<Frame::Grid>();
   check_frame<Frame::Inertial>();
+
+  check_from_grid<1>(Matrix{{1.0}}, true);
+  check_from_grid<1>(Matrix{{-0.3}}, true);
+  check_from_grid<1>(Matrix{{0.3}}, true, false);
+  check_from_grid<2>(Matrix{{1.0, 0.0}, {0.0, 1.0}}, true);
+  // Rotation and uniform scaling
+  check_from_grid<2>(Matrix{{0.6, -0.8}, {0.8, 0.6}}, true);
+  check_from_grid<2>(Matrix{{1.2, -1.6}, {1.6, 1.2}}, true);
+  check_from_grid<2>(Matrix{{1.2, -1.6}, {1.6, 1.2}}, true, false);
+  // Reflection
+  check_from_grid<2>(Matrix{{0.0, 2.0}, {2.0, 0.0}}, true);
+  // Anisotropic
+  check_from_grid<2>(Matrix{{1.0, 0.0}, {0.0, 0.5}}, false);
+  check_from_grid<2>(Matrix{{1.0, 0.5}, {0.0, 1.0}}, false);
+  check_from_grid<3>(
+      Matrix{{0.0, -2.0, 0.0}, {2.0, 0.0, 0.0}, {0.0, 0.0, 2.0}}, true);
+  check_from_grid<3>(Matrix{{2.0 / 3.0, -1.0 / 3.0, 2.0 / 3.0},
+                            {2.0 / 3.0, 2.0 / 3.0, -1.0 / 3.0},
+                            {-1.0 / 3.0, 2.0 / 3.0, 2.0 / 3.0}},
+                     true);
+  check_from_grid<3>(
+      Matrix{{0.0, -2.0, 0.0}, {2.0, 0.0, 0.0}, {0.0, 0.0, 2.0}}, true, false);
+  check_from_grid<3>(
+      Matrix{{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.1}}, false);
 }
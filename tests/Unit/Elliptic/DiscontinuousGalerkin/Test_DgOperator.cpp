@@ -112,7 +112,8 @@ struct IncrementTemporalId {
 // Label to indicate the start of the apply-operator actions
 struct ApplyOperatorStart {};
 
-template <typename System, bool Linearized, typename Metavariables>
+template <typename System, bool Linearized, bool Assemble,
+          typename Metavariables>
 struct ElementArray {
   static constexpr size_t Dim = System::volume_dim;
   using metavariables = Metavariables;
@@ -128,10 +129,10 @@ struct ElementArray {
   using primal_fluxes_vars_tag = ::Tags::Variables<primal_fluxes_vars>;
   using operator_applied_to_vars_tag =
       ::Tags::Variables<db::wrap_tags_in<DgOperatorAppliedTo, primal_vars>>;
-  using dg_operator =
-      ::elliptic::dg::Actions::DgOperator<System, Linearized, TemporalIdTag,
-                                          vars_tag, primal_fluxes_vars_tag,
-                                          operator_applied_to_vars_tag>;
+  using dg_operator = ::elliptic::dg::Actions::DgOperator<
+      System, Linearized, TemporalIdTag, vars_tag, primal_fluxes_vars_tag,
+      operator_applied_to_vars_tag, vars_tag, primal_fluxes_vars_tag,
+      Assemble>;
   // Don't wrap the fixed sources in the `Var` prefix because typically we want
   // to impose inhomogeneous boundary conditions on the un-prefixed vars, i.e.
   // not necessarily the vars we apply the linearized operator to
@@ -216,11 +217,13 @@ struct ProjectTemporalId : tt::ConformsTo<::amr::protocols::Projector> {
   }
 };
 
-template <typename System, bool Linearized, typename AnalyticSolution>
+template <typename System, bool Linearized, bool Assemble,
+          typename AnalyticSolution>
 struct Metavariables {
   static constexpr size_t volume_dim = System::volume_dim;
   using analytic_solution = AnalyticSolution;
-  using element_array = ElementArray<System, Linearized, Metavariables>;
+  using element_array =
+      ElementArray<System, Linearized, Assemble, Metavariables>;
   using amr_component = AmrComponent<Metavariables>;
   using component_list = tmpl::list<element_array, amr_component>;
   using const_global_cache_tags =
@@ -260,11 +263,11 @@ struct Metavariables {
   void pup(PUP::er& /*p*/) {}
 };
 
-template <
-    typename System, bool Linearized, typename AnalyticSolution,
-    size_t Dim = System::volume_dim,
-    typename Metavars = Metavariables<System, Linearized, AnalyticSolution>,
-    typename ElementArray = typename Metavars::element_array>
+template <typename System, bool Linearized, bool Assemble = false,
+          typename AnalyticSolution, size_t Dim = System::volume_dim,
+          typename Metavars =
+              Metavariables<System, Linearized, Assemble, AnalyticSolution>,
+          typename ElementArray = typename Metavars::element_array>
 void test_dg_operator(
     const DomainCreator<Dim>& domain_creator, const double penalty_parameter,
     const bool use_massive_dg_operator, const Spectral::Quadrature quadrature,
@@ -285,6 +288,7 @@ void test_dg_operator(
     const bool test_amr = false) {
   CAPTURE(penalty_parameter);
   CAPTURE(use_massive_dg_operator);
+  CAPTURE(Assemble);
 
   using element_array = ElementArray;
   using vars_tag = typename element_array::vars_tag;
@@ -690,18 +694,30 @@ SPECTRE_TEST_CASE("Unit.Elliptic.DG.Operator", "[Unit][Elliptic]") {
       Approx analytic_solution_operator_approx =
           Approx::custom().epsilon(3.e-2).scale(M_PI * penalty_parameter *
                                                 square(4) / 0.5);
+      const std::vector<std::tuple<
+          std::unordered_map<ElementId<1>, Vars>,
+          std::unordered_map<ElementId<1>, PrimalFluxes>,
+          std::unordered_map<ElementId<1>, OperatorVars>>>
+          tests_data{{{{left_id, std::move(vars_rnd_left)},
+                       {midleft_id, std::move(vars_rnd_midleft)},
+                       {midright_id, std::move(vars_rnd_midright)},
+                       {right_id, std::move(vars_rnd_right)}},
+                      {{left_id, std::move(expected_primal_fluxes_rnd_left)},
+                       {right_id, std::move(expected_primal_fluxes_rnd_right)}},
+                      {{left_id, std::move(expected_operator_vars_rnd_left)},
+                       {right_id,
+                        std::move(expected_operator_vars_rnd_right)}}}};
       test_dg_operator<system, true>(
           domain_creator, penalty_parameter, false,
           Spectral::Quadrature::GaussLobatto, analytic_solution,
           analytic_solution_aux_approx, analytic_solution_operator_approx,
-          {{{{left_id, std::move(vars_rnd_left)},
-             {midleft_id, std::move(vars_rnd_midleft)},
-             {midright_id, std::move(vars_rnd_midright)},
-             {right_id, std::move(vars_rnd_right)}},
-            {{left_id, std::move(expected_primal_fluxes_rnd_left)},
-             {right_id, std::move(expected_primal_fluxes_rnd_right)}},
-            {{left_id, std::move(expected_operator_vars_rnd_left)},
-             {right_id, std::move(expected_operator_vars_rnd_right)}}}});
+          tests_data);
+      // The assembled operator must reproduce the matrix-free operator
+      test_dg_operator<system, true, true>(
+          domain_creator, penalty_parameter, false,
+          Spectral::Quadrature::GaussLobatto, analytic_solution,
+          analytic_solution_aux_approx, analytic_solution_operator_approx,
+          tests_data);
     }
     {
       INFO("Higher-resolution analytic-solution tests");
@@ -731,6 +747,11 @@ SPECTRE_TEST_CASE("Unit.Elliptic.DG.Operator", "[Unit][Elliptic]") {
             domain_creator, penalty_parameter, use_massive_dg_operator,
             quadrature, analytic_solution, analytic_solution_aux_approx,
             analytic_solution_operator_approx, {}, true);
+        // Also test that AMR re-assembles the operator
+        test_dg_operator<system, true, true>(
+            domain_creator, penalty_parameter, use_massive_dg_operator,
+            quadrature, analytic_solution, analytic_solution_aux_approx,
+            analytic_solution_operator_approx, {}, true);
       }
     }
   }
@@ -553,6 +553,68 @@ void test(const bool time_runs_forward) {
         {{step_center, center_vars},
          {second_trigger, initial_vars + 0.75 * step_size * deriv_vars}});
   }
+
+  // Triggers needing the evolved variables in consecutive steps of a
+  // substep method, which only has dense output up to the end of the
+  // most recent step
+  {
+    const double previous_step_trigger = start_time - 0.5 * step_size;
+    MockRuntimeSystem runner{
+        {std::make_unique<TimeSteppers::Rk3HesthavenSsp>()}};
+    set_up_component(&runner, {{previous_step_trigger, true, done_time, true},
+                               {step_center, true, done_time, true}});
+    // Set the history to a completed step starting at `step_start`
+    // and the current step to the one following it.
+    const auto set_step = [&deriv_vars, &exact_step_size, &runner](
+                              const TimeStepId& step_start,
+                              const VarsType& start_vars) {
+      auto& box =
+          ActionTesting::get_databox<component>(make_not_null(&runner), 0);
+      TimeStepId step_end = step_start;
+      db::mutate<Tags::HistoryEvolvedVariables<variables_tag>>(
+          [&deriv_vars, &exact_step_size, &start_vars, &step_end](
+              const gsl::not_null<History*> history,
+              const TimeStepper& time_stepper) {
+            *history = History(3);
+            do {
+              history->insert(step_end, start_vars, deriv_vars);
+              step_end = time_stepper.next_time_id(step_end, exact_step_size);
+            } while (step_end.substep() != 0);
+            history->insert(
+                step_end,
+                VarsType(start_vars + exact_step_size.value() * deriv_vars),
+                deriv_vars);
+          },
+          make_not_null(&box), db::get<Tags::TimeStepper<TimeStepper>>(box));
+      db::mutate<Tags::TimeStepId, Tags::Time>(
+          [&step_end](const gsl::not_null<TimeStepId*> time_step_id,
+                      const gsl::not_null<double*> time) {
+            *time_step_id = step_end;
+            *time = step_end.step_time().value();
+          },
+          make_not_null(&box));
+    };
+
+    // Only the trigger in the completed step can run.
+    set_step(TimeStepId(time_runs_forward, 0,
+                        time_step_id.step_time() - exact_step_size),
+             VarsType(initial_vars - step_size * deriv_vars));
+    TestCase::check_dense(
+        &runner, true,
+        {{previous_step_trigger, initial_vars - 0.5 * step_size * deriv_vars}});
+
+    // The next step completes the dense output for the second
+    // trigger.  (Unless the first trigger did not run because of the
+    // postprocessors.)
+    auto& box =
+        ActionTesting::get_databox<component>(make_not_null(&runner), 0);
+    if (db::get_mutable_reference<::Tags::EventsAndDenseTriggers>(
+            make_not_null(&box))
+            .next_trigger(box) == step_center) {
+      set_step(time_step_id, initial_vars);
+      TestCase::check_dense(&runner, true, {{step_center, center_vars}});
+    }
+  }
 }
 
 namespace test_postprocessors {
@@ -194,6 +194,12 @@ void test_persson() {
       }
     }
   }
+
+  // A vanishing field has no power in any mode and is never troubled
+  const Mesh<Dim> dg_mesh{5, Spectral::Basis::Legendre,
+                          Spectral::Quadrature::GaussLobatto};
+  const Scalar<DataVector> zero_field{dg_mesh.number_of_grid_points(), 0.0};
+  CHECK_FALSE(evolution::dg::subcell::persson_tci(zero_field, dg_mesh, 4.0, 1));
 }
 
 // [[TimeOut, 20]]
@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -14,6 +15,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 
@@ -114,6 +116,30 @@ void test_oscillation_indicator_2d_impl(const Spectral::Quadrature quadrature) {
       mesh);
   const double expected3 = 3178. / 9.;
   CHECK(indicator3 == approx(expected3));
+
+  // Batched evaluation on the same mesh. Scaling the data scales the indicator
+  // quadratically, and constant data has no oscillation.
+  const DataVector scaled_data = 2. * data;
+  const DataVector constant_data(mesh.number_of_grid_points(), 3.);
+  std::vector<double> indicators{};
+  Limiters::Weno_detail::oscillation_indicators(
+      make_not_null(&indicators),
+      Limiters::Weno_detail::DerivativeWeight::Unity,
+      {&data, &scaled_data, &constant_data, &data}, mesh);
+  REQUIRE(indicators.size() == 4);
+  CHECK(indicators[0] == approx(expected));
+  CHECK(indicators[1] == approx(4. * expected));
+  CHECK(indicators[2] == approx(0.));
+  CHECK(indicators[3] == approx(expected));
+  Limiters::Weno_detail::oscillation_indicators(
+      make_not_null(&indicators),
+      Limiters::Weno_detail::DerivativeWeight::PowTwoEll, {&data}, mesh);
+  REQUIRE(indicators.size() == 1);
+  CHECK(indicators[0] == approx(expected2));
+  Limiters::Weno_detail::oscillation_indicators(
+      make_not_null(&indicators),
+      Limiters::Weno_detail::DerivativeWeight::Unity, {}, mesh);
+  CHECK(indicators.empty());
 }
 
 void test_oscillation_indicator_2d() {
@@ -22,6 +22,7 @@
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeString.hpp"
+#include "Utilities/NoSuchType.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace evolution::dg {
@@ -268,8 +269,57 @@ void test_local_time_stepping_usage(const bool use_gauss_points) {
 
   CHECK(mortar_data == deserialized_mortar_data);
   CHECK_FALSE(mortar_data != deserialized_mortar_data);
+
+  {
+    INFO("Single precision");
+    MortarData<Dim> single_precision_mortar_data = mortar_data;
+    DataVector buffer{};
+    CHECK_FALSE(single_precision_mortar_data.stored_in_single_precision());
+    CHECK(&single_precision_mortar_data.local_mortar_vars(&buffer) ==
+          &single_precision_mortar_data.local_mortar_data()->second);
+    single_precision_mortar_data.convert_to_single_precision();
+    CHECK(single_precision_mortar_data.stored_in_single_precision());
+    CHECK(single_precision_mortar_data != mortar_data);
+    CHECK(single_precision_mortar_data.local_mortar_data()->first ==
+          local_mesh);
+    CHECK(single_precision_mortar_data.local_mortar_data()->second.size() == 0);
+    const DataVector& local_vars =
+        single_precision_mortar_data.local_mortar_vars(&buffer);
+    CHECK(&local_vars == &buffer);
+    Approx single_precision_approx =
+        Approx::custom().epsilon(1.e-6).scale(1.0);
+    CHECK_ITERABLE_CUSTOM_APPROX(local_vars, local_data,
+                                 single_precision_approx);
+    check_geometric_quantities(single_precision_mortar_data);
+    CHECK(serialize_and_deserialize(single_precision_mortar_data) ==
+          single_precision_mortar_data);
+
+    const DataVector neighbor_data = 2.0 * local_data;
+    single_precision_mortar_data.insert_neighbor_mortar_data(
+        time_step_id, local_mesh, neighbor_data);
+    CHECK(&single_precision_mortar_data.neighbor_mortar_vars(&buffer) ==
+          &single_precision_mortar_data.neighbor_mortar_data()->second);
+    single_precision_mortar_data.convert_to_single_precision();
+    CHECK_ITERABLE_CUSTOM_APPROX(
+        single_precision_mortar_data.neighbor_mortar_vars(&buffer),
+        neighbor_data, single_precision_approx);
+    const auto [extracted_local_data, extracted_neighbor_data] =
+        single_precision_mortar_data.extract();
+    CHECK_ITERABLE_CUSTOM_APPROX(extracted_local_data.second, local_data,
+                                 single_precision_approx);
+    CHECK_ITERABLE_CUSTOM_APPROX(extracted_neighbor_data.second, neighbor_data,
+                                 single_precision_approx);
+    CHECK_FALSE(single_precision_mortar_data.stored_in_single_precision());
+  }
 }
 
+struct SystemWithSinglePrecisionHistory {
+  static constexpr bool lts_boundary_history_in_single_precision = true;
+};
+static_assert(lts_boundary_history_in_single_precision_v<
+              SystemWithSinglePrecisionHistory>);
+static_assert(not lts_boundary_history_in_single_precision_v<NoSuchType>);
+
 template <size_t Dim>
 void test() {
   test_global_time_stepping_usage<Dim>();
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <memory>
 #include <random>
@@ -41,6 +42,7 @@
 #include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/Heun2.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
@@ -657,6 +659,56 @@ void test_point_reseting() {
   CHECK_ITERABLE_APPROX(get(get<Var1>(box)), (get<0, 0>(var2)));
 }
 
+void test_fixed_size_solvers() {
+  using imex::solve_implicit_sector_detail::fixed_size_linear_solve;
+  using imex::solve_implicit_sector_detail::fixed_size_newton_solve;
+  {
+    // Requires pivoting because of the zero in the upper left.
+    std::array<std::array<double, 3>, 3> matrix{
+        {{{0.0, 2.0, 1.0}}, {{1.0, 1.0, 0.0}}, {{3.0, 0.0, 4.0}}}};
+    const auto original_matrix = matrix;
+    const std::array<double, 3> expected{{1.0, -2.0, 3.0}};
+    std::array<double, 3> rhs{};
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        gsl::at(rhs, i) +=
+            gsl::at(gsl::at(original_matrix, i), j) * gsl::at(expected, j);
+      }
+    }
+    CHECK(fixed_size_linear_solve(make_not_null(&matrix),
+                                  make_not_null(&rhs)));
+    CHECK_ITERABLE_APPROX(rhs, expected);
+  }
+  {
+    std::array<std::array<double, 2>, 2> matrix{
+        {{{1.0, 2.0}}, {{2.0, 4.0}}}};
+    std::array<double, 2> rhs{{1.0, 1.0}};
+    CHECK(not fixed_size_linear_solve(make_not_null(&matrix),
+                                      make_not_null(&rhs)));
+  }
+
+  // f(x, y) = (x^2 + y^2 - 4, x - y)
+  struct Circle {
+    std::array<double, 2> operator()(const std::array<double, 2>& x) const {
+      return {{square(x[0]) + square(x[1]) - 4.0, x[0] - x[1]}};
+    }
+    std::array<std::array<double, 2>, 2> jacobian(
+        const std::array<double, 2>& x) const {
+      return {{{{2.0 * x[0], 2.0 * x[1]}}, {{1.0, -1.0}}}};
+    }
+  };
+  std::array<double, 2> x{{3.0, 1.0}};
+  CHECK(fixed_size_newton_solve(make_not_null(&x), Circle{}, 1.0e-12, 20));
+  CHECK(x[0] == approx(sqrt(2.0)));
+  CHECK(x[1] == approx(sqrt(2.0)));
+  // Singular jacobian at the initial guess
+  x = {{0.0, 0.0}};
+  CHECK(not fixed_size_newton_solve(make_not_null(&x), Circle{}, 1.0e-12, 20));
+  // Not enough iterations
+  x = {{3.0, 1.0}};
+  CHECK(not fixed_size_newton_solve(make_not_null(&x), Circle{}, 1.0e-12, 2));
+}
+
 struct DesiredLevel : db::SimpleTag {
   using type = Scalar<DataVector>;
 };
@@ -766,5 +818,6 @@ SPECTRE_TEST_CASE("Unit.Evolution.Imex.SolveImplicitSector",
   test_solve_implicit_sector<false>(imex::Mode::SemiImplicit);
   test_solve_implicit_sector<true>(imex::Mode::SemiImplicit);
   test_point_reseting();
+  test_fixed_size_solvers();
   test_fallback();
 }
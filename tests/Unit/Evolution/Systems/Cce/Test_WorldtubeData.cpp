@@ -4,12 +4,16 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <string>
+#include <vector>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
@@ -21,6 +25,8 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/BoundaryTestHelpers.hpp"
 #include "Helpers/Evolution/Systems/Cce/WriteToWorldtubeH5.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
 #include "NumericalAlgorithms/Interpolation/BarycentricRationalSpanInterpolator.hpp"
 #include "NumericalAlgorithms/Interpolation/CubicSpanInterpolator.hpp"
 #include "NumericalAlgorithms/Interpolation/LinearSpanInterpolator.hpp"
@@ -776,6 +782,69 @@ void test_reduced_spec_worldtube_buffer_updater(
       });
   CHECK(buffer_updater.get_extraction_radius() == 100.0);
 }
+
+template <typename Generator>
+void test_batched_mode_recording(const gsl::not_null<Generator*> gen) {
+  UniformCustomDistribution<double> value_dist{-1.0, 1.0};
+  const size_t l_max = 4;
+  const std::string single_filename = "BatchedRecorderTest_single.h5";
+  const std::string batched_filename = "BatchedRecorderTest_batched.h5";
+  for (const auto& filename : {single_filename, batched_filename}) {
+    if (file_system::check_if_file_exists(filename)) {
+      file_system::rm(filename, true);
+    }
+  }
+  std::vector<double> times{};
+  std::vector<ComplexModalVector> modes{};
+  for (size_t t = 0; t < 5; ++t) {
+    times.push_back(0.1 * static_cast<double>(t));
+    modes.push_back(make_with_random_values<ComplexModalVector>(
+        gen, make_not_null(&value_dist), square(l_max + 1)));
+  }
+  // scoped to close the files
+  {
+    ReducedWorldtubeModeRecorder single_recorder{single_filename};
+    ReducedWorldtubeModeRecorder batched_recorder{batched_filename};
+    for (const bool is_real : {true, false}) {
+      const std::string dataset = is_real ? "/Real" : "/Complex";
+      for (size_t t = 0; t < times.size(); ++t) {
+        single_recorder.append_worldtube_mode_data(dataset, times[t], modes[t],
+                                                   l_max, is_real);
+      }
+      // an empty batch does not create or modify the dataset
+      batched_recorder.append_worldtube_mode_data(
+          dataset, std::vector<double>{}, std::vector<ComplexModalVector>{},
+          l_max, is_real);
+      batched_recorder.append_worldtube_mode_data(
+          dataset, std::vector<double>{times.begin(), times.begin() + 2},
+          std::vector<ComplexModalVector>{modes.begin(), modes.begin() + 2},
+          l_max, is_real);
+      batched_recorder.append_worldtube_mode_data(
+          dataset, std::vector<double>{times.begin() + 2, times.end()},
+          std::vector<ComplexModalVector>{modes.begin() + 2, modes.end()},
+          l_max, is_real);
+    }
+  }
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> single_file{single_filename};
+    const h5::H5File<h5::AccessType::ReadOnly> batched_file{batched_filename};
+    for (const std::string dataset : {"/Real", "/Complex"}) {
+      const auto& single_dat = single_file.get<h5::Dat>(dataset);
+      const Matrix single_data = single_dat.get_data();
+      const auto single_legend = single_dat.get_legend();
+      single_file.close_current_object();
+      const auto& batched_dat = batched_file.get<h5::Dat>(dataset);
+      CHECK(batched_dat.get_legend() == single_legend);
+      CHECK(batched_dat.get_data() == single_data);
+      batched_file.close_current_object();
+    }
+  }
+  for (const auto& filename : {single_filename, batched_filename}) {
+    if (file_system::check_if_file_exists(filename)) {
+      file_system::rm(filename, true);
+    }
+  }
+}
 }  // namespace
 
 // An increased timeout because this test seems to have high variance in
@@ -800,6 +869,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ReadBoundaryDataH5",
     test_reduced_spec_worldtube_buffer_updater(make_not_null(&gen), true);
     test_reduced_spec_worldtube_buffer_updater(make_not_null(&gen), false);
   }
+  {
+    INFO("Testing batched mode recording");
+    test_batched_mode_recording(make_not_null(&gen));
+  }
   {
     INFO("Testing data managers");
     test_data_manager_with_dummy_buffer_updater<MetricWorldtubeDataManager,
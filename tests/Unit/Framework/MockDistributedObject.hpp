@@ -7,8 +7,6 @@
 #include <array>
 #include <boost/preprocessor/control/if.hpp>
 #include <boost/preprocessor/logical/compl.hpp>
-#include <boost/preprocessor/logical/not.hpp>
-#include <boost/preprocessor/punctuation/comma_if.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <converse.h>
 #include <cstddef>
@@ -25,6 +23,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
@@ -496,11 +495,8 @@ class MockDistributedObject {
   void NAME(const bool direct_from_action_runner = false) {                   \
     if (direct_from_action_runner) {                                          \
       performing_action_ = true;                                              \
-      Action::template apply<Component>(                                      \
-          box_, *global_cache_,                                               \
-          std::as_const(array_index_)                                         \
-              BOOST_PP_COMMA_IF(BOOST_PP_NOT(USE_SIMPLE_ACTION)) BOOST_PP_IF( \
-                  USE_SIMPLE_ACTION, , make_not_null(&node_lock_)));          \
+      forward_tuple_to_##NAME<Action>(std::tuple<>{},                         \
+                                    std::index_sequence<>{});                 \
       performing_action_ = false;                                             \
     } else {                                                                  \
       NAME##_queue_.push_back(                                                \
@@ -520,11 +516,8 @@ class MockDistributedObject {
                                   index_of_action::value>;                    \
     if (direct_from_action_runner) {                                          \
       performing_action_ = true;                                              \
-      new_action::template apply<Component>(                                  \
-          box_, *global_cache_,                                               \
-          std::as_const(array_index_)                                         \
-              BOOST_PP_COMMA_IF(BOOST_PP_NOT(USE_SIMPLE_ACTION)) BOOST_PP_IF( \
-                  USE_SIMPLE_ACTION, , make_not_null(&node_lock_)));          \
+      forward_tuple_to_##NAME<new_action>(std::tuple<>{},                     \
+                                        std::index_sequence<>{});             \
       performing_action_ = false;                                             \
     } else {                                                                  \
       simple_action_queue_.push_back(                                         \
@@ -657,9 +650,19 @@ class MockDistributedObject {
   template <typename Action, typename... Args, size_t... Is>
   void forward_tuple_to_threaded_action(std::tuple<Args...>&& args,
                                         std::index_sequence<Is...> /*meta*/) {
-    Action::template apply<Component>(
-        box_, *global_cache_, std::as_const(array_index_),
-        make_not_null(&node_lock_), std::forward<Args>(std::get<Is>(args))...);
+    // Like Parallel::DistributedObject, pass the distributed object to
+    // threaded actions on a DgElementCollection
+    if constexpr (Parallel::is_dg_element_collection_v<Component>) {
+      Action::template apply<Component>(
+          box_, *global_cache_, std::as_const(array_index_),
+          make_not_null(&node_lock_), this,
+          std::forward<Args>(std::get<Is>(args))...);
+    } else {
+      Action::template apply<Component>(
+          box_, *global_cache_, std::as_const(array_index_),
+          make_not_null(&node_lock_),
+          std::forward<Args>(std::get<Is>(args))...);
+    }
   }
 
   template <typename ThisAction, typename ActionList, typename DbTags>
@@ -10,6 +10,11 @@
 #include <cstddef>
 #include <vector>
 
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
 #include "Utilities/Numeric.hpp"
 
@@ -140,4 +145,72 @@ void check_implicit_tableau(const TimeSteppers::ImexRungeKutta& stepper,
                          stepper.implicit_butcher_tableau(),
                          stepper.implicit_stage_order(), stiffly_accurate);
 }
+
+void check_tableau(const TimeSteppers::LowStorageRungeKutta& stepper) {
+  INFO("check_tableau");
+  const auto& tableau = stepper.low_storage_tableau();
+  const auto& increment_coefficients = tableau.increment_coefficients;
+  const auto& update_coefficients = tableau.update_coefficients;
+  const auto& substep_times = tableau.substep_times;
+
+  // The error estimate references the last substep.
+  CHECK(update_coefficients.size() >= 2);
+  CHECK(increment_coefficients.size() == update_coefficients.size());
+  CHECK(substep_times.size() + 1 == update_coefficients.size());
+  CHECK(increment_coefficients[0] == 0.0);
+  for (const double coefficient : update_coefficients) {
+    CHECK(coefficient != 0.0);
+  }
+
+  // Integrating a constant derivative of 1 must reproduce the
+  // substep times and the full step.
+  double increment = 0.0;
+  double time = 0.0;
+  for (size_t substep = 0; substep < update_coefficients.size(); ++substep) {
+    increment = increment_coefficients[substep] * increment + 1.0;
+    time += update_coefficients[substep] * increment;
+    if (substep < substep_times.size()) {
+      CHECK(time == approx(substep_times[substep]));
+    }
+  }
+  CHECK(time == approx(1.0));
+}
+
+void check_history_storage(const TimeSteppers::LowStorageRungeKutta& stepper,
+                           const size_t max_stored) {
+  INFO("check_history_storage");
+  const Slab slab(0.0, 1.0);
+  const auto step_size = slab.duration() / 4;
+  TimeStepId time_id(true, 0, slab.start());
+  TimeSteppers::History<double> history{stepper.order()};
+  double y = 1.0;
+  double y_error = 0.0;
+  for (size_t substep = 0; substep < 3 * stepper.number_of_substeps();
+       ++substep) {
+    history.insert(time_id, y, y);
+    stepper.update_u(make_not_null(&y), make_not_null(&y_error), history,
+                     step_size);
+    stepper.clean_history(make_not_null(&history));
+    time_id = stepper.next_time_id_for_error(time_id, step_size);
+
+    size_t stored = 0;
+    const auto count_record = [&history, &stored](const auto& record) {
+      if (record.value.has_value()) {
+        ++stored;
+      }
+      if (not history.derivative_is_discarded(record.time_step_id)) {
+        ++stored;
+      }
+    };
+    for (const auto& record : history) {
+      count_record(record);
+    }
+    for (const auto& record : history.substeps()) {
+      count_record(record);
+    }
+    CAPTURE(time_id);
+    CHECK(stored <= max_stored);
+  }
+  CHECK(y == approx(exp(0.75)).epsilon(1.0e-3));
+}
 }  // namespace TestHelpers::RungeKutta
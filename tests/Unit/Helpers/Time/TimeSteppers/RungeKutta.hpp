@@ -6,6 +6,7 @@
 #include <cstddef>
 
 #include "Time/TimeSteppers/ImexRungeKutta.hpp"
+#include "Time/TimeSteppers/LowStorageRungeKutta.hpp"
 #include "Time/TimeSteppers/RungeKutta.hpp"
 
 namespace TestHelpers::RungeKutta {
@@ -24,4 +25,13 @@ void check_implicit_tableau(
 /// Convenience wrapper for the previous function
 void check_implicit_tableau(const TimeSteppers::ImexRungeKutta& stepper,
                             bool stiffly_accurate);
+
+/// Sanity-check the coefficients of a low-storage method
+void check_tableau(const TimeSteppers::LowStorageRungeKutta& stepper);
+
+/// Check that a low-storage method never holds more than \p
+/// max_stored values and derivatives in its history between
+/// substeps, independent of the number of stages.
+void check_history_storage(const TimeSteppers::LowStorageRungeKutta& stepper,
+                           size_t max_stored);
 }  // namespace TestHelpers::RungeKutta
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/History.hpp"
@@ -365,6 +366,14 @@ void check_dense_output(
           // Make sure the initial value is preserved.
           y = 2.0 * *history.complete_step_start().value;
           if (stepper.dense_update_u(make_not_null(&y), history, time)) {
+            // Batched dense output must agree with the single-time
+            // result.
+            const double initial = 2.0 * *history.complete_step_start().value;
+            std::vector<double> batched(2);
+            CHECK(stepper.dense_update_u(make_not_null(&batched), initial,
+                                         history, {time, time}));
+            CHECK(batched[0] == approx(y));
+            CHECK(batched[1] == approx(y));
             return y - *history.complete_step_start().value;
           }
           REQUIRE(not before(time, time_id.step_time().value()));
@@ -0,0 +1,135 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <variant>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif  // _OPENMP
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Creators/Rectangle.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "IO/Exporter/TransformVolumeData.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+namespace spectre::Exporter {
+
+SPECTRE_TEST_CASE("Unit.IO.Exporter.TransformVolumeData", "[Unit]") {
+#ifdef _OPENMP
+  // Disable OpenMP multithreading since multiple unit tests may run in parallel
+  omp_set_num_threads(1);
+#endif
+  CHECK(registered_transform_kernels() ==
+        std::vector<std::string>{"DetJacobian", "InertialCoordinates",
+                                 "PartialDerivatives", "PointwiseL2Norm"});
+
+  // Two elements that cover [-1, 0] x [-1, 1] and [0, 1] x [-1, 1]
+  const domain::creators::Rectangle domain_creator{
+      {{-1., -1.}}, {{1., 1.}}, {{1, 0}}, {{4, 4}}, {{false, false}}};
+  const auto domain = domain_creator.create_domain();
+  const Mesh<2> mesh{4, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto xi = logical_coordinates(mesh);
+  const std::array<ElementId<2>, 2> element_ids{
+      {ElementId<2>{0, {{SegmentId{1, 0}, SegmentId{0, 0}}}},
+       ElementId<2>{0, {{SegmentId{1, 1}, SegmentId{0, 0}}}}}};
+  const std::array<DataVector, 2> x{
+      {-0.5 + 0.5 * get<0>(xi), 0.5 + 0.5 * get<0>(xi)}};
+  const DataVector& y = get<1>(xi);
+  const size_t num_points = mesh.number_of_grid_points();
+  // The data of both elements, stored contiguously
+  DataVector expected_x(2 * num_points);
+  DataVector expected_y(2 * num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    expected_x[i] = x[0][i];
+    expected_x[num_points + i] = x[1][i];
+    expected_y[i] = y[i];
+    expected_y[num_points + i] = y[i];
+  }
+  // Manufacture linear data so derivatives are exact
+  std::vector<ElementVolumeData> element_data{};
+  for (size_t i = 0; i < 2; ++i) {
+    const DataVector psi = 1.0 + gsl::at(x, i) + 2. * y;
+    element_data.push_back(ElementVolumeData{
+        gsl::at(element_ids, i), {TensorComponent{"Psi", psi}}, mesh});
+  }
+  const std::string h5_file_name{"Unit.IO.Exporter.TransformVolumeData.h5"};
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  {  // scope to open and close file
+    h5::H5File<h5::AccessType::ReadWrite> h5_file(h5_file_name);
+    auto& volfile = h5_file.insert<h5::VolumeData>("/VolumeData", 0);
+    volfile.write_volume_data(123, 0., element_data, serialize(domain));
+    volfile.write_volume_data(456, 1., element_data, serialize(domain));
+  }
+
+  const auto output_components = transform_volume_data(
+      h5_file_name, "/VolumeData",
+      {TransformKernel{"PartialDerivatives", {"Psi"}},
+       TransformKernel{"PointwiseL2Norm", {"Psi", "Psi"}, "PsiNorm"},
+       TransformKernel{"InertialCoordinates"},
+       TransformKernel{"DetJacobian"}});
+  CHECK(output_components ==
+        std::vector<std::string>{"DerivPsi_x", "DerivPsi_y", "PsiNorm",
+                                 "InertialCoordinates_x",
+                                 "InertialCoordinates_y", "DetJacobian"});
+
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> h5_file(h5_file_name);
+    const auto& volfile = h5_file.get<h5::VolumeData>("/VolumeData");
+    for (const size_t obs_id : {123_st, 456_st}) {
+      const auto get_component = [&volfile,
+                                  &obs_id](const std::string& name) {
+        return std::get<DataVector>(
+            volfile.get_tensor_component(obs_id, name).data);
+      };
+      const DataVector expected_psi = 1.0 + expected_x + 2. * expected_y;
+      CHECK_ITERABLE_APPROX(get_component("DerivPsi_x"),
+                            DataVector(2 * num_points, 1.));
+      CHECK_ITERABLE_APPROX(get_component("DerivPsi_y"),
+                            DataVector(2 * num_points, 2.));
+      CHECK_ITERABLE_APPROX(get_component("PsiNorm"),
+                            DataVector{sqrt(2.) * abs(expected_psi)});
+      CHECK_ITERABLE_APPROX(get_component("InertialCoordinates_x"),
+                            expected_x);
+      CHECK_ITERABLE_APPROX(get_component("InertialCoordinates_y"),
+                            expected_y);
+      CHECK_ITERABLE_APPROX(get_component("DetJacobian"),
+                            DataVector(2 * num_points, 0.5));
+    }
+  }
+
+  // Applying the kernels again overwrites the data if requested
+  CHECK(transform_volume_data(
+            std::vector<std::string>{h5_file_name}, "/VolumeData",
+            {TransformKernel{"DetJacobian", {}, "PsiNorm"}}, true) ==
+        std::vector<std::string>{"PsiNorm"});
+  {
+    const h5::H5File<h5::AccessType::ReadOnly> h5_file(h5_file_name);
+    const auto& volfile = h5_file.get<h5::VolumeData>("/VolumeData");
+    CHECK_ITERABLE_APPROX(
+        std::get<DataVector>(volfile.get_tensor_component(123, "PsiNorm").data),
+        DataVector(2 * num_points, 0.5));
+  }
+
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+}  // namespace spectre::Exporter
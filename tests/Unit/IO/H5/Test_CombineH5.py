@@ -235,6 +235,82 @@ class TestCombineH5(unittest.TestCase):
             )
             self.assertEqual(value, True)
 
+    def test_combine_h5_virtual(self):
+        # Combining with virtual datasets or with multiple threads must give
+        # the same volume data as the serial copy
+        combine_h5(self.file_names, self.subfile_name, self.output_file, False)
+        virtual_output_file = self.output_file.replace(".h5", "Virtual.h5")
+        threaded_output_file = self.output_file.replace(".h5", "Threaded.h5")
+        for output_file in [virtual_output_file, threaded_output_file]:
+            if os.path.isfile(output_file):
+                os.remove(output_file)
+        combine_h5(
+            self.file_names,
+            self.subfile_name,
+            virtual_output_file,
+            False,
+            use_virtual_datasets=True,
+        )
+        combine_h5(
+            self.file_names,
+            self.subfile_name,
+            threaded_output_file,
+            False,
+            number_of_threads=2,
+        )
+
+        with spectre_h5.H5File(file_name=self.output_file, mode="r") as f:
+            expected_vol = f.get_vol(self.subfile_name)
+            expected_obs_ids = expected_vol.list_observation_ids()
+            expected_data = expected_vol.get_data_by_element(None, None)
+            expected_connectivity = expected_vol.get_tensor_component(
+                self.observation_ids[0], "connectivity"
+            ).data
+        for output_file in [virtual_output_file, threaded_output_file]:
+            with spectre_h5.H5File(file_name=output_file, mode="r") as f:
+                output_vol = f.get_vol(self.subfile_name)
+                self.assertEqual(
+                    output_vol.list_observation_ids(), expected_obs_ids
+                )
+                np.testing.assert_array_equal(
+                    np.asarray(
+                        output_vol.get_tensor_component(
+                            self.observation_ids[0], "connectivity"
+                        ).data
+                    ),
+                    np.asarray(expected_connectivity),
+                )
+                output_data = output_vol.get_data_by_element(None, None)
+                for (obs_id, obs_value, elements), (
+                    expected_obs_id,
+                    expected_obs_value,
+                    expected_elements,
+                ) in zip(output_data, expected_data):
+                    self.assertEqual(obs_id, expected_obs_id)
+                    self.assertEqual(obs_value, expected_obs_value)
+                    self.assertEqual(
+                        [element.element_name for element in elements],
+                        [element.element_name for element in expected_elements],
+                    )
+                    for element, expected_element in zip(
+                        elements, expected_elements
+                    ):
+                        self.assertEqual(
+                            element.extents, expected_element.extents
+                        )
+                        for component, expected_component in zip(
+                            element.tensor_components,
+                            expected_element.tensor_components,
+                        ):
+                            self.assertEqual(
+                                component.name, expected_component.name
+                            )
+                            np.testing.assert_array_equal(
+                                np.asarray(component.data),
+                                np.asarray(expected_component.data),
+                            )
+            os.remove(output_file)
+
     def test_cli(self):
         # Checks if the CLI for CombineH5 runs properly
         runner = CliRunner()
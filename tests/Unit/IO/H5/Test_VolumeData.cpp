@@ -344,8 +344,10 @@ void test() {
 template <size_t SpatialDim>
 void test_extend_connectivity_data() {
   // Sample volume data
-  const std::vector<size_t>& observation_ids{2345};
-  const std::vector<double>& observation_values{1.0};
+  // Both observations have the same element layout, so they share the
+  // connectivity
+  const std::vector<size_t>& observation_ids{2345, 6789};
+  const std::vector<double>& observation_values{1.0, 2.0};
 
   // Sample data with h-ref 1 & p-ref 2 for each SpatialDim
   // Used for both number_of_elements and number_of_gridpoints
@@ -491,6 +493,8 @@ void test_extend_connectivity_data() {
 
   volume_file.write_volume_data(observation_ids[0], observation_values[0],
                                 element_data);
+  volume_file.write_volume_data(observation_ids[1], observation_values[1],
+                                element_data);
   volume_file.extend_connectivity_data<SpatialDim>(observation_ids);
 
   h5_file.close_current_object();
@@ -531,6 +535,8 @@ void test_extend_connectivity_data() {
   const auto h5_connectivity =
       volume_data.get_tensor_component(2345, "connectivity").data;
   const auto connectivity_data = get<0>(h5_connectivity);
+  CHECK(get<0>(volume_data.get_tensor_component(6789, "connectivity").data) ==
+        connectivity_data);
 
   // Store file connectivity in vector like expected_connectivity
   std::vector<size_t> file_connectivity(expected_connectivity.size(), 0);
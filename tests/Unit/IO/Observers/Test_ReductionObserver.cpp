@@ -5,9 +5,12 @@
 
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -61,13 +64,15 @@ struct FormatErrors
 static_assert(tt::assert_conforms_to_v<
               FormatErrors, observers::protocols::ReductionDataFormatter>);
 
+template <bool CombineObserverReductions>
 void test_reduction_observer(const bool observe_per_core) {
   using registration_list = tmpl::list<
       observers::Actions::RegisterWithObservers<
           helpers::RegisterObservers<observers::TypeOfObservation::Reduction>>,
       Parallel::Actions::TerminatePhase>;
 
-  using metavariables = helpers::Metavariables<registration_list>;
+  using metavariables =
+      helpers::Metavariables<registration_list, CombineObserverReductions>;
   using obs_component = helpers::observer_component<metavariables>;
   using obs_writer = helpers::observer_writer_component<metavariables>;
   using element_comp =
@@ -257,10 +262,23 @@ void test_reduction_observer(const bool observe_per_core) {
         runner.invoke_queued_threaded_action<obs_writer>(node_id);
       }
     }
+    REQUIRE(
+        ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 1));
+    if constexpr (CombineObserverReductions) {
+      // No other reduction at this time is in progress on node 1, so it sent
+      // its data to node 0 right away in a 'WriteCombinedReductionData'.
+      // Invoke the threaded actions 'WriteReductionData' for the data from
+      // node 0 and 'WriteCombinedReductionData' for the data from node 1,
+      // which queues another 'WriteReductionData'
+      runner.invoke_queued_threaded_action<obs_writer>(0);
+      runner.invoke_queued_threaded_action<obs_writer>(0);
+    }
     // Invoke the threaded action 'WriteReductionData' to write reduction data
     // to disk.
     runner.invoke_queued_threaded_action<obs_writer>(0);
-    runner.invoke_queued_threaded_action<obs_writer>(0);
+    if constexpr (not CombineObserverReductions) {
+      runner.invoke_queued_threaded_action<obs_writer>(0);
+    }
     REQUIRE(
         ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 0));
 
@@ -382,11 +400,82 @@ void test_reduction_observer(const bool observe_per_core) {
       file_system::rm(output_file_prefix + "1.h5", true);
     }
   });
+
+  if constexpr (CombineObserverReductions) {
+    // Collect two reductions at the same time on node 1. Their data is sent to
+    // node 0 in one message once both are complete.
+    const observers::ObservationKey key{"ElementObservationType"};
+    const observers::ObservationKey other_key{"OtherObservationType"};
+    auto& writer_box_on_node_1 =
+        ActionTesting::get_databox<obs_writer>(make_not_null(&runner), 1);
+    db::mutate<observers::Tags::ExpectedContributorsForObservations>(
+        [&key, &other_key](const gsl::not_null<std::unordered_map<
+                               observers::ObservationKey,
+                               std::unordered_set<Parallel::ArrayComponentId>>*>
+                               expected_contributors) {
+          (*expected_contributors)[other_key] = expected_contributors->at(key);
+        },
+        make_not_null(&writer_box_on_node_1));
+    const auto& contributors_on_node_1 =
+        db::get<observers::Tags::ExpectedContributorsForObservations>(
+            writer_box_on_node_1)
+            .at(key);
+    REQUIRE(contributors_on_node_1.size() == 2);
+    const Parallel::ArrayComponentId first_contributor =
+        *contributors_on_node_1.begin();
+    const Parallel::ArrayComponentId second_contributor =
+        *std::next(contributors_on_node_1.begin());
+    const std::vector<std::string> legend{"Time", "NumberOfPoints", "Error0",
+                                          "Error1"};
+    const auto collect = [&legend, &runner](
+                             const observers::ObservationId& observation_id,
+                             const Parallel::ArrayComponentId& contributor) {
+      ActionTesting::threaded_action<
+          obs_writer, observers::ThreadedActions::CollectReductionDataOnNode>(
+          make_not_null(&runner), 1, observation_id, contributor,
+          std::string{"/element_data"}, std::vector<std::string>{legend},
+          helpers::reduction_data_from_doubles{observation_id.value(), 4, 1.0,
+                                               2.0});
+    };
+    const auto number_of_messages_to_node_0 = [&runner]() {
+      return ActionTesting::number_of_queued_threaded_actions<obs_writer>(
+          runner, 0);
+    };
+
+    // The writes on node 0 are not invoked, since node 0 doesn't contribute
+    // to these reductions. Only the messages node 1 sends are checked.
+    const double time = 5.0;
+    collect(observers::ObservationId{time, other_key}, first_contributor);
+    collect(observers::ObservationId{time, key}, first_contributor);
+    collect(observers::ObservationId{time, key}, second_contributor);
+    // The reduction of `key` is complete, but held back for `other_key`
+    CHECK(number_of_messages_to_node_0() == 0);
+    collect(observers::ObservationId{time, other_key}, second_contributor);
+    REQUIRE(number_of_messages_to_node_0() == 1);
+    // Invoke 'WriteCombinedReductionData', which forwards both entries to
+    // 'WriteReductionData'
+    runner.invoke_queued_threaded_action<obs_writer>(0);
+    CHECK(number_of_messages_to_node_0() == 2);
+
+    // Data held back for a reduction that doesn't complete is sent once
+    // reduction data for another time arrives on the node
+    const double held_time = 6.0;
+    const double next_time = 7.0;
+    collect(observers::ObservationId{held_time, other_key}, first_contributor);
+    collect(observers::ObservationId{held_time, key}, first_contributor);
+    collect(observers::ObservationId{held_time, key}, second_contributor);
+    CHECK(number_of_messages_to_node_0() == 2);
+    collect(observers::ObservationId{next_time, key}, first_contributor);
+    CHECK(number_of_messages_to_node_0() == 3);
+    CHECK(ActionTesting::is_threaded_action_queue_empty<obs_writer>(runner, 1));
+  }
 }
 }  // namespace
 
 // [[TimeOut, 10]]
 SPECTRE_TEST_CASE("Unit.IO.Observers.ReductionObserver", "[Unit][Observers]") {
-  test_reduction_observer(false);
-  test_reduction_observer(true);
+  test_reduction_observer<false>(false);
+  test_reduction_observer<false>(true);
+  test_reduction_observer<true>(false);
+  test_reduction_observer<true>(true);
 }
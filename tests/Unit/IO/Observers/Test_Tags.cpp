@@ -25,6 +25,7 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<NodesExpectedToContributeReductions>(
       "NodesExpectedToContributeReductions");
   TestHelpers::db::test_simple_tag<ReductionDataLock>("ReductionDataLock");
+  TestHelpers::db::test_simple_tag<ReductionDataToSend>("ReductionDataToSend");
   TestHelpers::db::test_simple_tag<ContributorsOfTensorData>(
       "ContributorsOfTensorData");
   TestHelpers::db::test_simple_tag<VolumeDataLock>("VolumeDataLock");
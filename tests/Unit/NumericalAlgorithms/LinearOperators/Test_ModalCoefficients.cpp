@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Tags.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
+#include "NumericalAlgorithms/LinearOperators/ModalCoefficients.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <size_t Dim>
+struct Var : db::SimpleTag {
+  using type = tnsr::I<DataVector, Dim>;
+};
+
+template <size_t Dim>
+void test_modal_coefficients(const Spectral::Quadrature quadrature) {
+  CAPTURE(Dim);
+  CAPTURE(quadrature);
+  const Mesh<Dim> mesh{4, Spectral::Basis::Legendre, quadrature};
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, Dim> nodal_data{};
+  for (size_t d = 0; d < Dim; ++d) {
+    nodal_data.get(d) =
+        square(logical_coords.get(d)) + static_cast<double>(d) + 1.;
+  }
+
+  tnsr::I<ModalVector, Dim> expected{};
+  for (size_t d = 0; d < Dim; ++d) {
+    expected.get(d) = to_modal_coefficients(nodal_data.get(d), mesh);
+  }
+  tnsr::I<ModalVector, Dim> modal_data{};
+  to_modal_coefficients(make_not_null(&modal_data), nodal_data, mesh);
+  CHECK_ITERABLE_APPROX(modal_data, expected);
+
+  using compute_tag = Tags::ModalCoefficientsCompute<Var<Dim>, Dim>;
+  auto box = db::create<
+      db::AddSimpleTags<domain::Tags::Mesh<Dim>, Var<Dim>>,
+      db::AddComputeTags<compute_tag>>(mesh, nodal_data);
+  CHECK_ITERABLE_APPROX(db::get<Tags::ModalCoefficients<Var<Dim>>>(box),
+                        expected);
+
+  // The modal coefficients are recomputed when the nodal data changes
+  db::mutate<Var<Dim>>(
+      [](const gsl::not_null<tnsr::I<DataVector, Dim>*> var) {
+        for (auto& component : *var) {
+          component *= 2.;
+        }
+      },
+      make_not_null(&box));
+  for (auto& component : expected) {
+    component *= 2.;
+  }
+  CHECK_ITERABLE_APPROX(db::get<Tags::ModalCoefficients<Var<Dim>>>(box),
+                        expected);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.ModalCoefficients",
+                  "[NumericalAlgorithms][LinearOperators][Unit]") {
+  TestHelpers::db::test_prefix_tag<Tags::ModalCoefficients<Var<1>>>(
+      "ModalCoefficients(Var)");
+  TestHelpers::db::test_compute_tag<Tags::ModalCoefficientsCompute<Var<1>, 1>>(
+      "ModalCoefficients(Var)");
+  for (const auto quadrature :
+       {Spectral::Quadrature::GaussLobatto, Spectral::Quadrature::Gauss}) {
+    test_modal_coefficients<1>(quadrature);
+    test_modal_coefficients<2>(quadrature);
+    test_modal_coefficients<3>(quadrature);
+  }
+}
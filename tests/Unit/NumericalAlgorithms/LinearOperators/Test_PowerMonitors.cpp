@@ -11,8 +11,10 @@
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Framework/TestCreation.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
@@ -20,6 +22,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 
@@ -47,6 +50,13 @@ void test_power_monitors_impl() {
                                                           check_data_vector};
 
   CHECK_ITERABLE_APPROX(test_power_monitors, expected_power_monitors);
+
+  // Power monitors computed from precomputed modal coefficients
+  std::array<DataVector, 2> power_monitors_from_modes{};
+  PowerMonitors::power_monitors(make_not_null(&power_monitors_from_modes),
+                                to_modal_coefficients(test_data_vector, mesh),
+                                mesh);
+  CHECK_ITERABLE_APPROX(power_monitors_from_modes, expected_power_monitors);
 }
 
 void test_power_monitors_second_impl() {
@@ -6,6 +6,8 @@
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/DynamicVector.h>
 #include <functional>
+#include <optional>
+#include <string>
 #include <utility>
 
 #include "DataStructures/ApplyMatrices.hpp"
@@ -20,6 +22,7 @@
 #include "NumericalAlgorithms/LinearSolver/ExplicitInverse.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/ElementCenteredSubdomainData.hpp"
 #include "ParallelAlgorithms/LinearSolver/Schwarz/OverlapHelpers.hpp"
+#include "Utilities/FileSystem.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -74,6 +77,35 @@ SPECTRE_TEST_CASE("Unit.LinearSolver.Serial.ExplicitInverse",
       CHECK_ITERABLE_APPROX(solver.matrix_representation(), blaze::inv(matrix));
       CHECK_ITERABLE_APPROX(solution, expected_solution);
     }
+    {
+      INFO("Caching");
+      const std::string cache_directory = "ExplicitInverseCache";
+      if (file_system::check_if_dir_exists(cache_directory)) {
+        file_system::rm(cache_directory, true);
+      }
+      const ExplicitInverse<> caching_solver{std::nullopt, cache_directory};
+      caching_solver.solve(make_not_null(&solution), linear_operator, source);
+      CHECK_ITERABLE_APPROX(solution, expected_solution);
+      REQUIRE(file_system::ls(cache_directory).size() == 1);
+      // A solver for the same operator reuses the cached inverse
+      const auto cached_solver =
+          serialize_and_deserialize(ExplicitInverse<>{std::nullopt,
+                                                      cache_directory});
+      solution = 0.;
+      cached_solver.solve(make_not_null(&solution), linear_operator, source);
+      CHECK(cached_solver.matrix_representation() ==
+            caching_solver.matrix_representation());
+      CHECK_ITERABLE_APPROX(solution, expected_solution);
+      // A different operator is not found in the cache
+      const blaze::DynamicMatrix<double> matrix2{{4., 1.}, {1., 3.}};
+      const helpers::ApplyMatrix linear_operator2{matrix2};
+      const ExplicitInverse<> other_solver{std::nullopt, cache_directory};
+      other_solver.solve(make_not_null(&solution), linear_operator2, source);
+      CHECK_ITERABLE_APPROX(other_solver.matrix_representation(),
+                            blaze::inv(matrix2));
+      CHECK(file_system::ls(cache_directory).size() == 2);
+      file_system::rm(cache_directory, true);
+    }
   }
   {
     INFO("Solve a heterogeneous data structure");
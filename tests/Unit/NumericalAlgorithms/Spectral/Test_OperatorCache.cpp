@@ -0,0 +1,121 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+#include "DataStructures/Matrix.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/OperatorCache.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/GetOutput.hpp"
+
+namespace Spectral {
+namespace {
+void test_key() {
+  const Mesh<1> mesh{3, Basis::Legendre, Quadrature::Gauss};
+  const Mesh<1> other_mesh{4, Basis::Legendre, Quadrature::GaussLobatto};
+  const OperatorCacheKey key{"Operator", mesh, other_mesh, 1};
+  CHECK(key == OperatorCacheKey{"Operator", mesh, other_mesh, 1});
+  CHECK(std::hash<OperatorCacheKey>{}(key) ==
+        std::hash<OperatorCacheKey>{}(
+            OperatorCacheKey{"Operator", mesh, other_mesh, 1}));
+  CHECK(key != OperatorCacheKey{"OtherOperator", mesh, other_mesh, 1});
+  CHECK(key != OperatorCacheKey{"Operator", other_mesh, other_mesh, 1});
+  CHECK(key != OperatorCacheKey{"Operator", mesh, mesh, 1});
+  CHECK(key != OperatorCacheKey{"Operator", mesh, other_mesh, 2});
+}
+
+void test_cached_operator() {
+  const Mesh<1> mesh{5, Basis::Chebyshev, Quadrature::GaussLobatto};
+  const OperatorCacheKey key{"Test.OperatorCache", mesh, mesh, 2};
+  const auto statistics_before = operator_cache_statistics();
+
+  size_t num_calls = 0;
+  const auto generator = [&num_calls]() {
+    ++num_calls;
+    return Matrix(5, 3, 2.);
+  };
+  const Matrix& matrix = cached_operator(key, generator);
+  CHECK(num_calls == 1);
+  CHECK(matrix == Matrix(5, 3, 2.));
+  const auto statistics_after_miss = operator_cache_statistics();
+  CHECK(statistics_after_miss.misses == statistics_before.misses + 1);
+  CHECK(statistics_after_miss.hits == statistics_before.hits);
+  CHECK(statistics_after_miss.entries == statistics_before.entries + 1);
+  CHECK(statistics_after_miss.memory_footprint_in_bytes >=
+        statistics_before.memory_footprint_in_bytes + 15 * sizeof(double));
+
+  // The matrix is retrieved from the registry, not computed again
+  const Matrix& same_matrix = cached_operator(key, generator);
+  CHECK(num_calls == 1);
+  CHECK(&same_matrix == &matrix);
+  const auto statistics_after_hit = operator_cache_statistics();
+  CHECK(statistics_after_hit.misses == statistics_after_miss.misses);
+  CHECK(statistics_after_hit.hits == statistics_after_miss.hits + 1);
+  CHECK(statistics_after_hit.entries == statistics_after_miss.entries);
+  CHECK(statistics_after_hit.memory_footprint_in_bytes ==
+        statistics_after_miss.memory_footprint_in_bytes);
+
+  // A different key computes a new matrix
+  const Matrix& other_matrix = cached_operator(
+      OperatorCacheKey{"Test.OperatorCache", mesh, mesh, 3}, generator);
+  CHECK(num_calls == 2);
+  CHECK(&other_matrix != &matrix);
+  CHECK(operator_cache_statistics().entries ==
+        statistics_after_hit.entries + 1);
+
+  CHECK(get_output(OperatorCacheStatistics{1, 2, 3, 4}) ==
+        "Hits: 1, Misses: 2, Entries: 3, Memory: 4 bytes");
+}
+
+void test_projection_matrices_are_cached() {
+  const Mesh<1> parent_mesh{3, Basis::Legendre, Quadrature::GaussLobatto};
+  const Mesh<1> child_mesh{4, Basis::Legendre, Quadrature::Gauss};
+  const Matrix& prolongation = projection_matrix_parent_to_child(
+      parent_mesh, child_mesh, ChildSize::UpperHalf);
+  const auto statistics = operator_cache_statistics();
+  CHECK(&projection_matrix_parent_to_child(parent_mesh, child_mesh,
+                                           ChildSize::UpperHalf) ==
+        &prolongation);
+  CHECK(operator_cache_statistics().hits == statistics.hits + 1);
+  CHECK(operator_cache_statistics().entries == statistics.entries);
+}
+
+void test_lookup_from_other_thread() {
+  const Mesh<1> mesh{4, Basis::Chebyshev, Quadrature::GaussLobatto};
+  const OperatorCacheKey key{"Test.OperatorCache", mesh, mesh, 4};
+  size_t num_calls = 0;
+  const auto generator = [&num_calls]() {
+    ++num_calls;
+    return Matrix(4, 4, 1.);
+  };
+  const Matrix& matrix = cached_operator(key, generator);
+  const auto statistics = operator_cache_statistics();
+  // The other thread retrieves the matrix from the registry, and its usage
+  // counts are retained after it exits
+  const Matrix* matrix_on_other_thread = nullptr;
+  std::thread other_thread{[&key, &generator, &matrix_on_other_thread]() {
+    matrix_on_other_thread = &cached_operator(key, generator);
+  }};
+  other_thread.join();
+  CHECK(num_calls == 1);
+  CHECK(matrix_on_other_thread == &matrix);
+  CHECK(operator_cache_statistics().hits == statistics.hits + 1);
+  CHECK(operator_cache_statistics().misses == statistics.misses);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Numerical.Spectral.OperatorCache",
+                  "[NumericalAlgorithms][Spectral][Unit]") {
+  test_key();
+  test_cached_operator();
+  test_projection_matrices_are_cached();
+  test_lookup_from_other_thread();
+}
+}  // namespace Spectral
@@ -6,9 +6,16 @@
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 
 namespace Parallel {
+namespace {
+struct NodegroupWithElementCollection {
+  using element_collection_tag = int;
+};
+}  // namespace
+
 SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.IsDgElementCollection",
                   "[Unit][Parallel]") {
   CHECK(is_dg_element_collection_v<DgElementCollection<3, void, void>>);
+  CHECK(is_dg_element_collection_v<NodegroupWithElementCollection>);
   CHECK_FALSE(is_dg_element_collection_v<int>);
 }
 }  // namespace Parallel
@@ -0,0 +1,55 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Parallel/Printf/MessageBuffer.hpp"
+
+namespace {
+std::vector<char> make_message(const std::string& text) {
+  return {text.c_str(), text.c_str() + text.size() + 1};
+}
+
+std::string to_string(const std::optional<std::vector<char>>& messages) {
+  REQUIRE(messages.has_value());
+  REQUIRE(not messages->empty());
+  CHECK(messages->back() == '\0');
+  return std::string{messages->data()};
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.printf.MessageBuffer", "[Unit][Parallel]") {
+  {
+    INFO("Flush when the buffer is full");
+    Parallel::detail::MessageBuffer buffer{8, std::chrono::hours{1}};
+    CHECK_FALSE(buffer.flush().has_value());
+    CHECK_FALSE(buffer.append(make_message("abc\n")).has_value());
+    CHECK_FALSE(buffer.append(make_message("def\n")).has_value());
+    CHECK(to_string(buffer.append(make_message("g\n"))) == "abc\ndef\ng\n");
+    CHECK_FALSE(buffer.flush().has_value());
+  }
+  {
+    INFO("Flush explicitly");
+    Parallel::detail::MessageBuffer buffer{1000, std::chrono::hours{1}};
+    CHECK_FALSE(buffer.append(make_message("abc\n")).has_value());
+    CHECK_FALSE(buffer.append(make_message("def\n")).has_value());
+    CHECK(to_string(buffer.flush()) == "abc\ndef\n");
+    CHECK_FALSE(buffer.flush().has_value());
+    CHECK_FALSE(buffer.append(make_message("ghi\n")).has_value());
+    CHECK(to_string(buffer.flush()) == "ghi\n");
+  }
+  {
+    INFO("Flush when the oldest message is too old");
+    Parallel::detail::MessageBuffer buffer{1000, std::chrono::hours{0}};
+    CHECK_FALSE(buffer.append(make_message("abc\n")).has_value());
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() == start) {
+    }
+    CHECK(to_string(buffer.append(make_message("def\n"))) == "abc\ndef\n");
+  }
+}
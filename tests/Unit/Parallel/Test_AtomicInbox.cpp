@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <utility>
+
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/AtomicInbox.hpp"
+#include "Parallel/InboxInserters.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+struct AtomicTag : Parallel::InboxInserters::Map<AtomicTag> {
+  using temporal_id = size_t;
+  using type = Parallel::AtomicInbox<AtomicTag,
+                                     std::map<temporal_id, std::map<int, int>>,
+                                     std::pair<int, int>, 2>;
+};
+
+struct LockedTag : Parallel::InboxInserters::Map<LockedTag> {
+  using temporal_id = size_t;
+  using type = std::map<temporal_id, std::map<int, int>>;
+};
+
+static_assert(Parallel::is_atomic_inbox_v<AtomicTag::type>);
+static_assert(not Parallel::is_atomic_inbox_v<LockedTag::type>);
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.AtomicInbox", "[Unit][Parallel]") {
+  tuples::TaggedTuple<AtomicTag, LockedTag> inboxes{};
+  auto& inbox = tuples::get<AtomicTag>(inboxes);
+
+  // An inbox that was never inserted into has not allocated its queue
+  CHECK_FALSE(inbox.has_uncollected_messages());
+  inbox.collect();
+  CHECK(inbox.empty());
+
+  // Queued data only becomes visible once collected
+  inbox.insert(1, std::make_pair(10, 100));
+  inbox.insert(2, std::make_pair(20, 200));
+  CHECK(inbox.empty());
+  CHECK(inbox.has_uncollected_messages());
+  // The queue is full, so this goes into the locked overflow buffer
+  inbox.insert(2, std::make_pair(21, 210));
+  CHECK(inbox.empty());
+  LockedTag::insert_into_inbox(
+      make_not_null(&tuples::get<LockedTag>(inboxes)), 1_st,
+      std::make_pair(10, 100));
+
+  Parallel::collect_atomic_inboxes(make_not_null(&inboxes));
+  CHECK_FALSE(inbox.has_uncollected_messages());
+  CHECK(inbox ==
+        std::map<size_t, std::map<int, int>>{{1, {{10, 100}}},
+                                             {2, {{20, 200}, {21, 210}}}});
+  CHECK(tuples::get<LockedTag>(inboxes) ==
+        std::map<size_t, std::map<int, int>>{{1, {{10, 100}}}});
+
+  // Data inserted directly bypasses the queue
+  AtomicTag::insert_into_inbox(make_not_null(&inbox), 1_st,
+                               std::make_pair(11, 110));
+  CHECK_FALSE(inbox.has_uncollected_messages());
+  CHECK(inbox.at(1) == std::map<int, int>{{10, 100}, {11, 110}});
+
+  // The queue can be reused after collecting
+  inbox.insert(3, std::make_pair(30, 300));
+  inbox.collect();
+  CHECK(inbox.at(3) == std::map<int, int>{{30, 300}});
+  inbox.erase(1);
+
+  const AtomicTag::type moved{std::move(inbox)};
+  CHECK(moved ==
+        std::map<size_t, std::map<int, int>>{{2, {{20, 200}, {21, 210}}},
+                                             {3, {{30, 300}}}});
+  const auto deserialized = serialize_and_deserialize(moved);
+  CHECK(deserialized == moved);
+}
@@ -0,0 +1,124 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Parallel/StaticMpscQueue.hpp"
+
+namespace {
+// Several producers push concurrently into a small queue while the consumer
+// drains it, so the producers contend for slots and wrap around the storage
+// many times. Every element must arrive exactly once and the elements of each
+// producer must arrive in the order they were pushed.
+void test_concurrent_producers() {
+  constexpr size_t number_of_producers = 4;
+  constexpr size_t elements_per_producer = 10000;
+  Parallel::StaticMpscQueue<size_t, 8> queue{};
+
+  std::vector<std::thread> producers{};
+  producers.reserve(number_of_producers);
+  for (size_t producer = 0; producer < number_of_producers; ++producer) {
+    producers.emplace_back([&queue, producer]() {
+      for (size_t i = 0; i < elements_per_producer; ++i) {
+        while (not queue.try_push(producer * elements_per_producer + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::array<size_t, number_of_producers> next_expected{};
+  size_t number_received = 0;
+  bool in_order = true;
+  while (number_received < number_of_producers * elements_per_producer) {
+    const size_t* const front = queue.front();
+    if (front == nullptr) {
+      std::this_thread::yield();
+      continue;
+    }
+    const size_t producer = *front / elements_per_producer;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    size_t& expected = next_expected[producer];
+    in_order = in_order and *front % elements_per_producer == expected;
+    ++expected;
+    queue.pop();
+    ++number_received;
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  CHECK(in_order);
+  CHECK(queue.empty());
+  for (const size_t count : next_expected) {
+    CHECK(count == elements_per_producer);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.StaticMpscQueue", "[Unit][Parallel]") {
+  test_concurrent_producers();
+
+  Parallel::StaticMpscQueue<int, 3> queue{};
+  CHECK(queue.empty());
+  CHECK(queue.size() == 0);  // NOLINT
+  CHECK(queue.capacity() == 3);
+  CHECK(queue.front() == nullptr);
+
+  CHECK(queue.try_emplace(3));
+  CHECK_FALSE(queue.empty());
+  CHECK(queue.size() == 1);
+  const int a = 5;
+  CHECK(queue.try_push(a));
+  CHECK(queue.try_push(7));
+  CHECK(queue.size() == 3);
+  CHECK_FALSE(queue.try_push(9));
+  CHECK_FALSE(queue.try_emplace(11));
+  CHECK(queue.size() == 3);
+
+  int* front = queue.front();
+  REQUIRE(front != nullptr);
+  CHECK(*front == 3);
+  queue.pop();
+  CHECK(queue.size() == 2);
+
+  // Wrap around the end of the storage
+  CHECK(queue.try_push(13));
+  CHECK_FALSE(queue.try_push(15));
+  for (const int expected : {5, 7, 13}) {
+    front = queue.front();
+    REQUIRE(front != nullptr);
+    CHECK(*front == expected);
+    queue.pop();
+  }
+  CHECK(queue.empty());
+  CHECK(queue.front() == nullptr);
+  CHECK(queue.try_push(17));
+  CHECK(*queue.front() == 17);
+  queue.pop();
+  CHECK(queue.empty());
+
+  // Elements left in the queue are destroyed with it
+  {
+    const auto counter = std::make_shared<int>(0);
+    {
+      Parallel::StaticMpscQueue<std::shared_ptr<int>, 4> pointer_queue{};
+      CHECK(pointer_queue.try_push(counter));
+      CHECK(pointer_queue.try_push(counter));
+      CHECK(counter.use_count() == 3);
+    }
+    CHECK(counter.use_count() == 1);
+  }
+
+#ifdef SPECTRE_DEBUG
+  CHECK_THROWS_WITH(queue.pop(),
+                    Catch::Matchers::ContainsSubstring(
+                        "Can't pop an element from an empty queue."));
+#endif  // SPECTRE_DEBUG
+}
@@ -0,0 +1,419 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Info.hpp"
+#include "Domain/Amr/Tags/Flags.hpp"
+#include "Domain/Amr/Tags/NeighborFlags.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/Neighbors.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
+#include "Parallel/ArrayCollection/UpdateElementLocations.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Amr/Actions/AdjustDomainOnNode.hpp"
+#include "ParallelAlgorithms/Amr/Projectors/DefaultInitialize.hpp"
+#include "ParallelAlgorithms/Amr/Protocols/AmrMetavariables.hpp"
+#include "ParallelAlgorithms/Amr/Tags.hpp"
+#include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+using verbosity_tag = logging::Tags::Verbosity<amr::OptionTags::AmrGroup>;
+
+// Provides the interface of a Parallel::DgElementArrayMember that is used by
+// amr::Actions::AdjustDomainOnNode
+template <typename Metavariables>
+class MockElement {
+ public:
+  static constexpr size_t volume_dim = Metavariables::volume_dim;
+  using databox_type = db::compute_databox_type<
+      tmpl::list<domain::Tags::Element<volume_dim>,
+                 domain::Tags::Mesh<volume_dim>,
+                 domain::Tags::NeighborMesh<volume_dim>,
+                 amr::Tags::Info<volume_dim>,
+                 amr::Tags::NeighborInfo<volume_dim>, verbosity_tag>>;
+
+  MockElement() = default;
+
+  MockElement(Element<volume_dim> element, Mesh<volume_dim> mesh,
+              amr::Info<volume_dim> info,
+              std::unordered_map<ElementId<volume_dim>, amr::Info<volume_dim>>
+                  neighbor_info)
+      : terminate_(false) {
+    Initialization::mutate_assign<tmpl::list<
+        domain::Tags::Element<volume_dim>, domain::Tags::Mesh<volume_dim>,
+        amr::Tags::Info<volume_dim>, amr::Tags::NeighborInfo<volume_dim>>>(
+        make_not_null(&box_), std::move(element), std::move(mesh),
+        std::move(info), std::move(neighbor_info));
+  }
+
+  MockElement(
+      const Parallel::CProxy_GlobalCache<Metavariables>& /*global_cache_proxy*/,
+      const Parallel::Phase current_phase,
+      std::unordered_map<Parallel::Phase, size_t> phase_bookmarks,
+      const ElementId<volume_dim>& /*element_id*/)
+      : phase_(current_phase), phase_bookmarks_(std::move(phase_bookmarks)) {}
+
+  databox_type& databox() { return box_; }
+  const databox_type& databox() const { return box_; }
+  Parallel::Phase phase() const { return phase_; }
+  const std::unordered_map<Parallel::Phase, size_t>& phase_bookmarks() const {
+    return phase_bookmarks_;
+  }
+  bool get_terminate() const { return terminate_; }
+  void set_core(const size_t core) { core_ = core; }
+  size_t get_core() const { return core_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | box_;
+    p | phase_;
+    p | phase_bookmarks_;
+    p | core_;
+    p | terminate_;
+  }
+
+ private:
+  databox_type box_{};
+  Parallel::Phase phase_{Parallel::Phase::Initialization};
+  std::unordered_map<Parallel::Phase, size_t> phase_bookmarks_{};
+  size_t core_{0};
+  bool terminate_{true};
+};
+
+template <typename Metavariables>
+struct ElementCollection : db::SimpleTag {
+  using type = std::unordered_map<ElementId<Metavariables::volume_dim>,
+                                  MockElement<Metavariables>>;
+};
+
+template <typename Metavariables>
+struct NodegroupComponent {
+  using metavariables = Metavariables;
+  static constexpr size_t volume_dim = Metavariables::volume_dim;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = int;
+  using element_collection_tag = ElementCollection<Metavariables>;
+  using const_global_cache_tags = tmpl::list<>;
+  using simple_tags =
+      tmpl::list<element_collection_tag,
+                 Parallel::Tags::ElementLocations<volume_dim>,
+                 Parallel::Tags::NumberOfElementsTerminated,
+                 amr::Tags::JoiningChildrenItems<element_collection_tag>>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+};
+
+struct Metavariables {
+  static constexpr size_t volume_dim = 1;
+  using component_list = tmpl::list<NodegroupComponent<Metavariables>>;
+
+  struct amr : tt::ConformsTo<::amr::protocols::AmrMetavariables> {
+    using projectors =
+        tmpl::list<::amr::projectors::DefaultInitialize<verbosity_tag>>;
+  };
+};
+
+using component = NodegroupComponent<Metavariables>;
+using element_collection_tag = typename component::element_collection_tag;
+static_assert(Parallel::is_dg_element_collection_v<component>);
+
+enum class Distribution { OneNode, CreatorNodeFirst, CreatorNodeLast };
+
+const auto& element_box(
+    const ActionTesting::MockRuntimeSystem<Metavariables>& runner,
+    const int node, const ElementId<1>& element_id) {
+  return ActionTesting::get_databox_tag<component, element_collection_tag>(
+             runner, node)
+      .at(element_id)
+      .databox();
+}
+
+void invoke_queued_threaded_actions(
+    const gsl::not_null<ActionTesting::MockRuntimeSystem<Metavariables>*>
+        runner,
+    const size_t number_of_nodes) {
+  bool queues_are_empty = false;
+  while (not queues_are_empty) {
+    queues_are_empty = true;
+    for (size_t node = 0; node < number_of_nodes; ++node) {
+      if (not ActionTesting::is_threaded_action_queue_empty<component>(
+              *runner, static_cast<int>(node))) {
+        ActionTesting::invoke_queued_threaded_action<component>(
+            runner, static_cast<int>(node));
+        queues_are_empty = false;
+      }
+    }
+  }
+}
+
+// The elements and AMR decisions are the same as in Test_AdjustDomain.cpp:
+// element_1 and element_2 join, element_3 is p-refined, and element_4 splits.
+// element_2 is placed on node 1 unless all elements are on one node.
+void test(const Distribution distribution) {
+  CAPTURE(static_cast<int>(distribution));
+  const bool one_node = distribution == Distribution::OneNode;
+  const size_t number_of_nodes = one_node ? 1 : 2;
+  const int node_of_element_2 = one_node ? 0 : 1;
+  const OrientationMap<1> aligned{};
+
+  const ElementId<1> element_1_id{0, std::array{SegmentId{3, 0}}};
+  const ElementId<1> element_2_id{0, std::array{SegmentId{3, 1}}};
+  const ElementId<1> element_3_id{0, std::array{SegmentId{2, 1}}};
+  const ElementId<1> element_4_id{0, std::array{SegmentId{1, 1}}};
+  const ElementId<1> parent_id{0, std::array{SegmentId{2, 0}}};
+  const ElementId<1> lower_child_id{0, std::array{SegmentId{2, 2}}};
+  const ElementId<1> upper_child_id{0, std::array{SegmentId{2, 3}}};
+
+  const Element<1> element_1{
+      element_1_id,
+      DirectionMap<1, Neighbors<1>>{
+          {Direction<1>::upper_xi(),
+           Neighbors<1>{std::unordered_set{element_2_id}, aligned}}}};
+  const Element<1> element_2{
+      element_2_id,
+      DirectionMap<1, Neighbors<1>>{
+          {Direction<1>::lower_xi(),
+           Neighbors<1>{std::unordered_set{element_1_id}, aligned}},
+          {Direction<1>::upper_xi(),
+           Neighbors<1>{std::unordered_set{element_3_id}, aligned}}}};
+  const Element<1> element_3{
+      element_3_id,
+      DirectionMap<1, Neighbors<1>>{
+          {Direction<1>::lower_xi(),
+           Neighbors<1>{std::unordered_set{element_2_id}, aligned}},
+          {Direction<1>::upper_xi(),
+           Neighbors<1>{std::unordered_set{element_4_id}, aligned}}}};
+  const Element<1> element_4{
+      element_4_id,
+      DirectionMap<1, Neighbors<1>>{
+          {Direction<1>::lower_xi(),
+           Neighbors<1>{std::unordered_set{element_3_id}, aligned}}}};
+
+  const Mesh<1> element_1_mesh{std::array{3_st}, Spectral::Basis::Legendre,
+                               Spectral::Quadrature::GaussLobatto};
+  const Mesh<1> element_2_mesh{std::array{4_st}, Spectral::Basis::Legendre,
+                               Spectral::Quadrature::GaussLobatto};
+  const Mesh<1> element_3_mesh{std::array{5_st}, Spectral::Basis::Legendre,
+                               Spectral::Quadrature::GaussLobatto};
+  const Mesh<1> element_4_mesh{std::array{7_st}, Spectral::Basis::Legendre,
+                               Spectral::Quadrature::GaussLobatto};
+  const Mesh<1> element_3_mesh_post_refinement{
+      std::array{6_st}, Spectral::Basis::Legendre,
+      Spectral::Quadrature::GaussLobatto};
+
+  const amr::Info<1> element_1_info{{amr::Flag::Join}, element_2_mesh};
+  const amr::Info<1> element_2_info{{amr::Flag::Join}, element_2_mesh};
+  const amr::Info<1> element_3_info{{amr::Flag::IncreaseResolution},
+                                    element_3_mesh_post_refinement};
+  const amr::Info<1> element_4_info{{amr::Flag::Split}, element_4_mesh};
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      {}, {}, std::vector<size_t>(number_of_nodes, 1)};
+  ActionTesting::emplace_nodegroup_component_and_initialize<component>(
+      &runner,
+      {typename element_collection_tag::type{},
+       std::unordered_map<ElementId<1>, size_t>{
+           {element_1_id, 0_st},
+           {element_2_id, static_cast<size_t>(node_of_element_2)},
+           {element_3_id, 0_st},
+           {element_4_id, 0_st}},
+       0_st, typename amr::Tags::JoiningChildrenItems<
+                 element_collection_tag>::type{}});
+  const auto add_element = [&runner](const int node,
+                                     const ElementId<1>& element_id,
+                                     MockElement<Metavariables> element) {
+    db::mutate<element_collection_tag>(
+        [&element, &element_id](const auto element_collection) {
+          element_collection->emplace(element_id, std::move(element));
+        },
+        make_not_null(&ActionTesting::get_databox<component>(
+            make_not_null(&runner), node)));
+  };
+  add_element(0, element_1_id,
+              {element_1, element_1_mesh, element_1_info,
+               {{element_2_id, element_2_info}}});
+  add_element(node_of_element_2, element_2_id,
+              {element_2, element_2_mesh, element_2_info,
+               {{element_1_id, element_1_info},
+                {element_3_id, element_3_info}}});
+  add_element(0, element_3_id,
+              {element_3, element_3_mesh, element_3_info,
+               {{element_2_id, element_2_info},
+                {element_4_id, element_4_info}}});
+  add_element(0, element_4_id,
+              {element_4, element_4_mesh, element_4_info,
+               {{element_3_id, element_3_info}}});
+
+  if (distribution == Distribution::CreatorNodeLast) {
+    // element_2 is sent to node 0 and joined into the parent before node 0
+    // adjusts its elements
+    ActionTesting::threaded_action<component, amr::Actions::AdjustDomainOnNode>(
+        make_not_null(&runner), 1);
+    CHECK(ActionTesting::get_databox_tag<component, element_collection_tag>(
+              runner, 1)
+              .empty());
+    CHECK(ActionTesting::number_of_queued_threaded_actions<component>(
+              runner, 0) == 2);
+    ActionTesting::invoke_queued_threaded_action<component>(
+        make_not_null(&runner), 0);
+    CHECK(ActionTesting::get_databox_tag<component, element_collection_tag>(
+              runner, 0)
+              .count(parent_id) == 1);
+  }
+  ActionTesting::threaded_action<component, amr::Actions::AdjustDomainOnNode>(
+      make_not_null(&runner), 0);
+  if (distribution == Distribution::CreatorNodeFirst) {
+    // element_1 waits for element_2 on node 1
+    CHECK(ActionTesting::get_databox_tag<component, element_collection_tag>(
+              runner, 0)
+              .count(element_1_id) == 1);
+    CHECK(ActionTesting::get_databox_tag<component, element_collection_tag>(
+              runner, 0)
+              .count(parent_id) == 0);
+    ActionTesting::threaded_action<component, amr::Actions::AdjustDomainOnNode>(
+        make_not_null(&runner), 1);
+  }
+  invoke_queued_threaded_actions(make_not_null(&runner), number_of_nodes);
+
+  // Elements and their locations on all nodes
+  const std::unordered_map<ElementId<1>, size_t> expected_element_locations{
+      {parent_id, 0_st},
+      {element_3_id, 0_st},
+      {lower_child_id, 0_st},
+      {upper_child_id, 0_st}};
+  for (size_t node = 0; node < number_of_nodes; ++node) {
+    const int node_index = static_cast<int>(node);
+    CHECK(ActionTesting::get_databox_tag<component,
+                                         Parallel::Tags::ElementLocations<1>>(
+              runner, node_index) == expected_element_locations);
+    CHECK(ActionTesting::get_databox_tag<
+              component,
+              amr::Tags::JoiningChildrenItems<element_collection_tag>>(
+              runner, node_index)
+              .empty());
+  }
+  const auto& element_collection =
+      ActionTesting::get_databox_tag<component, element_collection_tag>(runner,
+                                                                        0);
+  CHECK(element_collection.size() == 4);
+  if (not one_node) {
+    CHECK(ActionTesting::get_databox_tag<component, element_collection_tag>(
+              runner, 1)
+              .empty());
+  }
+  // The new elements start out terminated
+  CHECK(ActionTesting::get_databox_tag<
+            component, Parallel::Tags::NumberOfElementsTerminated>(runner, 0) ==
+        3);
+  for (const auto& element_id : {parent_id, lower_child_id, upper_child_id}) {
+    CHECK(element_collection.at(element_id).phase() ==
+          Parallel::Phase::AdjustDomain);
+  }
+
+  // h-coarsening
+  const auto& parent_box = element_box(runner, 0, parent_id);
+  CHECK(db::get<domain::Tags::Element<1>>(parent_box) ==
+        Element<1>{parent_id,
+                   DirectionMap<1, Neighbors<1>>{
+                       {Direction<1>::upper_xi(),
+                        Neighbors<1>{std::unordered_set{element_3_id},
+                                     aligned}}}});
+  CHECK(db::get<domain::Tags::Mesh<1>>(parent_box) == element_2_mesh);
+  CHECK(db::get<domain::Tags::NeighborMesh<1>>(parent_box) ==
+        DirectionalIdMap<1, Mesh<1>>{
+            {DirectionalId<1>{Direction<1>::upper_xi(), element_3_id},
+             element_3_mesh_post_refinement}});
+  CHECK(db::get<amr::Tags::Info<1>>(parent_box).flags ==
+        std::array{amr::Flag::Undefined});
+
+  // p-refinement
+  const auto& element_3_box = element_box(runner, 0, element_3_id);
+  CHECK(db::get<domain::Tags::Element<1>>(element_3_box) ==
+        Element<1>{element_3_id,
+                   DirectionMap<1, Neighbors<1>>{
+                       {Direction<1>::lower_xi(),
+                        Neighbors<1>{std::unordered_set{parent_id}, aligned}},
+                       {Direction<1>::upper_xi(),
+                        Neighbors<1>{std::unordered_set{lower_child_id},
+                                     aligned}}}});
+  CHECK(db::get<domain::Tags::Mesh<1>>(element_3_box) ==
+        element_3_mesh_post_refinement);
+  CHECK(db::get<domain::Tags::NeighborMesh<1>>(element_3_box) ==
+        DirectionalIdMap<1, Mesh<1>>{
+            {DirectionalId<1>{Direction<1>::lower_xi(), parent_id},
+             element_2_mesh},
+            {DirectionalId<1>{Direction<1>::upper_xi(), lower_child_id},
+             element_4_mesh}});
+  CHECK(db::get<amr::Tags::Info<1>>(element_3_box) ==
+        amr::Info<1>{{amr::Flag::Undefined}, element_3_mesh_post_refinement});
+  CHECK(db::get<amr::Tags::NeighborInfo<1>>(element_3_box).empty());
+
+  // h-refinement
+  const auto& lower_child_box = element_box(runner, 0, lower_child_id);
+  CHECK(db::get<domain::Tags::Element<1>>(lower_child_box) ==
+        Element<1>{lower_child_id,
+                   DirectionMap<1, Neighbors<1>>{
+                       {Direction<1>::lower_xi(),
+                        Neighbors<1>{std::unordered_set{element_3_id},
+                                     aligned}},
+                       {Direction<1>::upper_xi(),
+                        Neighbors<1>{std::unordered_set{upper_child_id},
+                                     aligned}}}});
+  CHECK(db::get<domain::Tags::Mesh<1>>(lower_child_box) == element_4_mesh);
+  CHECK(db::get<domain::Tags::NeighborMesh<1>>(lower_child_box) ==
+        DirectionalIdMap<1, Mesh<1>>{
+            {DirectionalId<1>{Direction<1>::lower_xi(), element_3_id},
+             element_3_mesh_post_refinement},
+            {DirectionalId<1>{Direction<1>::upper_xi(), upper_child_id},
+             element_4_mesh}});
+  const auto& upper_child_box = element_box(runner, 0, upper_child_id);
+  CHECK(db::get<domain::Tags::Element<1>>(upper_child_box) ==
+        Element<1>{upper_child_id,
+                   DirectionMap<1, Neighbors<1>>{
+                       {Direction<1>::lower_xi(),
+                        Neighbors<1>{std::unordered_set{lower_child_id},
+                                     aligned}}}});
+  CHECK(db::get<domain::Tags::Mesh<1>>(upper_child_box) == element_4_mesh);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Amr.Actions.AdjustDomainOnNode",
+                  "[Unit][ParallelAlgorithms]") {
+  test(Distribution::OneNode);
+  test(Distribution::CreatorNodeFirst);
+  test(Distribution::CreatorNodeLast);
+}
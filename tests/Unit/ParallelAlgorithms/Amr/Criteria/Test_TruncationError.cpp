@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/ObservationBox.hpp"
@@ -13,6 +14,7 @@
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/ModalCoefficients.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
@@ -75,13 +77,27 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.TruncationError",
     Parallel::GlobalCache<Metavariables<Dim>> empty_cache{};
     auto databox =
         db::create<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>(
-            mesh, std::move(test_data));
+            mesh, test_data);
     ObservationBox<
         tmpl::list<>,
         db::DataBox<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>>
         box{make_not_null(&databox)};
+    const auto result =
+        criterion.evaluate(box, empty_cache, ElementId<Dim>{0});
 
-    return criterion.evaluate(box, empty_cache, ElementId<Dim>{0});
+    // The criterion reuses the modal coefficients if they are in the DataBox,
+    // which must not change the result
+    using modal_coefficients_compute =
+        ::Tags::ModalCoefficientsCompute<TestVector<Dim>, Dim>;
+    auto databox_with_modes = db::create<
+        db::AddSimpleTags<::domain::Tags::Mesh<Dim>, TestVector<Dim>>,
+        db::AddComputeTags<modal_coefficients_compute>>(mesh,
+                                                        std::move(test_data));
+    ObservationBox<tmpl::list<>, std::decay_t<decltype(databox_with_modes)>>
+        box_with_modes{make_not_null(&databox_with_modes)};
+    CHECK(criterion.evaluate(box_with_modes, empty_cache, ElementId<Dim>{0}) ==
+          result);
+    return result;
   };
 
   // Expectation:
@@ -0,0 +1,91 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <random>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "ParallelAlgorithms/Amr/Projectors/BatchedProjection.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct ScalarTag : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+
+template <size_t Dim>
+struct VectorTag : db::SimpleTag {
+  using type = tnsr::I<DataVector, Dim>;
+};
+
+template <size_t Dim>
+void test_batched_projection() {
+  CAPTURE(Dim);
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(-1., 1.);
+  const Mesh<Dim> old_mesh{4, Spectral::Basis::Legendre,
+                           Spectral::Quadrature::GaussLobatto};
+  std::array<size_t, Dim> new_extents{};
+  std::iota(new_extents.begin(), new_extents.end(), 3_st);
+  const Mesh<Dim> new_mesh{new_extents, Spectral::Basis::Legendre,
+                           Spectral::Quadrature::GaussLobatto};
+  const auto matrices = Spectral::p_projection_matrices(old_mesh, new_mesh);
+  const auto& old_extents = old_mesh.extents();
+  const size_t old_num_points = old_mesh.number_of_grid_points();
+
+  using VarsType = Variables<tmpl::list<ScalarTag, VectorTag<Dim>>>;
+  const auto vars = make_with_random_values<VarsType>(
+      make_not_null(&generator), make_not_null(&dist), old_num_points);
+  const auto tensor = make_with_random_values<tnsr::ij<DataVector, Dim>>(
+      make_not_null(&generator), make_not_null(&dist), old_num_points);
+  const auto vector = make_with_random_values<DataVector>(
+      make_not_null(&generator), make_not_null(&dist), old_num_points);
+
+  VarsType projected_vars{};
+  auto projected_tensor = tensor;
+  auto projected_vector = vector;
+  amr::projectors::BatchedProjection projection{};
+  projection.add(make_not_null(&projected_vars), vars);
+  projection.add(make_not_null(&projected_tensor));
+  projection.add(make_not_null(&projected_vector));
+  projection.apply(matrices, old_extents);
+
+  CHECK(projected_vars.number_of_grid_points() ==
+        new_mesh.number_of_grid_points());
+  CHECK_VARIABLES_APPROX(projected_vars,
+                         apply_matrices(matrices, vars, old_extents));
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    CHECK_ITERABLE_APPROX(projected_tensor[i],
+                          apply_matrices(matrices, tensor[i], old_extents));
+  }
+  CHECK_ITERABLE_APPROX(projected_vector,
+                        apply_matrices(matrices, vector, old_extents));
+
+  // Applying an empty projection does nothing
+  projection.apply(matrices, old_extents);
+  CHECK(projected_vector.size() == new_mesh.number_of_grid_points());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Amr.Projectors.BatchedProjection",
+                  "[ParallelAlgorithms][Unit]") {
+  test_batched_projection<1>();
+  test_batched_projection<2>();
+  test_batched_projection<3>();
+}
@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <optional>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
@@ -214,7 +215,12 @@ void do_test(const bool time_runs_forward, const bool add_event) {
   };
 
   using TriggeringState = EventsAndDenseTriggers::TriggeringState;
+  CHECK(events_and_dense_triggers.scheduled_checks_needing_evolved_variables()
+            .empty());
   CHECK(events_and_dense_triggers.next_trigger(box) == -1.0 * time_sign);
+  CHECK(
+      events_and_dense_triggers.scheduled_checks_needing_evolved_variables() ==
+      std::vector<double>{-1.0 * time_sign});
   CHECK(events_and_dense_triggers.is_ready(make_not_null(&box), cache,
                                            array_index, component) ==
         TriggeringState::NotReady);
@@ -254,6 +260,10 @@ void do_test(const bool time_runs_forward, const bool add_event) {
   CHECK(events_and_dense_triggers.reschedule(make_not_null(&box), cache,
                                              array_index, component));
   CHECK(events_and_dense_triggers.next_trigger(box) == 2.0 * time_sign);
+  // Only the events of TriggerB need the evolved variables.
+  CHECK(
+      events_and_dense_triggers.scheduled_checks_needing_evolved_variables() ==
+      std::vector<double>{3.0 * time_sign});
   set_tag(Tags::Time{}, 2.0 * time_sign);
   set_tag(TriggerA::IsTriggered{}, std::nullopt);
   set_tag(TriggerB::IsTriggered{}, std::nullopt);
@@ -33,6 +33,9 @@ SPECTRE_TEST_CASE("Unit.ParallelSchwarz.Tags",
   TestHelpers::db::test_simple_tag<
       Tags::SubdomainSolver<DummySubdomainSolver, DummyOptionsGroup>>(
       "SubdomainSolver(DummyOptionsGroup)");
+  TestHelpers::db::test_simple_tag<
+      Tags::EagerSubdomainSolves<DummyOptionsGroup>>(
+      "EagerSubdomainSolves(DummyOptionsGroup)");
   TestHelpers::db::test_simple_tag<
       Tags::IntrudingExtents<1, DummyOptionsGroup>>(
       "IntrudingExtents(DummyOptionsGroup)");
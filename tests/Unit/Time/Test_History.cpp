@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstdint>
 #include <optional>
 #include <type_traits>
 
@@ -618,6 +619,90 @@ void test_history() {
   }
 }
 
+template <typename Vars, typename Derivs>
+void test_discard_derivative() {
+  const auto make_value = [](const double v) {
+    return make_with_value<Vars>(num_points, v);
+  };
+  const auto make_deriv = [](const double v) {
+    return make_with_value<Derivs>(num_points, v);
+  };
+
+  using History = TimeSteppers::History<Vars>;
+  using UntypedVars = typename History::UntypedVars;
+  using MutableUntyped = TimeSteppers::MutableUntypedHistory<UntypedVars>;
+
+  const Slab slab(0.0, 1.0);
+  const auto step_size = slab.duration() / 2;
+  const TimeStepId step_id(true, 0, slab.start());
+  const auto substep_id = [&](const uint64_t substep) {
+    return TimeStepId(true, 0, slab.start(), substep, step_size,
+                      (slab.start() + step_size).value());
+  };
+
+  History history(2);
+  history.insert(step_id, make_value(1.0), make_deriv(10.0));
+  history.insert(substep_id(1), make_value(2.0), make_deriv(20.0));
+  history.insert(substep_id(2), make_value(3.0), make_deriv(30.0));
+  // [(0, 1, 10)] [0: (1, 2, 20), (2, 3, 30)]
+
+  CHECK(not history.derivative_is_discarded(step_id));
+  CHECK(not history.derivative_is_discarded(substep_id(1)));
+  history.discard_derivative(substep_id(1));
+  // [(0, 1, 10)] [0: (1, 2, X), (2, 3, 30)]
+  CHECK(history.derivative_is_discarded(substep_id(1)));
+  CHECK(not history.derivative_is_discarded(substep_id(2)));
+  CHECK(*history.substeps()[0].value == make_value(2.0));
+  // Discarding twice is harmless.
+  history.discard_derivative(substep_id(1));
+  CHECK(history.derivative_is_discarded(substep_id(1)));
+
+  static_cast<const MutableUntyped&>(history.untyped())
+      .discard_derivative(substep_id(2));
+  // [(0, 1, 10)] [0: (1, 2, X), (2, 3, X)]
+  CHECK(history.derivative_is_discarded(substep_id(2)));
+
+  {
+    const auto copy = serialize_and_deserialize(history);
+    CHECK(copy.derivative_is_discarded(substep_id(1)));
+    CHECK(copy.derivative_is_discarded(substep_id(2)));
+    History transformed{};
+    TimeSteppers::transform(make_not_null(&transformed), history,
+                            [](const auto& entry) { return entry; });
+    CHECK(transformed.derivative_is_discarded(substep_id(1)));
+    CHECK(transformed.derivative_is_discarded(substep_id(2)));
+    CHECK(*transformed.substeps()[1].value == make_value(3.0));
+  }
+
+  // Discarded derivatives are skipped, so this would fail on an
+  // emptied Variables.
+  history.map_entries([](const auto entry) { *entry *= 10.0; });
+  CHECK(history.front().derivative == make_deriv(100.0));
+  CHECK(*history.substeps()[1].value == make_value(30.0));
+
+  history.undo_latest();
+  // [(0, 10, 100)] [0: (1, 20, X)]
+  history.insert(substep_id(2), make_value(4.0), make_deriv(40.0));
+  // [(0, 10, 100)] [0: (1, 20, X), (2, 4, 40)]
+  CHECK(not history.derivative_is_discarded(substep_id(2)));
+  CHECK(history.substeps()[1].derivative == make_deriv(40.0));
+
+  history.clear_substeps();
+  history.insert(substep_id(1), make_value(5.0), make_deriv(50.0));
+  CHECK(not history.derivative_is_discarded(substep_id(1)));
+  CHECK(history.substeps()[0].derivative == make_deriv(50.0));
+
+  history.add_to_derivative(substep_id(1), 2.0, step_id);
+  // [(0, 10, 100)] [0: (1, 5, 250)]
+  CHECK(history.substeps()[0].derivative == make_deriv(250.0));
+  CHECK(history.front().derivative == make_deriv(100.0));
+  static_cast<const MutableUntyped&>(history.untyped())
+      .add_to_derivative(step_id, -1.0, substep_id(1));
+  // [(0, 10, -150)] [0: (1, 5, 250)]
+  CHECK(history.front().derivative == make_deriv(-150.0));
+  CHECK(history.substeps()[0].derivative == make_deriv(250.0));
+}
+
 void test_history_assertions() {
 #ifdef SPECTRE_DEBUG
   const Slab slab(0.0, 1.0);
@@ -843,6 +928,29 @@ void test_history_assertions() {
         Catch::Matchers::ContainsSubstring("not present"));
   }
 
+  // Derivative discarding errors
+  {
+    TimeSteppers::History<double> history(1);
+    history.insert(TimeStepId(true, 0, slab.start()), 0.0, 0.0);
+    CHECK_THROWS_WITH(
+        history.discard_derivative(TimeStepId(true, 0, slab.start())),
+        Catch::Matchers::ContainsSubstring("is not a substep in the history"));
+    CHECK_THROWS_WITH(
+        history.untyped().discard_derivative(
+            TimeStepId(true, 0, slab.start(), 1, step, slab.start().value())),
+        Catch::Matchers::ContainsSubstring("is not a substep in the history"));
+
+    const TimeStepId substep_id(true, 0, slab.start(), 1, step,
+                                slab.start().value());
+    history.insert(substep_id, 0.0, 0.0);
+    history.discard_derivative(substep_id);
+    CHECK_THROWS_WITH(
+        history.add_to_derivative(TimeStepId(true, 0, slab.start()), 1.0,
+                                  substep_id),
+        Catch::Matchers::ContainsSubstring(
+            "Cannot combine discarded derivatives"));
+  }
+
   // latest_value errors
   {
     TimeSteppers::History<double> history(1);
@@ -904,6 +1012,10 @@ SPECTRE_TEST_CASE("Unit.Time.History", "[Unit][Time]") {
   test_history<Variables<tmpl::list<VarTag>>,
                Variables<tmpl::list<Tags::dt<VarTag>>>>();
 
+  test_discard_derivative<double, double>();
+  test_discard_derivative<Variables<tmpl::list<VarTag>>,
+                          Variables<tmpl::list<Tags::dt<VarTag>>>>();
+
   test_history_assertions();
 
   test_history_output();
@@ -0,0 +1,113 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Time/TimeSteppers/FusedUpdate.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+template <typename T>
+void test_fused_update(const gsl::not_null<std::mt19937*> generator,
+                       const T& used_for_size) {
+  std::uniform_real_distribution<> dist{-1.0, 1.0};
+  for (size_t number_of_terms = 0;
+       number_of_terms <= TimeSteppers::maximum_fused_update_terms;
+       number_of_terms += 3) {
+    CAPTURE(number_of_terms);
+    const auto initial = make_with_random_values<T>(
+        generator, make_not_null(&dist), used_for_size);
+    std::vector<T> values{};
+    TimeSteppers::FusedUpdateTerms<T> terms{};
+    T expected = initial;
+    for (size_t i = 0; i < number_of_terms; ++i) {
+      values.push_back(make_with_random_values<T>(
+          generator, make_not_null(&dist), used_for_size));
+    }
+    for (size_t i = 0; i < number_of_terms; ++i) {
+      const double coefficient = dist(*generator);
+      terms.emplace_back(coefficient, &values[i]);
+      expected += coefficient * values[i];
+    }
+
+    T result = make_with_random_values<T>(generator, make_not_null(&dist),
+                                          used_for_size);
+    TimeSteppers::fused_update(make_not_null(&result), initial, terms);
+    CHECK_ITERABLE_APPROX(result, expected);
+
+    // Update in place
+    result = initial;
+    TimeSteppers::fused_update(make_not_null(&result), result, terms);
+    CHECK_ITERABLE_APPROX(result, expected);
+  }
+}
+
+template <typename T>
+void test_multiple_fused_updates(const gsl::not_null<std::mt19937*> generator,
+                                 const T& used_for_size) {
+  std::uniform_real_distribution<> dist{-1.0, 1.0};
+  const size_t number_of_values = 5;
+  const auto initial = make_with_random_values<T>(
+      generator, make_not_null(&dist), used_for_size);
+  std::vector<T> values{};
+  for (size_t i = 0; i < number_of_values; ++i) {
+    values.push_back(make_with_random_values<T>(
+        generator, make_not_null(&dist), used_for_size));
+  }
+
+  // Results sharing all, some, and none of the values
+  for (const size_t number_of_results : {0_st, 1_st, 3_st}) {
+    CAPTURE(number_of_results);
+    std::vector<TimeSteppers::FusedUpdateTerms<T>> terms(number_of_results);
+    std::vector<T> expected(number_of_results, initial);
+    std::vector<T> results{};
+    std::vector<T*> result_pointers{};
+    for (size_t j = 0; j < number_of_results; ++j) {
+      for (size_t i = j; i < number_of_values; ++i) {
+        const double coefficient = dist(*generator);
+        terms[j].emplace_back(coefficient, &values[i]);
+        expected[j] += coefficient * values[i];
+      }
+      results.push_back(make_with_random_values<T>(
+          generator, make_not_null(&dist), used_for_size));
+    }
+    for (auto& result : results) {
+      result_pointers.push_back(&result);
+    }
+
+    TimeSteppers::fused_update(
+        gsl::span<T* const>(result_pointers), initial,
+        gsl::span<const TimeSteppers::FusedUpdateTerms<T>>(terms));
+    for (size_t j = 0; j < number_of_results; ++j) {
+      CHECK_ITERABLE_APPROX(results[j], expected[j]);
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.FusedUpdate", "[Unit][Time]") {
+  MAKE_GENERATOR(generator);
+  test_fused_update(make_not_null(&generator), 0.0);
+  test_fused_update(make_not_null(&generator), std::complex<double>{});
+  test_multiple_fused_updates(make_not_null(&generator), 0.0);
+  test_multiple_fused_updates(make_not_null(&generator),
+                              std::complex<double>{});
+  // Sizes smaller than, equal to, and not a multiple of the block size
+  for (const size_t size : {1_st, 5_st, 256_st, 600_st}) {
+    CAPTURE(size);
+    test_fused_update(make_not_null(&generator), DataVector(size));
+    test_fused_update(make_not_null(&generator), ComplexDataVector(size));
+    test_multiple_fused_updates(make_not_null(&generator), DataVector(size));
+    test_multiple_fused_updates(make_not_null(&generator),
+                                ComplexDataVector(size));
+  }
+}
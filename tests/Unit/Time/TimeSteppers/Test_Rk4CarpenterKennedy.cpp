@@ -0,0 +1,49 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/Time/TimeSteppers/RungeKutta.hpp"
+#include "Helpers/Time/TimeSteppers/TimeStepperTestUtils.hpp"
+#include "Time/TimeSteppers/Rk4CarpenterKennedy.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.Rk4CarpenterKennedy",
+                  "[Unit][Time]") {
+  const TimeSteppers::Rk4CarpenterKennedy stepper{};
+
+  CHECK(stepper.order() == 4);
+  CHECK(stepper.error_estimate_order() == 2);
+  CHECK(stepper.number_of_substeps() == 5);
+  CHECK(stepper.number_of_substeps_for_error() == 5);
+  TestHelpers::RungeKutta::check_tableau(stepper);
+  // A standard five-stage method holds seven.
+  TestHelpers::RungeKutta::check_history_storage(stepper, 3);
+
+  TimeStepperTestUtils::check_substep_properties(stepper);
+  TimeStepperTestUtils::integrate_test(stepper, 4, 0, 1.0, 1.0e-13);
+  TimeStepperTestUtils::integrate_test(stepper, 4, 0, -1.0, 1.0e-13);
+  TimeStepperTestUtils::integrate_test_explicit_time_dependence(stepper, 4, 0,
+                                                                -1.0, 1.0e-13);
+  // The error estimate is two orders lower than the method.
+  TimeStepperTestUtils::integrate_error_test(stepper, 4, 0, 1.0, 1.0e-8, 50,
+                                             1.0e-4);
+  TimeStepperTestUtils::integrate_error_test(stepper, 4, 0, -1.0, 1.0e-8, 50,
+                                             1.0e-4);
+  TimeStepperTestUtils::integrate_variable_test(stepper, 4, 0, 1.0e-13);
+  // The stability region is narrowest away from the real axis.
+  TimeStepperTestUtils::stability_test(stepper, 2.372760222499264);
+  TimeStepperTestUtils::check_convergence_order(stepper, {10, 50});
+  TimeStepperTestUtils::check_dense_output(stepper, {20, 80}, 2, true);
+
+  TestHelpers::test_factory_creation<TimeStepper,
+                                     TimeSteppers::Rk4CarpenterKennedy>(
+      "Rk4CarpenterKennedy");
+  test_serialization(stepper);
+  test_serialization_via_base<TimeStepper,
+                              TimeSteppers::Rk4CarpenterKennedy>();
+  // test operator !=
+  CHECK_FALSE(stepper != stepper);
+}
@@ -0,0 +1,58 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Serialization/PersistentCache.hpp"
+
+SPECTRE_TEST_CASE("Unit.Serialization.PersistentCache", "[Unit][Utilities]") {
+  const std::string cache_directory = "Unit.Serialization.PersistentCache";
+  if (file_system::check_if_dir_exists(cache_directory)) {
+    file_system::rm(cache_directory, true);
+  }
+  const std::vector<double> artifact{1., 2., 3.};
+  CHECK_FALSE(persistent_cache::read<std::vector<double>>(cache_directory,
+                                                          "Artifact", 1)
+                  .has_value());
+  persistent_cache::write(cache_directory, "Artifact", 1, artifact);
+  CHECK(file_system::check_if_dir_exists(cache_directory));
+  CHECK(persistent_cache::read<std::vector<double>>(cache_directory,
+                                                    "Artifact", 1) ==
+        artifact);
+  // Different inputs or kinds of artifacts are not found
+  CHECK_FALSE(persistent_cache::read<std::vector<double>>(cache_directory,
+                                                          "Artifact", 2)
+                  .has_value());
+  CHECK_FALSE(persistent_cache::read<std::vector<double>>(
+                  cache_directory, "OtherArtifact", 1)
+                  .has_value());
+  // Overwriting replaces the artifact
+  const std::vector<double> other_artifact{4., 5.};
+  persistent_cache::write(cache_directory, "Artifact", 1, other_artifact);
+  CHECK(persistent_cache::read<std::vector<double>>(cache_directory,
+                                                    "Artifact", 1) ==
+        other_artifact);
+  CHECK(file_system::ls(cache_directory).size() == 1);
+  // Files that aren't valid cache files are ignored
+  {
+    std::ofstream corrupted_file(cache_directory + "/Artifact_3.bin");
+    corrupted_file << "Not a cache file";
+  }
+  CHECK_FALSE(persistent_cache::read<std::vector<double>>(cache_directory,
+                                                          "Artifact", 3)
+                  .has_value());
+  // Failures to write are ignored, e.g. when the cache directory can't be
+  // created because a file with that name exists
+  const std::string not_a_directory = cache_directory + "/Artifact_3.bin";
+  persistent_cache::write(not_a_directory, "Artifact", 1, artifact);
+  CHECK_FALSE(persistent_cache::read<std::vector<double>>(not_a_directory,
+                                                          "Artifact", 1)
+                  .has_value());
+  file_system::rm(cache_directory, true);
+}
@@ -91,6 +91,45 @@ class TestGenerateXdmf(unittest.TestCase):
         # details, we should refactor the script into smaller units.
         self.assertTrue(os.path.isfile(output_filename + ".xmf"))
 
+    def test_shared_topology(self):
+        # Add a second observation to a copy of the test data that shares the
+        # connectivity of the first one through a hard link
+        data_file = os.path.join(self.test_dir, "SharedTopology.h5")
+        shutil.copy(os.path.join(self.data_dir, "VolTestData0.h5"), data_file)
+        with h5py.File(data_file, "r+") as open_h5_file:
+            vol_subfile = open_h5_file["element_data.vol"]
+            first_obs_name = list(vol_subfile.keys())[0]
+            first_obs = vol_subfile[first_obs_name]
+            vol_subfile.copy(first_obs, "ObservationId1")
+            second_obs = vol_subfile["ObservationId1"]
+            second_obs.attrs["observation_value"] = (
+                first_obs.attrs["observation_value"] + 1.0
+            )
+            del second_obs["connectivity"]
+            second_obs["connectivity"] = first_obs["connectivity"]
+        output_filename = os.path.join(self.test_dir, "SharedTopology")
+        generate_xdmf(
+            h5files=[data_file],
+            output=output_filename,
+            subfile_name="element_data",
+        )
+        xmf_root = ET.parse(output_filename + ".xmf").getroot()
+        topology_paths = [
+            data_item.text
+            for data_item in xmf_root.iterfind(".//Topology/DataItem")
+        ]
+        expected_path = (
+            f"SharedTopology.h5:/element_data.vol/{first_obs_name}/connectivity"
+        )
+        self.assertEqual(topology_paths, [expected_path, expected_path])
+        geometry_paths = [
+            data_item.text
+            for data_item in xmf_root.iterfind(".//Geometry/DataItem")
+        ]
+        self.assertTrue(
+            any("ObservationId1/" in path for path in geometry_paths)
+        )
+
     def test_subfile_not_found(self):
         data_files = glob.glob(os.path.join(self.data_dir, "VolTestData*.h5"))
         output_filename = os.path.join(
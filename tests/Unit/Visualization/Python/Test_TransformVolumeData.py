@@ -6,6 +6,7 @@ import os
 import shutil
 import unittest
 
+import click
 import numpy as np
 import numpy.testing as npt
 from click.testing import CliRunner
@@ -19,6 +20,7 @@ from spectre.PointwiseFunctions.Punctures import adm_mass_integrand
 from spectre.Spectral import Mesh
 from spectre.Visualization.TransformVolumeData import (
     Kernel,
+    parse_native_kernel,
     parse_pybind11_signatures,
     snake_case_to_camel_case,
     transform_volume_data,
@@ -289,6 +291,40 @@ class TestTransformVolumeData(unittest.TestCase):
                 rtol=1e-2,
             )
 
+    def test_cli_native_kernels(self):
+        runner = CliRunner()
+        result = runner.invoke(
+            transform_volume_data_command,
+            [
+                self.h5_filename,
+                "-d",
+                "element_data.vol",
+                "-n",
+                "PsiNorm=PointwiseL2Norm(Psi)",
+                "-n",
+                "PartialDerivatives(Psi)",
+                "-n",
+                "InertialCoordinates",
+                "-f",
+            ],
+            catch_exceptions=False,
+        )
+        self.assertEqual(result.exit_code, 0, result.output)
+        with spectre_h5.H5File(self.h5_filename, "r") as open_h5_file:
+            volfile = open_h5_file.get_vol("/element_data")
+            obs_id = volfile.list_observation_ids()[0]
+            psi = np.array(volfile.get_tensor_component(obs_id, "Psi").data)
+            npt.assert_allclose(
+                np.array(volfile.get_tensor_component(obs_id, "PsiNorm").data),
+                np.abs(psi),
+            )
+            for xyz in ["_x", "_y", "_z"]:
+                self.assertIn(
+                    "DerivPsi" + xyz, volfile.list_tensor_components(obs_id)
+                )
+        with self.assertRaisesRegex(click.BadParameter, "Invalid native"):
+            parse_native_kernel("PointwiseL2Norm(Psi")
+
 
 if __name__ == "__main__":
     unittest.main(verbosity=2)